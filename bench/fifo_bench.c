@@ -0,0 +1,724 @@
+/**
+ * 	@file fifo_bench.c
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Microbenchmarks of software FIFO buffers.
+ *  Prints one JSON object per line, see print_result() for the fields.
+ *  Usage: fifo_bench [--quick]
+ *
+ */
+
+#define _GNU_SOURCE
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "fifo.h"
+#include "fifo_pow2.h"
+#include "fifo_spsc.h"
+#include "fifo_shard.h"
+
+/**
+* 	@brief	Capacity of every benchmarked FIFO buffer, a power of two for fifo_pow2_* types.
+*/
+#define BENCH_CAPACITY			1024
+
+/**
+* 	@brief	Capacity of the cross-thread SPSC FIFO buffer.
+*/
+#define BENCH_SPSC_CAPACITY		4096
+
+static uint32_t bench_rounds = 20000;			/**< Fill/drain rounds of single-thread benchmarks */
+static uint32_t bench_items = 20000000;			/**< Entries moved by the throughput benchmark */
+static uint32_t bench_samples = 100000;			/**< Samples of the latency benchmark */
+
+static volatile uint64_t bench_sink;			/**< Keeps popped values alive */
+
+static const fifo_size_t bench_batches[] = {1, 8, 64, 512};
+
+/**
+ *	@brief Returns monotonic time in nanoseconds.
+ */
+static inline uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ((uint64_t)ts.tv_sec * 1000000000u) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ *	@brief Prints result of a per-operation benchmark.
+ */
+static void print_result(const char *bench, const char *impl, const char *type, fifo_size_t batch, uint64_t ns, uint64_t ops)
+{
+	printf("{\"bench\":\"%s\",\"impl\":\"%s\",\"type\":\"%s\",\"batch\":%lu,\"ops\":%llu,\"ns_per_op\":%.3f}\n",
+			bench, impl, type, (unsigned long)batch, (unsigned long long)ops, ((double)ns / (double)ops));
+}
+
+/**
+ *	@brief Pins calling thread to cpu when the system has more than one.
+ */
+static void pin_thread(int cpu)
+{
+	cpu_set_t set;
+
+	if(sysconf(_SC_NPROCESSORS_ONLN) < 2) return; /* single cpu */
+
+	CPU_ZERO(&set);
+	CPU_SET(cpu, &set);
+	pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+/**
+* 	@brief	Defines bench_single_<impl>_<name>(): alternately fills and drains the FIFO with single push/pop.
+*
+* 	init, push and pop are expressions using local variables fifo, storage and val.
+*/
+#define BENCH_SINGLE(impl, name, fifo_type, type, init, push, pop)									\
+static void bench_single_##impl##_##name(void)														\
+{																									\
+	static type storage[BENCH_CAPACITY];															\
+	fifo_type fifo;																					\
+	type val = 0;																					\
+	uint64_t push_ns = 0;																			\
+	uint64_t pop_ns = 0;																			\
+	uint64_t start = 0;																				\
+	uint32_t r = 0;																					\
+	uint32_t i = 0;																					\
+																									\
+	init;																							\
+																									\
+	for(r = 0; r < bench_rounds; r++)																\
+	{																								\
+		start = now_ns();																			\
+		for(i = 0; i < BENCH_CAPACITY; i++)															\
+		{																							\
+			val = (type)i;																			\
+			push;																					\
+		}																							\
+		push_ns += (now_ns() - start);																\
+																									\
+		start = now_ns();																			\
+		for(i = 0; i < BENCH_CAPACITY; i++)															\
+		{																							\
+			pop;																					\
+			bench_sink += (uint64_t)val;															\
+		}																							\
+		pop_ns += (now_ns() - start);																\
+	}																								\
+																									\
+	print_result("push", #impl, #name, 1, push_ns, ((uint64_t)bench_rounds * BENCH_CAPACITY));		\
+	print_result("pop", #impl, #name, 1, pop_ns, ((uint64_t)bench_rounds * BENCH_CAPACITY));		\
+}
+
+/**
+* 	@brief	Defines bench_mul_<impl>_<name>(): fills and drains the FIFO with push_mul/pop_mul of every batch size.
+*
+* 	init, push_mul and pop_mul are expressions using local variables fifo, storage, data and batch.
+*/
+#define BENCH_MUL(impl, name, fifo_type, type, init, push_mul, pop_mul)								\
+static void bench_mul_##impl##_##name(void)															\
+{																									\
+	static type storage[BENCH_CAPACITY];															\
+	static type data[BENCH_CAPACITY];																\
+	fifo_type fifo;																					\
+	fifo_size_t batch = 0;																			\
+	uint64_t push_ns = 0;																			\
+	uint64_t pop_ns = 0;																			\
+	uint64_t start = 0;																				\
+	uint32_t r = 0;																					\
+	uint32_t i = 0;																					\
+	size_t b = 0;																					\
+																									\
+	for(b = 0; b < (sizeof(bench_batches) / sizeof(bench_batches[0])); b++)							\
+	{																								\
+		batch = bench_batches[b];																	\
+		push_ns = 0;																				\
+		pop_ns = 0;																					\
+		init;																						\
+																									\
+		for(r = 0; r < bench_rounds; r++)															\
+		{																							\
+			start = now_ns();																		\
+			for(i = 0; i < (BENCH_CAPACITY / batch); i++) push_mul;									\
+			push_ns += (now_ns() - start);															\
+																									\
+			start = now_ns();																		\
+			for(i = 0; i < (BENCH_CAPACITY / batch); i++) pop_mul;									\
+			pop_ns += (now_ns() - start);															\
+			bench_sink += (uint64_t)data[0];														\
+		}																							\
+																									\
+		print_result("push_mul", #impl, #name, batch, push_ns, ((uint64_t)bench_rounds * BENCH_CAPACITY)); \
+		print_result("pop_mul", #impl, #name, batch, pop_ns, ((uint64_t)bench_rounds * BENCH_CAPACITY)); \
+	}																								\
+}
+
+BENCH_SINGLE(fifo, uint8, fifo_uint8_TD, uint8_t,
+		fifo_uint8_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_uint8_push(&fifo, val), fifo_uint8_pop(&fifo, &val))
+BENCH_SINGLE(fifo, uint16, fifo_uint16_TD, uint16_t,
+		fifo_uint16_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_uint16_push(&fifo, val), fifo_uint16_pop(&fifo, &val))
+BENCH_SINGLE(fifo, uint32, fifo_uint32_TD, uint32_t,
+		fifo_uint32_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_uint32_push(&fifo, val), fifo_uint32_pop(&fifo, &val))
+BENCH_SINGLE(fifo, common32, fifo_common_TD, uint32_t,
+		fifo_common_init(&fifo, storage, BENCH_CAPACITY, sizeof(uint32_t), true),
+		fifo_common_push(&fifo, &val), fifo_common_pop(&fifo, &val))
+
+BENCH_SINGLE(fast, uint8, fifo_uint8_TD, uint8_t,
+		fifo_uint8_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_uint8_push_fast(&fifo, val), val = fifo_uint8_pop_fast(&fifo))
+BENCH_SINGLE(fast, uint16, fifo_uint16_TD, uint16_t,
+		fifo_uint16_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_uint16_push_fast(&fifo, val), val = fifo_uint16_pop_fast(&fifo))
+BENCH_SINGLE(fast, uint32, fifo_uint32_TD, uint32_t,
+		fifo_uint32_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_uint32_push_fast(&fifo, val), val = fifo_uint32_pop_fast(&fifo))
+
+BENCH_SINGLE(pow2, uint8, fifo_pow2_uint8_TD, uint8_t,
+		fifo_pow2_uint8_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_pow2_uint8_push(&fifo, val), fifo_pow2_uint8_pop(&fifo, &val))
+BENCH_SINGLE(pow2, uint16, fifo_pow2_uint16_TD, uint16_t,
+		fifo_pow2_uint16_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_pow2_uint16_push(&fifo, val), fifo_pow2_uint16_pop(&fifo, &val))
+BENCH_SINGLE(pow2, uint32, fifo_pow2_uint32_TD, uint32_t,
+		fifo_pow2_uint32_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_pow2_uint32_push(&fifo, val), fifo_pow2_uint32_pop(&fifo, &val))
+BENCH_SINGLE(pow2, common32, fifo_pow2_common_TD, uint32_t,
+		fifo_pow2_common_init(&fifo, storage, BENCH_CAPACITY, sizeof(uint32_t), true),
+		fifo_pow2_common_push(&fifo, &val), fifo_pow2_common_pop(&fifo, &val))
+
+BENCH_SINGLE(spsc, uint8, fifo_spsc_uint8_TD, uint8_t,
+		fifo_spsc_uint8_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_spsc_uint8_push(&fifo, val), fifo_spsc_uint8_pop(&fifo, &val))
+BENCH_SINGLE(spsc, uint16, fifo_spsc_uint16_TD, uint16_t,
+		fifo_spsc_uint16_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_spsc_uint16_push(&fifo, val), fifo_spsc_uint16_pop(&fifo, &val))
+BENCH_SINGLE(spsc, uint32, fifo_spsc_uint32_TD, uint32_t,
+		fifo_spsc_uint32_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_spsc_uint32_push(&fifo, val), fifo_spsc_uint32_pop(&fifo, &val))
+BENCH_SINGLE(spsc, common32, fifo_spsc_common_TD, uint32_t,
+		fifo_spsc_common_init(&fifo, storage, BENCH_CAPACITY, sizeof(uint32_t), true),
+		fifo_spsc_common_push(&fifo, &val), fifo_spsc_common_pop(&fifo, &val))
+
+BENCH_MUL(fifo, uint8, fifo_uint8_TD, uint8_t,
+		fifo_uint8_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_uint8_push_mul(&fifo, data, batch), fifo_uint8_pop_mul(&fifo, data, batch))
+BENCH_MUL(fifo, uint16, fifo_uint16_TD, uint16_t,
+		fifo_uint16_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_uint16_push_mul(&fifo, data, batch), fifo_uint16_pop_mul(&fifo, data, batch))
+BENCH_MUL(fifo, uint32, fifo_uint32_TD, uint32_t,
+		fifo_uint32_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_uint32_push_mul(&fifo, data, batch), fifo_uint32_pop_mul(&fifo, data, batch))
+
+BENCH_MUL(fast, uint8, fifo_uint8_TD, uint8_t,
+		fifo_uint8_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_uint8_push_mul_fast(&fifo, data, batch), fifo_uint8_pop_mul_fast(&fifo, data, batch))
+BENCH_MUL(fast, uint16, fifo_uint16_TD, uint16_t,
+		fifo_uint16_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_uint16_push_mul_fast(&fifo, data, batch), fifo_uint16_pop_mul_fast(&fifo, data, batch))
+BENCH_MUL(fast, uint32, fifo_uint32_TD, uint32_t,
+		fifo_uint32_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_uint32_push_mul_fast(&fifo, data, batch), fifo_uint32_pop_mul_fast(&fifo, data, batch))
+
+BENCH_MUL(pow2, uint8, fifo_pow2_uint8_TD, uint8_t,
+		fifo_pow2_uint8_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_pow2_uint8_push_mul(&fifo, data, batch), fifo_pow2_uint8_pop_mul(&fifo, data, batch))
+BENCH_MUL(pow2, uint16, fifo_pow2_uint16_TD, uint16_t,
+		fifo_pow2_uint16_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_pow2_uint16_push_mul(&fifo, data, batch), fifo_pow2_uint16_pop_mul(&fifo, data, batch))
+BENCH_MUL(pow2, uint32, fifo_pow2_uint32_TD, uint32_t,
+		fifo_pow2_uint32_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_pow2_uint32_push_mul(&fifo, data, batch), fifo_pow2_uint32_pop_mul(&fifo, data, batch))
+BENCH_MUL(pow2, common32, fifo_pow2_common_TD, uint32_t,
+		fifo_pow2_common_init(&fifo, storage, BENCH_CAPACITY, sizeof(uint32_t), true),
+		fifo_pow2_common_push_mul(&fifo, data, batch), fifo_pow2_common_pop_mul(&fifo, data, batch))
+
+BENCH_MUL(spsc, uint8, fifo_spsc_uint8_TD, uint8_t,
+		fifo_spsc_uint8_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_spsc_uint8_push_mul(&fifo, data, batch), fifo_spsc_uint8_pop_mul(&fifo, data, batch))
+BENCH_MUL(spsc, uint16, fifo_spsc_uint16_TD, uint16_t,
+		fifo_spsc_uint16_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_spsc_uint16_push_mul(&fifo, data, batch), fifo_spsc_uint16_pop_mul(&fifo, data, batch))
+BENCH_MUL(spsc, uint32, fifo_spsc_uint32_TD, uint32_t,
+		fifo_spsc_uint32_init(&fifo, storage, BENCH_CAPACITY, true),
+		fifo_spsc_uint32_push_mul(&fifo, data, batch), fifo_spsc_uint32_pop_mul(&fifo, data, batch))
+BENCH_MUL(spsc, common32, fifo_spsc_common_TD, uint32_t,
+		fifo_spsc_common_init(&fifo, storage, BENCH_CAPACITY, sizeof(uint32_t), true),
+		fifo_spsc_common_push_mul(&fifo, data, batch), fifo_spsc_common_pop_mul(&fifo, data, batch))
+
+/**
+* 	@brief	Entries of the drain benchmark FIFO buffer, 2 MiB of storage with BENCH_ITER_ENTRY_SIZE.
+*/
+#define BENCH_ITER_CAPACITY		16384
+
+/**
+* 	@brief	Entry size of the drain benchmark FIFO buffer, two cache lines.
+*/
+#define BENCH_ITER_ENTRY_SIZE	128
+
+/**
+ *	@brief Visitor of drain benchmark, sums the first word of every entry.
+ */
+static bool bench_iter_visit(void *entry, void *context)
+{
+	uint64_t word = 0;
+
+	memcpy(&word, entry, sizeof(word));
+	*(uint64_t *)context += word;
+
+	return true;
+}
+
+/**
+ *	@brief Drains a large common FIFO buffer of structs with fifo_common_pop() and in place with
+ *	fifo_common_foreach(), without and with prefetch. The batch field holds the prefetch distance.
+ */
+static void bench_iter_common(void)
+{
+	static uint8_t storage[(size_t)BENCH_ITER_CAPACITY * BENCH_ITER_ENTRY_SIZE];
+	static const fifo_size_t distances[] = {0, FIFO_PREFETCH_DISTANCE};
+	uint8_t val[BENCH_ITER_ENTRY_SIZE];
+	fifo_common_TD fifo;
+	uint32_t rounds = ((bench_rounds / 200) + 1);
+	uint64_t pop_ns = 0;
+	uint64_t iter_ns[2] = {0, 0};
+	uint64_t start = 0;
+	uint64_t sum = 0;
+	uint64_t word = 0;
+	uint32_t r = 0;
+	uint32_t i = 0;
+	size_t d = 0;
+
+	memset(val, 0, sizeof(val));
+	fifo_common_init(&fifo, storage, BENCH_ITER_CAPACITY, BENCH_ITER_ENTRY_SIZE, true);
+
+	for(r = 0; r < rounds; r++)
+	{
+		for(d = 0; d <= 2; d++)
+		{
+			for(i = 0; i < BENCH_ITER_CAPACITY; i++)
+			{
+				memcpy(val, &i, sizeof(i));
+				fifo_common_push(&fifo, val);
+			}
+
+			start = now_ns();
+
+			if(d == 0)
+			{
+				for(i = 0; i < BENCH_ITER_CAPACITY; i++)
+				{
+					fifo_common_pop(&fifo, val);
+					memcpy(&word, val, sizeof(word));
+					sum += word;
+				}
+
+				pop_ns += (now_ns() - start);
+			}
+			else
+			{
+				fifo_common_foreach(&fifo, BENCH_ITER_CAPACITY, distances[d - 1], bench_iter_visit, &sum);
+				iter_ns[d - 1] += (now_ns() - start);
+			}
+		}
+	}
+
+	bench_sink += sum;
+
+	print_result("drain_pop", "fifo", "common128", 1, pop_ns, ((uint64_t)rounds * BENCH_ITER_CAPACITY));
+	for(d = 0; d < 2; d++) print_result("drain_foreach", "fifo", "common128", distances[d], iter_ns[d], ((uint64_t)rounds * BENCH_ITER_CAPACITY));
+}
+
+/**
+* 	@brief	State shared by the producer and consumer threads of the SPSC benchmarks.
+*/
+typedef struct
+{
+	fifo_spsc_uint32_TD fifo;						/**< uint32_t SPSC FIFO buffer of throughput benchmark */
+	fifo_spsc_common_TD stamps;						/**< uint64_t SPSC FIFO buffer of latency benchmark */
+	fifo_size_t batch;								/**< Batch size of throughput benchmark */
+	uint64_t *latency;								/**< Latency samples, filled by the consumer */
+	int errors;										/**< Sequence errors seen by the consumer */
+
+}bench_spsc_TD;
+
+static uint32_t bench_spsc_storage[BENCH_SPSC_CAPACITY];
+static uint64_t bench_stamp_storage[BENCH_SPSC_CAPACITY];
+
+/**
+ *	@brief Producer of throughput benchmark, pushes sequence numbers in batches.
+ */
+static void *bench_throughput_producer(void *arg)
+{
+	bench_spsc_TD *bench = arg;
+	uint32_t data[512];
+	uint32_t next = 0;
+	fifo_size_t n = 0;
+	fifo_size_t i = 0;
+
+	pin_thread(0);
+
+	while(next < bench_items)
+	{
+		n = bench->batch;
+		if((bench_items - next) < n) n = (fifo_size_t)(bench_items - next);
+
+		for(i = 0; i < n; i++) data[i] = next + i;
+
+		i = 0;
+		while(i < n)
+		{
+			fifo_size_t moved = fifo_spsc_uint32_write_some(&bench->fifo, &data[i], (n - i));
+
+			if(moved == 0) sched_yield();
+			i += moved;
+		}
+
+		next += n;
+	}
+
+	return NULL;
+}
+
+/**
+ *	@brief Consumer of throughput benchmark, checks sequence numbers.
+ */
+static void *bench_throughput_consumer(void *arg)
+{
+	bench_spsc_TD *bench = arg;
+	uint32_t data[512];
+	uint32_t expected = 0;
+	fifo_size_t n = 0;
+	fifo_size_t i = 0;
+
+	pin_thread(1);
+
+	while(expected < bench_items)
+	{
+		n = fifo_spsc_uint32_read_some(&bench->fifo, data, bench->batch);
+
+		if(n == 0) sched_yield();
+
+		for(i = 0; i < n; i++)
+		{
+			if(data[i] != expected) bench->errors++;
+			expected++;
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ *	@brief Runs producer and consumer threads through uint32_t SPSC FIFO buffer for every batch size.
+ */
+static void bench_spsc_throughput(bench_spsc_TD *bench)
+{
+	pthread_t producer;
+	pthread_t consumer;
+	uint64_t start = 0;
+	uint64_t ns = 0;
+	size_t b = 0;
+	int errors = 0;
+
+	for(b = 0; b < (sizeof(bench_batches) / sizeof(bench_batches[0])); b++)
+	{
+		fifo_spsc_uint32_init(&bench->fifo, bench_spsc_storage, BENCH_SPSC_CAPACITY, true);
+		bench->batch = bench_batches[b];
+		errors = bench->errors;
+
+		start = now_ns();
+		pthread_create(&consumer, NULL, bench_throughput_consumer, bench);
+		pthread_create(&producer, NULL, bench_throughput_producer, bench);
+		pthread_join(producer, NULL);
+		pthread_join(consumer, NULL);
+		ns = (now_ns() - start);
+
+		printf("{\"bench\":\"spsc_throughput\",\"impl\":\"spsc\",\"type\":\"uint32\",\"batch\":%lu,\"ops\":%lu,\"ns_per_op\":%.3f,\"mops\":%.3f,\"errors\":%d}\n",
+				(unsigned long)bench->batch, (unsigned long)bench_items, ((double)ns / (double)bench_items),
+				(((double)bench_items * 1000.0) / (double)ns), (bench->errors - errors));
+	}
+}
+
+/**
+* 	@brief	Largest amount of producer/consumer pairs of the sharded FIFO benchmark.
+*/
+#define BENCH_SHARD_MAX_THREADS		8
+
+/**
+* 	@brief	State shared by the threads of the sharded FIFO benchmark.
+*/
+typedef struct
+{
+	fifo_shard_TD fifo;					/**< Sharded FIFO buffer, one shard per producer */
+	uint32_t threads;					/**< Amount of producer/consumer pairs */
+	uint32_t items;						/**< Entries pushed by every producer */
+	_Atomic uint64_t popped;			/**< Entries popped by all consumers */
+	_Atomic uint64_t stolen;			/**< Entries popped from a shard other than the home one */
+	_Atomic uint64_t sink;				/**< Keeps popped values of all consumers alive */
+
+}bench_shard_TD;
+
+static bench_shard_TD bench_shard;
+static fifo_shard_slot_TD bench_shard_slots[BENCH_SHARD_MAX_THREADS];
+static uint32_t bench_shard_storage[BENCH_SHARD_MAX_THREADS * BENCH_SPSC_CAPACITY];
+static const uint32_t bench_shard_threads[] = {1, 2, 4, 8};
+
+/**
+ *	@brief Producer of sharded FIFO benchmark, pushes batches of 64 entries into its own shard.
+ */
+static void *bench_shard_producer(void *arg)
+{
+	uint16_t shard = (uint16_t)(uintptr_t)arg;
+	uint32_t data[64];
+	uint32_t next = 0;
+	fifo_size_t n = 0;
+	fifo_size_t i = 0;
+
+	pin_thread((int)(shard % sysconf(_SC_NPROCESSORS_ONLN)));
+
+	while(next < bench_shard.items)
+	{
+		n = 64;
+		if((bench_shard.items - next) < n) n = (fifo_size_t)(bench_shard.items - next);
+
+		for(i = 0; i < n; i++) data[i] = next + i;
+
+		i = 0;
+		while(i < n)
+		{
+			fifo_size_t moved = fifo_shard_write_some(&bench_shard.fifo, shard, &data[i], (n - i));
+
+			if(moved == 0) sched_yield();
+			i += moved;
+		}
+
+		next += n;
+	}
+
+	return NULL;
+}
+
+/**
+ *	@brief Consumer of sharded FIFO benchmark, pops batches of up to 64 entries from its home shard or steals them.
+ */
+static void *bench_shard_consumer(void *arg)
+{
+	uint16_t home = (uint16_t)(uintptr_t)arg;
+	uint32_t data[64];
+	uint64_t total = ((uint64_t)bench_shard.threads * bench_shard.items);
+	uint64_t sink = 0;
+	uint16_t from = 0;
+	fifo_size_t n = 0;
+
+	pin_thread((int)(home % sysconf(_SC_NPROCESSORS_ONLN)));
+
+	while(atomic_load_explicit(&bench_shard.popped, memory_order_relaxed) < total)
+	{
+		n = fifo_shard_read_some(&bench_shard.fifo, home, data, 64, &from);
+
+		if(n == 0)
+		{
+			sched_yield();
+			continue;
+		}
+
+		sink += data[0];
+		atomic_fetch_add_explicit(&bench_shard.popped, n, memory_order_relaxed);
+		if(from != home) atomic_fetch_add_explicit(&bench_shard.stolen, n, memory_order_relaxed);
+	}
+
+	atomic_fetch_add_explicit(&bench_shard.sink, sink, memory_order_relaxed);
+
+	return NULL;
+}
+
+/**
+ *	@brief Moves bench_items entries through sharded FIFO buffer with 1, 2, 4 and 8 producer/consumer pairs.
+ */
+static void bench_shard_throughput(void)
+{
+	pthread_t producers[BENCH_SHARD_MAX_THREADS];
+	pthread_t consumers[BENCH_SHARD_MAX_THREADS];
+	uint64_t start = 0;
+	uint64_t ns = 0;
+	uint64_t total = 0;
+	uint32_t threads = 0;
+	uint32_t i = 0;
+	size_t t = 0;
+
+	for(t = 0; t < (sizeof(bench_shard_threads) / sizeof(bench_shard_threads[0])); t++)
+	{
+		threads = bench_shard_threads[t];
+
+		fifo_shard_init(&bench_shard.fifo, bench_shard_slots, (uint16_t)threads, bench_shard_storage, BENCH_SPSC_CAPACITY, sizeof(uint32_t), true);
+		bench_shard.threads = threads;
+		bench_shard.items = (bench_items / threads);
+		atomic_store(&bench_shard.popped, 0);
+		atomic_store(&bench_shard.stolen, 0);
+		total = ((uint64_t)threads * bench_shard.items);
+
+		start = now_ns();
+		for(i = 0; i < threads; i++) pthread_create(&consumers[i], NULL, bench_shard_consumer, (void *)(uintptr_t)i);
+		for(i = 0; i < threads; i++) pthread_create(&producers[i], NULL, bench_shard_producer, (void *)(uintptr_t)i);
+		for(i = 0; i < threads; i++) pthread_join(producers[i], NULL);
+		for(i = 0; i < threads; i++) pthread_join(consumers[i], NULL);
+		ns = (now_ns() - start);
+		bench_sink += atomic_load(&bench_shard.sink);
+
+		printf("{\"bench\":\"shard_throughput\",\"impl\":\"shard\",\"type\":\"uint32\",\"threads\":%lu,\"ops\":%llu,\"ns_per_op\":%.3f,\"mops\":%.3f,\"stolen\":%llu}\n",
+				(unsigned long)threads, (unsigned long long)total, ((double)ns / (double)total),
+				(((double)total * 1000.0) / (double)ns), (unsigned long long)atomic_load(&bench_shard.stolen));
+	}
+}
+
+/**
+ *	@brief Producer of latency benchmark, pushes one timestamp and waits until it is taken.
+ */
+static void *bench_latency_producer(void *arg)
+{
+	bench_spsc_TD *bench = arg;
+	uint64_t stamp = 0;
+	uint32_t i = 0;
+
+	pin_thread(0);
+
+	for(i = 0; i < bench_samples; i++)
+	{
+		stamp = now_ns();
+		while(fifo_spsc_common_push(&bench->stamps, &stamp) != 0) sched_yield();
+		while(fifo_spsc_ring_count(&bench->stamps.ring) != 0) sched_yield();
+	}
+
+	return NULL;
+}
+
+/**
+ *	@brief Consumer of latency benchmark, stores time from push to pop of every timestamp.
+ */
+static void *bench_latency_consumer(void *arg)
+{
+	bench_spsc_TD *bench = arg;
+	uint64_t stamp = 0;
+	uint32_t i = 0;
+
+	pin_thread(1);
+
+	for(i = 0; i < bench_samples; i++)
+	{
+		while(fifo_spsc_common_pop(&bench->stamps, &stamp) != 0) sched_yield();
+		bench->latency[i] = (now_ns() - stamp);
+	}
+
+	return NULL;
+}
+
+/**
+ *	@brief Compares two latency samples for qsort.
+ */
+static int compare_u64(const void *a, const void *b)
+{
+	uint64_t x = *(const uint64_t *)a;
+	uint64_t y = *(const uint64_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+/**
+ *	@brief Measures push to pop handoff latency between two threads and prints p50/p99/p999.
+ */
+static void bench_spsc_latency(bench_spsc_TD *bench)
+{
+	pthread_t producer;
+	pthread_t consumer;
+
+	bench->latency = calloc(bench_samples, sizeof(uint64_t));
+	if(bench->latency == NULL) return; /* no memory */
+
+	fifo_spsc_common_init(&bench->stamps, bench_stamp_storage, BENCH_SPSC_CAPACITY, sizeof(uint64_t), true);
+
+	pthread_create(&consumer, NULL, bench_latency_consumer, bench);
+	pthread_create(&producer, NULL, bench_latency_producer, bench);
+	pthread_join(producer, NULL);
+	pthread_join(consumer, NULL);
+
+	qsort(bench->latency, bench_samples, sizeof(uint64_t), compare_u64);
+
+	printf("{\"bench\":\"spsc_latency\",\"impl\":\"spsc\",\"type\":\"uint64\",\"samples\":%lu,\"p50_ns\":%llu,\"p99_ns\":%llu,\"p999_ns\":%llu,\"max_ns\":%llu}\n",
+			(unsigned long)bench_samples,
+			(unsigned long long)bench->latency[(bench_samples * 50u) / 100u],
+			(unsigned long long)bench->latency[(bench_samples * 99u) / 100u],
+			(unsigned long long)bench->latency[(bench_samples * 999u) / 1000u],
+			(unsigned long long)bench->latency[bench_samples - 1]);
+
+	free(bench->latency);
+	bench->latency = NULL;
+}
+
+int main(int argc, char **argv)
+{
+	static bench_spsc_TD bench;
+
+	if((argc > 1) && (strcmp(argv[1], "--quick") == 0))
+	{
+		bench_rounds = 200;
+		bench_items = 200000;
+		bench_samples = 2000;
+	}
+
+	printf("{\"config\":{\"fifo_size_bits\":%d,\"spsc_cache_aligned\":%d,\"cpus\":%ld}}\n",
+			FIFO_SIZE_BITS, FIFO_SPSC_CACHE_ALIGNED, sysconf(_SC_NPROCESSORS_ONLN));
+
+	bench_single_fifo_uint8();
+	bench_single_fifo_uint16();
+	bench_single_fifo_uint32();
+	bench_single_fifo_common32();
+	bench_single_fast_uint8();
+	bench_single_fast_uint16();
+	bench_single_fast_uint32();
+	bench_single_pow2_uint8();
+	bench_single_pow2_uint16();
+	bench_single_pow2_uint32();
+	bench_single_pow2_common32();
+	bench_single_spsc_uint8();
+	bench_single_spsc_uint16();
+	bench_single_spsc_uint32();
+	bench_single_spsc_common32();
+
+	bench_mul_fifo_uint8();
+	bench_mul_fifo_uint16();
+	bench_mul_fifo_uint32();
+	bench_mul_fast_uint8();
+	bench_mul_fast_uint16();
+	bench_mul_fast_uint32();
+	bench_mul_pow2_uint8();
+	bench_mul_pow2_uint16();
+	bench_mul_pow2_uint32();
+	bench_mul_pow2_common32();
+	bench_mul_spsc_uint8();
+	bench_mul_spsc_uint16();
+	bench_mul_spsc_uint32();
+	bench_mul_spsc_common32();
+
+	bench_iter_common();
+
+	bench_spsc_throughput(&bench);
+	bench_shard_throughput();
+	bench_spsc_latency(&bench);
+
+	return (bench.errors == 0) ? 0 : 1;
+}
@@ -10,6 +10,7 @@
  */
 
 #include "fifo.h"
+#include "fifo_simd.h"
 
 /**
 *	@addtogroup Software_FIFO_buffer Software FIFO buffers
@@ -21,406 +22,426 @@
 * 	@{
 */
 
-/**
- * 	@brief Clears uint8_t FIFO buffer.
- *
- * 	@param fifo - pointer to the FIFO buffer
- *
- * 	@retval returns: 0 - FIFO buffer cleared successfully
- * 					-1 - fifo pointer is NULL
- *
- */
-int fifo_uint8_clear(fifo_uint8_TD *fifo)
-{
-	if(fifo == NULL) return -1; /* fifo pointer NULL */
-	
-	memset(fifo->buffer, 0, fifo->max_size);
-	fifo->head_ptr = fifo->buffer;
-	fifo->tail_ptr = fifo->buffer;
-	fifo->free_size = fifo->max_size;
-	
-	return 0;
-}
+FIFO_TEMPLATE_FUNCTIONS(uint8, uint8_t, )
 
 /**
- *	@brief Pops head value from uint8_t FIFO buffer.
+ *	@brief Pops m uint8_t entries from FIFO buffer and widens them to uint16_t while copying.
  *
  *	@param fifo - pointer to the FIFO buffer
- *	@param val - pointer to value store variable
- *
- *	@retval returns: 0 - head popped successfully
- *					-1 - fifo pointer is NULL
- *					-2 - val pointer is NULL
- *					-3 - FIFO buffer empty
- */
-int fifo_uint8_pop(fifo_uint8_TD *fifo, uint8_t *val)
-{
-	if(fifo == NULL) return -1; /* fifo pointer NULL */
-	if(val == NULL) return -2;  /* val pointer NULL */
-	if(fifo->free_size == fifo->max_size) return -3; /* fifo empty */
-	
-	*val = *fifo->head_ptr;
-	fifo->head_ptr++;
-	fifo->free_size++;
-	
-	if(fifo->head_ptr >= fifo->limit_ptr) fifo->head_ptr = fifo->buffer;
-	
-	return 0;
-}
-
-/**
- *	@brief Pops m uint8_t entries from FIFO buffer.
- *
- *	@param fifo - pointer to the FIFO buffer
- *	@param pop_buffer - pointer to the buffer into which the values will be popped
+ *	@param pop_buffer - pointer to the uint16_t buffer into which the values will be popped
  *	@param m - amount of entries to be popped
  *
  *	@retval returns:	0 - all of the m entries was popped
  *					-1 - fifo pointer is NULL
  *					-2 - pop buffer pointer is NULL
  *					-3 - amount of the entries to be popped is zero
- *					-4 - FIFO buffer max size lower than m
+ *					-4 - FIFO buffer current size lower than m
  *
  */
-int fifo_uint8_pop_mul(fifo_uint8_TD *fifo, uint8_t *pop_buffer, uint16_t m)
+int fifo_uint8_pop_mul_convert_u16(fifo_uint8_TD *fifo, uint16_t *pop_buffer, fifo_size_t m)
 {
-	uint8_t* limit = NULL;
-	
+	uint64_t start = FIFO_STATS_START();
+	fifo_size_t first = 0;
+	fifo_size_t n = m;
+
 	if(fifo == NULL) return -1; /* fifo pointer NULL */
 	if(pop_buffer == NULL) return -2; /* pop buffer pointer NULL */
 	if(m == 0) return -3; /* zero m */
-	if(m > (fifo->max_size - fifo->free_size)) return -4; /* current size lower than m */
+	if(m > (fifo->max_size - fifo->free_size)) return FIFO_STATS_POP_REJECT(&fifo->stats, -4); /* current size lower than m */
 
 	fifo->free_size += m;
 
-	limit = (fifo->head_ptr + m);
+	first = (fifo_size_t)(fifo->limit_ptr - fifo->head_ptr);
 
-	if(limit >= fifo->limit_ptr)
+	if(m >= first)
 	{
-		memcpy(pop_buffer, fifo->head_ptr, (size_t)(fifo->limit_ptr - fifo->head_ptr));
-		pop_buffer += (fifo->limit_ptr - fifo->head_ptr);
-		m -= (fifo->limit_ptr - fifo->head_ptr);
+		fifo_simd_u8_to_u16(pop_buffer, fifo->head_ptr, first);
+		pop_buffer += first;
+		m -= first;
 		fifo->head_ptr = fifo->buffer;
 	}
 
-	memcpy(pop_buffer, fifo->head_ptr, m);
+	fifo_simd_u8_to_u16(pop_buffer, fifo->head_ptr, m);
 	fifo->head_ptr += m;
 
+	FIFO_STATS_POP(&fifo->stats, n, start);
+
 	return 0;
 }
 
 /**
- *	@brief Pushes uint8_t value into FIFO buffer.
- *
- *	@param fifo - pointer to the FIFO buffer
- *	@param val - value to push
- *
- *	@retval returns: 0 - head pushed successfully
- *					-1 - fifo pointer is NULL
- *					-2 - FIFO buffer full
- */
-int fifo_uint8_push(fifo_uint8_TD *fifo, uint8_t val)
-{
-	if(fifo == NULL) return -1; /* fifo pointer NULL */
-	if(fifo->free_size == 0) return -2; /* fifo full */
-	
-	*fifo->tail_ptr = val;
-	fifo->tail_ptr++;
-	fifo->free_size--;
-	
-	if(fifo->tail_ptr  >= fifo->limit_ptr) fifo->tail_ptr = fifo->buffer;
-	
-	return 0;
-}
+* 	@}
+*/
+
+/**
+*	@addtogroup uint16_t_FIFO_buffer uint16_t FIFO buffer
+* 	@{
+*/
+
+FIFO_TEMPLATE_FUNCTIONS(uint16, uint16_t, )
 
 /**
- *	@brief Pushes m uint8_t entries into FIFO buffer.
+ *	@brief Pops m uint16_t entries from FIFO buffer and widens them to int32_t while copying.
  *
  *	@param fifo - pointer to the FIFO buffer
- *	@param push_buffer - pointer to the buffer from which the values will be pushed
- *	@param m - amount of entries to be pushed
+ *	@param pop_buffer - pointer to the int32_t buffer into which the values will be popped
+ *	@param m - amount of entries to be popped
  *
- *	@retval returns:	0 - all of the m entries was pushed
+ *	@retval returns:	0 - all of the m entries was popped
  *					-1 - fifo pointer is NULL
- *					-2 - push buffer pointer is NULL
- *					-3 - amount of the entries to be pushed is zero
- *					-4 - no place for m element in FIFO buffer
+ *					-2 - pop buffer pointer is NULL
+ *					-3 - amount of the entries to be popped is zero
+ *					-4 - FIFO buffer current size lower than m
  *
  */
-int fifo_uint8_push_mul(fifo_uint8_TD *fifo, uint8_t *push_buffer, uint16_t m)
+int fifo_uint16_pop_mul_convert_i32(fifo_uint16_TD *fifo, int32_t *pop_buffer, fifo_size_t m)
 {
-	uint8_t* limit = NULL;
+	uint64_t start = FIFO_STATS_START();
+	fifo_size_t first = 0;
+	fifo_size_t n = m;
 
 	if(fifo == NULL) return -1; /* fifo pointer NULL */
-	if(push_buffer == NULL) return -2; /* push buffer pointer NULL */
+	if(pop_buffer == NULL) return -2; /* pop buffer pointer NULL */
 	if(m == 0) return -3; /* zero m */
-	if(m > fifo->free_size) return -4; /* no place for m elements in FIFO */
+	if(m > (fifo->max_size - fifo->free_size)) return FIFO_STATS_POP_REJECT(&fifo->stats, -4); /* current size lower than m */
 
-	fifo->free_size -= m;
+	fifo->free_size += m;
 
-	limit = (fifo->tail_ptr + m);
+	first = (fifo_size_t)(fifo->limit_ptr - fifo->head_ptr);
 
-	if(limit >= fifo->limit_ptr)
+	if(m >= first)
 	{
-		memcpy(fifo->tail_ptr, push_buffer, (size_t)(fifo->limit_ptr - fifo->tail_ptr));
-		push_buffer +=  (fifo->limit_ptr - fifo->tail_ptr);
-		m -=  (fifo->limit_ptr - fifo->tail_ptr);
-		fifo->tail_ptr = fifo->buffer;
+		fifo_simd_u16_to_i32(pop_buffer, fifo->head_ptr, first);
+		pop_buffer += first;
+		m -= first;
+		fifo->head_ptr = fifo->buffer;
 	}
 
-	memcpy(fifo->tail_ptr, push_buffer, m);
-	fifo->tail_ptr += m;
+	fifo_simd_u16_to_i32(pop_buffer, fifo->head_ptr, m);
+	fifo->head_ptr += m;
+
+	FIFO_STATS_POP(&fifo->stats, n, start);
 
 	return 0;
 }
 
 /**
- *	@brief Creates uint8_t FIFO buffer.
+ *	@brief Pops m uint16_t entries from FIFO buffer and converts them to float while copying.
  *
  *	@param fifo - pointer to the FIFO buffer
- *	@param buffer - pointer to buffer that stores values
- *	@param size - size of FIFO buffer
- *	@param clear_flag - specifies whether the buffer need to be cleared
+ *	@param pop_buffer - pointer to the float buffer into which the values will be popped
+ *	@param m - amount of entries to be popped
  *
- *	@retval returns: 0 - uint8_t FIFO buffer created successfully
+ *	@retval returns:	0 - all of the m entries was popped
  *					-1 - fifo pointer is NULL
- *					-2 - buffer pointer is NULL
- *					-3 - size of FIFO buffer is 0
+ *					-2 - pop buffer pointer is NULL
+ *					-3 - amount of the entries to be popped is zero
+ *					-4 - FIFO buffer current size lower than m
+ *
  */
-int fifo_uint8_init(fifo_uint8_TD *fifo, uint8_t *buffer, uint16_t size, bool clear_flag)
+int fifo_uint16_pop_mul_convert_f32(fifo_uint16_TD *fifo, float *pop_buffer, fifo_size_t m)
 {
+	uint64_t start = FIFO_STATS_START();
+	fifo_size_t first = 0;
+	fifo_size_t n = m;
+
 	if(fifo == NULL) return -1; /* fifo pointer NULL */
-	if(buffer == NULL) return -2; /* buffer pointer NULL */
-	if(size == 0) return -3; /* zero size */
+	if(pop_buffer == NULL) return -2; /* pop buffer pointer NULL */
+	if(m == 0) return -3; /* zero m */
+	if(m > (fifo->max_size - fifo->free_size)) return FIFO_STATS_POP_REJECT(&fifo->stats, -4); /* current size lower than m */
 
-	fifo->buffer = buffer;
-	fifo->head_ptr = buffer;
-	fifo->tail_ptr = buffer;
-	fifo->limit_ptr = (buffer + size);
-	fifo->max_size = size;
-	fifo->free_size = size;
+	fifo->free_size += m;
+
+	first = (fifo_size_t)(fifo->limit_ptr - fifo->head_ptr);
+
+	if(m >= first)
+	{
+		fifo_simd_u16_to_f32(pop_buffer, fifo->head_ptr, first);
+		pop_buffer += first;
+		m -= first;
+		fifo->head_ptr = fifo->buffer;
+	}
+
+	fifo_simd_u16_to_f32(pop_buffer, fifo->head_ptr, m);
+	fifo->head_ptr += m;
 
-	if(clear_flag == true) memset(buffer, 0, size);
+	FIFO_STATS_POP(&fifo->stats, n, start);
 
 	return 0;
 }
 
 /**
-* 	@}
-*/
+ *	@brief Gives position k entries after pos in uint16_t FIFO buffer, wrapped at the buffer end.
+ */
+static inline uint16_t *fifo_uint16_wrap(const fifo_uint16_TD *fifo, uint16_t *pos, size_t k)
+{
+	size_t offset = (size_t)(pos - fifo->buffer) + k;
 
-/**
-*	@addtogroup uint16_t_FIFO_buffer uint16_t FIFO buffer
-* 	@{
-*/
+	if(offset >= fifo->max_size) offset -= fifo->max_size;
+
+	return (fifo->buffer + offset);
+}
 
 /**
- * 	@brief Clears uint16_t FIFO buffer.
- *
- * 	@param fifo - pointer to the FIFO buffer
- *
- * 	@retval returns: 0 - FIFO buffer cleared successfully
- * 					-1 - fifo pointer is NULL
- *
+ *	@brief Sums n stored entries of uint16_t FIFO buffer starting at pos, over the one or two spans.
  */
-int fifo_uint16_clear(fifo_uint16_TD *fifo)
+static inline uint64_t fifo_uint16_span_sum(const fifo_uint16_TD *fifo, const uint16_t *pos, size_t n)
 {
-	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	size_t first = (size_t)(fifo->limit_ptr - pos);
 
-	memset(fifo->buffer, 0, fifo->max_size);
-	fifo->head_ptr = fifo->buffer;
-	fifo->tail_ptr = fifo->buffer;
-	fifo->free_size = fifo->max_size;
+	if(n <= first) return fifo_simd_u16_sum(pos, n);
 
-	return 0;
+	return (fifo_simd_u16_sum(pos, first) + fifo_simd_u16_sum(fifo->buffer, (n - first)));
 }
 
 /**
- *	@brief Pops head value from uint16_t FIFO buffer.
+ *	@brief Pops m uint16_t entries from FIFO buffer and gives their sum, entries are not copied out.
  *
  *	@param fifo - pointer to the FIFO buffer
- *	@param val - pointer to value store variable
+ *	@param m - amount of entries to be popped
+ *	@param sum - pointer to store the sum
  *
- *	@retval returns: 0 - head popped successfully
+ *	@retval returns:	0 - all of the m entries was popped
  *					-1 - fifo pointer is NULL
- *					-2 - val pointer is NULL
- *					-3 - FIFO buffer empty
+ *					-2 - sum pointer is NULL
+ *					-3 - amount of the entries to be popped is zero
+ *					-4 - FIFO buffer current size lower than m
  */
-int fifo_uint16_pop(fifo_uint16_TD *fifo, uint16_t *val)
+int fifo_uint16_pop_sum(fifo_uint16_TD *fifo, fifo_size_t m, uint64_t *sum)
 {
+	uint64_t start = FIFO_STATS_START();
+
 	if(fifo == NULL) return -1; /* fifo pointer NULL */
-	if(val == NULL) return -2;
-	if(fifo->free_size == fifo->max_size) return -3; /* fifo empty */
+	if(sum == NULL) return -2; /* sum pointer NULL */
+	if(m == 0) return -3; /* zero m */
+	if(m > (fifo->max_size - fifo->free_size)) return FIFO_STATS_POP_REJECT(&fifo->stats, -4); /* current size lower than m */
 
-	*val = *fifo->head_ptr;
-	fifo->head_ptr++;
-	fifo->free_size++;
+	*sum = fifo_uint16_span_sum(fifo, fifo->head_ptr, m);
 
-	if(fifo->head_ptr >= fifo->limit_ptr) fifo->head_ptr = fifo->buffer;
+	fifo->head_ptr = fifo_uint16_wrap(fifo, fifo->head_ptr, m);
+	fifo->free_size += m;
+
+	FIFO_STATS_POP(&fifo->stats, m, start);
 
 	return 0;
 }
 
 /**
- *	@brief Pops m uint16_t entries from FIFO buffer.
+ *	@brief Pops m uint16_t entries from FIFO buffer and gives their minimum and maximum, entries are not copied out.
  *
  *	@param fifo - pointer to the FIFO buffer
- *	@param pop_buffer - pointer to the buffer into which the values will be popped
  *	@param m - amount of entries to be popped
+ *	@param min - pointer to store the minimum
+ *	@param max - pointer to store the maximum
  *
  *	@retval returns:	0 - all of the m entries was popped
  *					-1 - fifo pointer is NULL
- *					-2 - pop buffer pointer is NULL
+ *					-2 - min or max pointer is NULL
  *					-3 - amount of the entries to be popped is zero
- *					-4 - FIFO buffer max size lower than m
- *
+ *					-4 - FIFO buffer current size lower than m
  */
-int fifo_uint16_pop_mul(fifo_uint16_TD *fifo, uint16_t *pop_buffer, uint16_t m)
+int fifo_uint16_pop_minmax(fifo_uint16_TD *fifo, fifo_size_t m, uint16_t *min, uint16_t *max)
 {
-	uint16_t* limit = NULL;
-	
+	uint64_t start = FIFO_STATS_START();
+	fifo_size_t first = 0;
+
 	if(fifo == NULL) return -1; /* fifo pointer NULL */
-	if(pop_buffer == NULL) return -2; /* pop buffer pointer NULL */
+	if((min == NULL) || (max == NULL)) return -2; /* min/max pointer NULL */
 	if(m == 0) return -3; /* zero m */
-	if(m > fifo->max_size) return -4; /* max size lower than m */
+	if(m > (fifo->max_size - fifo->free_size)) return FIFO_STATS_POP_REJECT(&fifo->stats, -4); /* current size lower than m */
 
-	fifo->free_size += m;
+	*min = UINT16_MAX;
+	*max = 0;
 
-	limit = (fifo->head_ptr + m);
+	first = (fifo_size_t)(fifo->limit_ptr - fifo->head_ptr);
 
-	if(limit >= fifo->limit_ptr)
+	if(m <= first)
 	{
-		memcpy(pop_buffer, fifo->head_ptr, (size_t)(fifo->limit_ptr - fifo->head_ptr));
-		pop_buffer += ((fifo->limit_ptr - fifo->head_ptr) / 2);
-		m -= ((fifo->limit_ptr - fifo->head_ptr) / 2);
-		fifo->head_ptr = fifo->buffer;
+		fifo_simd_u16_minmax(fifo->head_ptr, m, min, max);
+	}
+	else
+	{
+		fifo_simd_u16_minmax(fifo->head_ptr, first, min, max);
+		fifo_simd_u16_minmax(fifo->buffer, (m - first), min, max);
 	}
 
-	memcpy(pop_buffer, fifo->head_ptr, (m * 2));
-	fifo->head_ptr += m;
+	fifo->head_ptr = fifo_uint16_wrap(fifo, fifo->head_ptr, m);
+	fifo->free_size += m;
+
+	FIFO_STATS_POP(&fifo->stats, m, start);
 
 	return 0;
 }
 
 /**
- *	@brief Pushes uint16_t value into FIFO buffer.
+ *	@brief Pops m * factor uint16_t entries from FIFO buffer and stores the rounded mean of each run of factor entries.
  *
  *	@param fifo - pointer to the FIFO buffer
- *	@param val - value to push
+ *	@param pop_buffer - pointer to the buffer into which the m means will be stored
+ *	@param m - amount of means to be stored
+ *	@param factor - decimation factor, entries per mean
  *
- *	@retval returns: 0 - head pushed successfully
+ *	@retval returns:	0 - all of the m * factor entries was popped
  *					-1 - fifo pointer is NULL
- *					-2 - FIFO buffer full
+ *					-2 - pop buffer pointer is NULL
+ *					-3 - m or factor is zero
+ *					-4 - FIFO buffer current size lower than m * factor
  */
-int fifo_uint16_push(fifo_uint16_TD *fifo, uint16_t val)
+int fifo_uint16_pop_decimate(fifo_uint16_TD *fifo, uint16_t *pop_buffer, fifo_size_t m, uint16_t factor)
 {
+	uint64_t start = FIFO_STATS_START();
+	uint16_t *pos = NULL;
+	size_t total = ((size_t)m * factor);
+	fifo_size_t i = 0;
+
 	if(fifo == NULL) return -1; /* fifo pointer NULL */
-	if(fifo->free_size == 0) return -2; /* fifo full */
+	if(pop_buffer == NULL) return -2; /* pop buffer pointer NULL */
+	if((m == 0) || (factor == 0)) return -3; /* zero m or factor */
+	if(total > (size_t)(fifo->max_size - fifo->free_size)) return FIFO_STATS_POP_REJECT(&fifo->stats, -4); /* current size lower than m * factor */
 
-	*fifo->tail_ptr = val;
-	fifo->tail_ptr++;
-	fifo->free_size--;
+	pos = fifo->head_ptr;
 
-	if(fifo->tail_ptr >= fifo->limit_ptr) fifo->tail_ptr = fifo->buffer;
+	for(i = 0; i < m; i++)
+	{
+		pop_buffer[i] = (uint16_t)((fifo_uint16_span_sum(fifo, pos, factor) + (factor / 2)) / factor);
+		pos = fifo_uint16_wrap(fifo, pos, factor);
+	}
+
+	fifo->head_ptr = pos;
+	fifo->free_size += (fifo_size_t)total;
+
+	FIFO_STATS_POP(&fifo->stats, total, start);
 
 	return 0;
 }
 
 /**
- *	@brief Pushes m uint16_t entries into FIFO buffer.
+ *	@brief Pops m uint16_t entries from FIFO buffer and stores the rounded moving average of window entries starting at each.
+ *	The window - 1 entries after the popped ones stay in FIFO buffer as history of the next call, so a stream
+ *	is averaged without gaps by pushing samples and popping whatever exceeds window - 1. The window sum is
+ *	computed once per call and then slid by one add and one subtract per output.
  *
  *	@param fifo - pointer to the FIFO buffer
- *	@param push_buffer - pointer to the buffer from which the values will be pushed
- *	@param m - amount of entries to be pushed
+ *	@param pop_buffer - pointer to the buffer into which the m averages will be stored
+ *	@param m - amount of entries to be popped and averages to be stored
+ *	@param window - length of the moving average window in entries
  *
- *	@retval returns:	0 - all of the m entries was pushed
+ *	@retval returns:	0 - all of the m entries was popped
  *					-1 - fifo pointer is NULL
- *					-2 - push buffer pointer is NULL
- *					-3 - amount of the entries to be pushed is zero
- *					-4 - no place for m element in FIFO buffer
- *
+ *					-2 - pop buffer pointer is NULL
+ *					-3 - m or window is zero
+ *					-4 - FIFO buffer current size lower than m + window - 1
  */
-int fifo_uint16_push_mul(fifo_uint16_TD *fifo, uint16_t *push_buffer, uint16_t m)
+int fifo_uint16_pop_mavg(fifo_uint16_TD *fifo, uint16_t *pop_buffer, fifo_size_t m, fifo_size_t window)
 {
-	uint16_t* limit = NULL;
+	uint64_t start = FIFO_STATS_START();
+	uint16_t *first = NULL;
+	uint16_t *last = NULL;
+	uint64_t sum = 0;
+	fifo_size_t i = 0;
 
 	if(fifo == NULL) return -1; /* fifo pointer NULL */
-	if(push_buffer == NULL) return -2; /* push buffer pointer NULL */
-	if(m == 0) return -3; /* zero m */
-	if(m > fifo->free_size) return -4; /* no place for m elements in FIFO */
+	if(pop_buffer == NULL) return -2; /* pop buffer pointer NULL */
+	if((m == 0) || (window == 0)) return -3; /* zero m or window */
+	if(((size_t)m + window - 1) > (size_t)(fifo->max_size - fifo->free_size)) return FIFO_STATS_POP_REJECT(&fifo->stats, -4); /* current size lower than m + window - 1 */
 
-	fifo->free_size -= m;
+	first = fifo->head_ptr;
+	last = fifo_uint16_wrap(fifo, first, (window - 1));
+	sum = fifo_uint16_span_sum(fifo, first, window);
 
-	limit = (fifo->tail_ptr + m);
+	pop_buffer[0] = (uint16_t)((sum + (window / 2)) / window);
 
-	if(limit >= fifo->limit_ptr)
+	for(i = 1; i < m; i++)
 	{
-		memcpy(fifo->tail_ptr, push_buffer, (size_t)(fifo->limit_ptr - fifo->tail_ptr));
-		push_buffer +=  ((fifo->limit_ptr - fifo->tail_ptr) / 2);
-		m -=  ((fifo->limit_ptr - fifo->tail_ptr) / 2);
-		fifo->tail_ptr = fifo->buffer;
+		last = fifo_uint16_wrap(fifo, last, 1);
+		sum += *last;
+		sum -= *first;
+		first = fifo_uint16_wrap(fifo, first, 1);
+
+		pop_buffer[i] = (uint16_t)((sum + (window / 2)) / window);
 	}
 
-	memcpy(fifo->tail_ptr, push_buffer, (m * 2));
-	fifo->tail_ptr += m;
+	fifo->head_ptr = fifo_uint16_wrap(fifo, first, 1);
+	fifo->free_size += m;
+
+	FIFO_STATS_POP(&fifo->stats, m, start);
 
 	return 0;
 }
 
 /**
- *	@brief Creates uint16_t FIFO buffer.
- *
- *	@param fifo - pointer to the FIFO buffer
- *	@param buffer - pointer to buffer that stores values
- *	@param size - size of FIFO buffer
- *	@param clear_flag - specifies whether the buffer need to be cleared
- *
- *	@retval returns: 0 - uint16_t FIFO buffer created successfully
- *					-1 - fifo pointer is NULL
- *					-2 - buffer pointer is NULL
- *					-3 - size of FIFO buffer is 0
- */
-int fifo_uint16_init(fifo_uint16_TD *fifo, uint16_t *buffer, uint16_t size, bool clear_flag)
-{
-	if(fifo == NULL) return -1; /* fifo pointer NULL */
-	if(buffer == NULL) return -2; /* buffer pointer NULL */
-	if(size == 0) return -3; /* zero size */
-
-	fifo->buffer = buffer;
-	fifo->head_ptr = buffer;
-	fifo->tail_ptr = buffer;
-	fifo->limit_ptr = (buffer + size);
-	fifo->max_size = size;
-	fifo->free_size = size;
+* 	@}
+*/
 
-	if(clear_flag == true) memset(buffer, 0, size);
+/**
+*	@addtogroup uint32_t_FIFO_buffer uint32_t FIFO buffer
+* 	@{
+*/
 
-	return 0;
-}
+FIFO_TEMPLATE_FUNCTIONS(uint32, uint32_t, )
 
 /**
 * 	@}
 */
 
 /**
-*	@addtogroup uint32_t_FIFO_buffer uint32_t FIFO buffer
+*	@addtogroup common_FIFO_buffer common FIFO buffer
 * 	@{
 */
 
 /**
- * 	@brief Clears uint32_t FIFO buffer.
+ *	@brief Copies bytes out of common FIFO buffer starting at pos, split once at the buffer end. Returns position after the copied bytes.
+ */
+static inline uint8_t *fifo_common_gather(const fifo_common_TD *fifo, uint8_t *pos, uint8_t *dst, size_t bytes)
+{
+	size_t first = (size_t)((uint8_t *)fifo->limit_ptr - pos);
+
+	if(bytes >= first)
+	{
+		fifo_simd_copy(dst, pos, first);
+		dst += first;
+		bytes -= first;
+		pos = fifo->buffer;
+	}
+
+	fifo_simd_copy(dst, pos, bytes);
+
+	return (pos + bytes);
+}
+
+/**
+ *	@brief Copies bytes into common FIFO buffer starting at pos, split once at the buffer end. Returns position after the copied bytes.
+ */
+static inline uint8_t *fifo_common_scatter(const fifo_common_TD *fifo, uint8_t *pos, const uint8_t *src, size_t bytes)
+{
+	size_t first = (size_t)((uint8_t *)fifo->limit_ptr - pos);
+
+	if(bytes >= first)
+	{
+		fifo_simd_copy(pos, src, first);
+		src += first;
+		bytes -= first;
+		pos = fifo->buffer;
+	}
+
+	fifo_simd_copy(pos, src, bytes);
+
+	return (pos + bytes);
+}
+
+/**
+ * 	@brief Empties common FIFO buffer in O(1), only head and tail are rewound.
  *
  * 	@param fifo - pointer to the FIFO buffer
  *
- * 	@retval returns: 0 - FIFO buffer cleared successfully
+ * 	@retval returns: 0 - FIFO buffer reset successfully
  * 					-1 - fifo pointer is NULL
  *
  */
-int fifo_uint32_clear(fifo_uint32_TD *fifo)
+int fifo_common_reset(fifo_common_TD *fifo)
 {
 	if(fifo == NULL) return -1; /* fifo pointer NULL */
 
-	memset(fifo->buffer, 0, fifo->max_size);
 	fifo->head_ptr = fifo->buffer;
 	fifo->tail_ptr = fifo->buffer;
 	fifo->free_size = fifo->max_size;
@@ -429,33 +450,55 @@ int fifo_uint32_clear(fifo_uint32_TD *fifo)
 }
 
 /**
- *	@brief Pops head value from uint32_t FIFO buffer.
+ * 	@brief Clears common FIFO buffer, buffer contents are wiped as selected by FIFO_WIPE_MODE.
+ *
+ * 	@param fifo - pointer to the FIFO buffer
+ *
+ * 	@retval returns: 0 - FIFO buffer cleared successfully
+ * 					-1 - fifo pointer is NULL
+ *
+ */
+int fifo_common_clear(fifo_common_TD *fifo)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+
+	fifo_wipe(fifo->buffer, ((size_t)fifo->max_size * fifo->entry_size));
+
+	return fifo_common_reset(fifo);
+}
+
+/**
+ *	@brief Pops value from common FIFO buffer.
  *
  *	@param fifo - pointer to the FIFO buffer
- *	@param val - pointer to value store variable
+ *	@param val_buffer - pointer to value store buffer
  *
  *	@retval returns: 0 - head popped successfully
  *					-1 - fifo pointer is NULL
- *					-2 - val pointer is NULL
+ *					-2 - value buffer pointer is NULL
  *					-3 - FIFO buffer empty
  */
-int fifo_uint32_pop(fifo_uint32_TD *fifo, uint32_t *val)
+int fifo_common_pop(fifo_common_TD *fifo, void *val_buffer)
 {
+	uint64_t start = FIFO_STATS_START();
+
 	if(fifo == NULL) return -1; /* fifo pointer NULL */
-	if(val == NULL) return -2;
-	if(fifo->free_size == fifo->max_size) return -3; /* fifo empty */
+	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
+	if(fifo->free_size == fifo->max_size) return FIFO_STATS_POP_REJECT(&fifo->stats, -3); /* fifo empty */
 
-	*val = *fifo->head_ptr;
-	fifo->head_ptr++;
+	if(val_buffer != NULL) memcpy(val_buffer, fifo->head_ptr, fifo->entry_size);
+	fifo->head_ptr = (((uint8_t *)fifo->head_ptr) + fifo->entry_size);
 	fifo->free_size++;
 
 	if(fifo->head_ptr >= fifo->limit_ptr) fifo->head_ptr = fifo->buffer;
 
+	FIFO_STATS_POP(&fifo->stats, 1, start);
+
 	return 0;
 }
 
 /**
- *	@brief Pops m uint32_t entries from FIFO buffer.
+ *	@brief Pops m entries from FIFO buffer.
  *
  *	@param fifo - pointer to the FIFO buffer
  *	@param pop_buffer - pointer to the buffer into which the values will be popped
@@ -465,294 +508,391 @@ int fifo_uint32_pop(fifo_uint32_TD *fifo, uint32_t *val)
  *					-1 - fifo pointer is NULL
  *					-2 - pop buffer pointer is NULL
  *					-3 - amount of the entries to be popped is zero
- *					-4 - FIFO buffer max size lower than m
+ *					-4 - FIFO buffer current size lower than m
  *
  */
-int fifo_uint32_pop_mul(fifo_uint32_TD *fifo, uint32_t *pop_buffer, uint16_t m)
+int fifo_common_pop_mul(fifo_common_TD *fifo, void *pop_buffer, fifo_size_t m)
 {
-	uint32_t* limit = NULL;
+	uint64_t start = FIFO_STATS_START();
 
 	if(fifo == NULL) return -1; /* fifo pointer NULL */
 	if(pop_buffer == NULL) return -2; /* pop buffer pointer NULL */
 	if(m == 0) return -3; /* zero m */
-	if(m > fifo->max_size) return -4; /* max size lower than m */
+	if(m > (fifo->max_size - fifo->free_size)) return FIFO_STATS_POP_REJECT(&fifo->stats, -4); /* current size lower than m */
 
 	fifo->free_size += m;
+	fifo->head_ptr = fifo_common_gather(fifo, fifo->head_ptr, pop_buffer, ((size_t)m * fifo->entry_size));
 
-	limit = (fifo->head_ptr + m);
+	FIFO_STATS_POP(&fifo->stats, m, start);
 
-	if(limit >= fifo->limit_ptr)
-	{
-		memcpy(pop_buffer, fifo->head_ptr, (size_t)(fifo->limit_ptr - fifo->head_ptr));
-		pop_buffer += ((fifo->limit_ptr - fifo->head_ptr) / 4);
-		m -= ((fifo->limit_ptr - fifo->head_ptr) / 4);
-		fifo->head_ptr = fifo->buffer;
-	}
+	return 0;
+}
 
-	memcpy(pop_buffer, fifo->head_ptr, (m * 4));
-	fifo->head_ptr += m;
+/**
+ *	@brief Pops as many of m entries as FIFO buffer holds.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param pop_buffer - pointer to the buffer into which the values will be popped
+ *	@param m - maximal amount of entries to be popped
+ *
+ *	@retval returns: amount of entries popped, 0 if FIFO buffer is empty or any pointer is NULL
+ */
+fifo_size_t fifo_common_read_some(fifo_common_TD *fifo, void *pop_buffer, fifo_size_t m)
+{
+	void *region1 = NULL;
+	void *region2 = NULL;
+	fifo_size_t len1 = 0;
+	fifo_size_t len2 = 0;
 
-	return 0;
+	if((fifo == NULL) || (pop_buffer == NULL)) return 0; /* pointer NULL */
+
+	if(m > (fifo->max_size - fifo->free_size)) m = (fifo->max_size - fifo->free_size);
+	if(m == 0) return 0; /* fifo empty */
+
+	fifo_common_peek(fifo, m, &region1, &len1, &region2, &len2);
+
+	memcpy(pop_buffer, region1, ((size_t)len1 * fifo->entry_size));
+	if(len2 != 0) memcpy((((uint8_t *)pop_buffer) + ((size_t)len1 * fifo->entry_size)), region2, ((size_t)len2 * fifo->entry_size));
+
+	fifo_common_release(fifo, m);
+
+	return m;
 }
 
 /**
- *	@brief Pushes uint32_t value into FIFO buffer.
+ *	@brief Pops entries from FIFO buffer into a scatter list as one unit.
+ * 	Checks the size once and moves the head once, pieces are filled in list order.
  *
  *	@param fifo - pointer to the FIFO buffer
- *	@param val - value to push
+ *	@param iov - pointer to the list of pieces, lengths in entries
+ *	@param iov_count - amount of pieces in the list
  *
- *	@retval returns: 0 - head pushed successfully
+ *	@retval returns:	0 - all of the pieces was filled
  *					-1 - fifo pointer is NULL
- *					-2 - FIFO buffer full
+ *					-2 - iovec pointer or pointer of a non-empty piece is NULL
+ *					-3 - total length of the pieces is zero
+ *					-4 - FIFO buffer current size lower than total length
+ *
  */
-int fifo_uint32_push(fifo_uint32_TD *fifo, uint32_t val)
+int fifo_common_popv(fifo_common_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count)
 {
+	fifo_index_t total = 0;
+	fifo_size_t i = 0;
+	uint8_t *head = NULL;
+	uint64_t start = FIFO_STATS_START();
+
 	if(fifo == NULL) return -1; /* fifo pointer NULL */
-	if(fifo->free_size == 0) return -2; /* fifo full */
+	if(iov == NULL) return -2; /* iovec pointer NULL */
 
-	*fifo->tail_ptr = val;
-	fifo->tail_ptr++;
-	fifo->free_size--;
+	total = fifo_iov_total(iov, iov_count);
 
-	if(fifo->tail_ptr  >= fifo->limit_ptr) fifo->tail_ptr = fifo->buffer;
+	if(total == FIFO_INDEX_MAX) return -2; /* piece pointer NULL */
+	if(total == 0) return -3; /* zero total length */
+	if(total > (fifo_index_t)(fifo->max_size - fifo->free_size)) return FIFO_STATS_POP_REJECT(&fifo->stats, -4); /* current size lower than total length */
+
+	head = fifo->head_ptr;
+
+	for(i = 0; i < iov_count; i++) head = fifo_common_gather(fifo, head, iov[i].base, ((size_t)iov[i].len * fifo->entry_size));
+
+	fifo->head_ptr = head;
+	fifo->free_size += (fifo_size_t)total;
+
+	FIFO_STATS_POP(&fifo->stats, total, start);
 
 	return 0;
 }
 
 /**
- *	@brief Pushes m uint32_t entries into FIFO buffer.
+ *	@brief Gives direct access to n entries at the head of FIFO buffer without copying them.
+ *	Entries stay in FIFO buffer until fifo_common_release() is called.
  *
  *	@param fifo - pointer to the FIFO buffer
- *	@param push_buffer - pointer to the buffer from which the values will be pushed
- *	@param m - amount of entries to be pushed
+ *	@param n - amount of entries to be peeked
+ *	@param region1 - pointer to the first contiguous span of entries
+ *	@param len1 - amount of entries in the first span
+ *	@param region2 - pointer to the second span after wraparound, NULL if there is no wraparound
+ *	@param len2 - amount of entries in the second span
  *
- *	@retval returns:	0 - all of the m entries was pushed
+ *	@retval returns:	0 - n entries are available in region1 and region2
  *					-1 - fifo pointer is NULL
- *					-2 - push buffer pointer is NULL
- *					-3 - amount of the entries to be pushed is zero
- *					-4 - no place for m element in FIFO buffer
+ *					-2 - region or length pointer is NULL
+ *					-3 - amount of the entries to be peeked is zero
+ *					-4 - FIFO buffer current size lower than n
  *
  */
-int fifo_uint32_push_mul(fifo_uint32_TD *fifo, uint32_t *push_buffer, uint16_t m)
+int fifo_common_peek(fifo_common_TD *fifo, fifo_size_t n, void **region1, fifo_size_t *len1, void **region2, fifo_size_t *len2)
 {
-	uint32_t* limit = NULL;
+	fifo_size_t first = 0;
 
 	if(fifo == NULL) return -1; /* fifo pointer NULL */
-	if(push_buffer == NULL) return -2; /* push buffer pointer NULL */
-	if(m == 0) return -3; /* zero m */
-	if(m > fifo->free_size) return -4; /* no place for m elements in FIFO */
+	if((region1 == NULL) || (len1 == NULL) || (region2 == NULL) || (len2 == NULL)) return -2; /* region pointer NULL */
+	if(n == 0) return -3; /* zero n */
+	if(n > (fifo->max_size - fifo->free_size)) return FIFO_STATS_POP_REJECT(&fifo->stats, -4); /* current size lower than n */
 
-	fifo->free_size -= m;
+	first = (fifo_size_t)(((uint8_t *)fifo->limit_ptr - (uint8_t *)fifo->head_ptr) / fifo->entry_size);
 
-	limit = (fifo->tail_ptr + m);
+	*region1 = fifo->head_ptr;
 
-	if(limit >= fifo->limit_ptr)
+	if(n <= first)
 	{
-		memcpy(fifo->tail_ptr, push_buffer, (size_t)(fifo->limit_ptr - fifo->tail_ptr));
-		push_buffer +=  ((fifo->limit_ptr - fifo->tail_ptr) / 4);
-		m -=  ((fifo->limit_ptr - fifo->tail_ptr) / 4);
-		fifo->tail_ptr = fifo->buffer;
+		*len1 = n;
+		*region2 = NULL;
+		*len2 = 0;
+	}
+	else
+	{
+		*len1 = first;
+		*region2 = fifo->buffer;
+		*len2 = (n - first);
 	}
-
-	memcpy(fifo->tail_ptr, push_buffer, (m * 4));
-	fifo->tail_ptr += m;
 
 	return 0;
 }
 
 /**
- *	@brief Creates uint32_t FIFO buffer.
+ *	@brief Releases n entries previously accessed with fifo_common_peek().
  *
  *	@param fifo - pointer to the FIFO buffer
- *	@param buffer - pointer to buffer that stores values
- *	@param size - size of FIFO buffer
- *	@param clear_flag - specifies whether the buffer need to be cleared
+ *	@param n - amount of entries to be released
  *
- *	@retval returns: 0 - uint32_t FIFO buffer created successfully
+ *	@retval returns:	0 - n entries released
  *					-1 - fifo pointer is NULL
- *					-2 - buffer pointer is NULL
- *					-3 - size of FIFO buffer is 0
+ *					-3 - amount of the entries to be released is zero
+ *					-4 - FIFO buffer current size lower than n
+ *
  */
-int fifo_uint32_init(fifo_uint32_TD *fifo, uint32_t *buffer, uint16_t size, bool clear_flag)
+int fifo_common_release(fifo_common_TD *fifo, fifo_size_t n)
 {
+	fifo_size_t first = 0;
+
 	if(fifo == NULL) return -1; /* fifo pointer NULL */
-	if(buffer == NULL) return -2; /* buffer pointer NULL */
-	if(size == 0) return -3; /* zero size */
+	if(n == 0) return -3; /* zero n */
+	if(n > (fifo->max_size - fifo->free_size)) return -4; /* current size lower than n */
 
-	fifo->buffer = buffer;
-	fifo->head_ptr = buffer;
-	fifo->tail_ptr = buffer;
-	fifo->limit_ptr = (buffer + size);
-	fifo->max_size = size;
-	fifo->free_size = size;
+	fifo->free_size += n;
+
+	first = (fifo_size_t)(((uint8_t *)fifo->limit_ptr - (uint8_t *)fifo->head_ptr) / fifo->entry_size);
 
-	if(clear_flag == true) memset(buffer, 0, size);
+	if(n >= first) fifo->head_ptr = (((uint8_t *)fifo->buffer) + ((size_t)(n - first) * fifo->entry_size));
+	else fifo->head_ptr = (((uint8_t *)fifo->head_ptr) + ((size_t)n * fifo->entry_size));
+
+	FIFO_STATS_POP(&fifo->stats, n, 0);
 
 	return 0;
 }
 
 /**
-* 	@}
-*/
+ *	@brief Pushes value into common FIFO buffer.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param val_buffer - value buffer to push
+ *
+ *	@retval returns: 0 - tail pushed successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - value buffer pointer is NULL
+ *					-3 - FIFO buffer full
+ */
+int fifo_common_push(fifo_common_TD *fifo, void *val_buffer)
+{
+	uint64_t start = FIFO_STATS_START();
 
-/**
-*	@addtogroup common_FIFO_buffer common FIFO buffer
-* 	@{
-*/
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
+	if(fifo->free_size == 0) return FIFO_STATS_PUSH_REJECT(&fifo->stats, -3); /* fifo FULL */
+
+	memcpy(fifo->tail_ptr, val_buffer, fifo->entry_size);
+	fifo->tail_ptr = (((uint8_t *)fifo->tail_ptr) + fifo->entry_size);
+	fifo->free_size--;
+
+	if(fifo->tail_ptr >= fifo->limit_ptr) fifo->tail_ptr = fifo->buffer;
+
+	FIFO_STATS_PUSH(&fifo->stats, 1, (fifo->max_size - fifo->free_size), start);
+
+	return 0;
+}
 
 /**
- * 	@brief Clears common FIFO buffer.
+ *	@brief Pushes m entries into FIFO buffer.
  *
- * 	@param fifo - pointer to the FIFO buffer
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param push_buffer - pointer to the buffer from which the values will be pushed
+ *	@param m - amount of entries to be pushed
  *
- * 	@retval returns: 0 - FIFO buffer cleared successfully
- * 					-1 - fifo pointer is NULL
+ *	@retval returns:	0 - all of the m entries was pushed
+ *					-1 - fifo pointer is NULL
+ *					-2 - push buffer pointer is NULL
+ *					-3 - amount of the entries to be pushed is zero
+ *					-4 - no place for m element in FIFO buffer
  *
  */
-int fifo_common_clear(fifo_common_TD *fifo)
+int fifo_common_push_mul(fifo_common_TD *fifo, void *push_buffer, fifo_size_t m)
 {
+	uint64_t start = FIFO_STATS_START();
+
 	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(push_buffer == NULL) return -2; /* push buffer pointer NULL */
+	if(m == 0) return -3; /* zero m */
+	if(m > fifo->free_size) return FIFO_STATS_PUSH_REJECT(&fifo->stats, -4); /* no place for m elements in FIFO */
 
-	memset(fifo->buffer, 0, (fifo->max_size * fifo->entry_size));
-	fifo->head_ptr = fifo->buffer;
-	fifo->tail_ptr = fifo->buffer;
-	fifo->free_size = fifo->max_size;
+	fifo->free_size -= m;
+	fifo->tail_ptr = fifo_common_scatter(fifo, fifo->tail_ptr, push_buffer, ((size_t)m * fifo->entry_size));
+
+	FIFO_STATS_PUSH(&fifo->stats, m, (fifo->max_size - fifo->free_size), start);
 
 	return 0;
 }
 
 /**
- *	@brief Pops value from common FIFO buffer.
+ *	@brief Pushes entries of a gather list into FIFO buffer as one unit.
+ * 	Checks the free size once and moves the tail once, pieces are copied in list order.
  *
  *	@param fifo - pointer to the FIFO buffer
- *	@param val_buffer - pointer to value store buffer
+ *	@param iov - pointer to the list of pieces, lengths in entries
+ *	@param iov_count - amount of pieces in the list
  *
- *	@retval returns: 0 - head popped successfully
+ *	@retval returns:	0 - all of the pieces was pushed
  *					-1 - fifo pointer is NULL
- *					-2 - value buffer pointer is NULL
- *					-3 - FIFO buffer empty
+ *					-2 - iovec pointer or pointer of a non-empty piece is NULL
+ *					-3 - total length of the pieces is zero
+ *					-4 - no place for total length in FIFO buffer
+ *
  */
-int fifo_common_pop(fifo_common_TD *fifo, void *val_buffer)
+int fifo_common_pushv(fifo_common_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count)
 {
+	fifo_index_t total = 0;
+	fifo_size_t i = 0;
+	uint8_t *tail = NULL;
+	uint64_t start = FIFO_STATS_START();
+
 	if(fifo == NULL) return -1; /* fifo pointer NULL */
-	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
-	if(fifo->free_size == fifo->max_size) return -3; /* fifo empty */
+	if(iov == NULL) return -2; /* iovec pointer NULL */
 
-	if(val_buffer != NULL) memcpy(val_buffer, fifo->head_ptr, fifo->entry_size);
-	fifo->head_ptr = (((uint8_t *)fifo->head_ptr) + fifo->entry_size);
-	fifo->free_size++;
+	total = fifo_iov_total(iov, iov_count);
 
-	if(fifo->head_ptr >= fifo->limit_ptr) fifo->head_ptr = fifo->buffer;
+	if(total == FIFO_INDEX_MAX) return -2; /* piece pointer NULL */
+	if(total == 0) return -3; /* zero total length */
+	if(total > fifo->free_size) return FIFO_STATS_PUSH_REJECT(&fifo->stats, -4); /* no place for total length in FIFO */
+
+	tail = fifo->tail_ptr;
+
+	for(i = 0; i < iov_count; i++) tail = fifo_common_scatter(fifo, tail, iov[i].base, ((size_t)iov[i].len * fifo->entry_size));
+
+	fifo->tail_ptr = tail;
+	fifo->free_size -= (fifo_size_t)total;
+
+	FIFO_STATS_PUSH(&fifo->stats, total, (fifo->max_size - fifo->free_size), start);
 
 	return 0;
 }
 
 /**
- *	@brief Pops m entries from FIFO buffer.
+ *	@brief Reserves place for n entries at the tail of FIFO buffer to be written in place.
+ *	Entries become visible to pop functions after fifo_common_commit() is called.
  *
  *	@param fifo - pointer to the FIFO buffer
- *	@param pop_buffer - pointer to the buffer into which the values will be popped
- *	@param m - amount of entries to be popped
+ *	@param n - amount of entries to be reserved
+ *	@param region1 - pointer to the first contiguous free span
+ *	@param len1 - amount of entries in the first span
+ *	@param region2 - pointer to the second span after wraparound, NULL if there is no wraparound
+ *	@param len2 - amount of entries in the second span
  *
- *	@retval returns:	0 - all of the m entries was popped
+ *	@retval returns:	0 - place for n entries is available in region1 and region2
  *					-1 - fifo pointer is NULL
- *					-2 - pop buffer pointer is NULL
- *					-3 - amount of the entries to be popped is zero
- *					-4 - FIFO buffer max size lower than m
+ *					-2 - region or length pointer is NULL
+ *					-3 - amount of the entries to be reserved is zero
+ *					-4 - no place for n element in FIFO buffer
  *
  */
-int fifo_common_pop_mul(fifo_common_TD *fifo, void *pop_buffer, uint16_t m)
+int fifo_common_reserve(fifo_common_TD *fifo, fifo_size_t n, void **region1, fifo_size_t *len1, void **region2, fifo_size_t *len2)
 {
-	void* limit = NULL;
+	fifo_size_t first = 0;
 
 	if(fifo == NULL) return -1; /* fifo pointer NULL */
-	if(pop_buffer == NULL) return -2; /* pop buffer pointer NULL */
-	if(m == 0) return -3; /* zero m */
-	if(m > fifo->max_size) return -4; /* max size lower than m */
+	if((region1 == NULL) || (len1 == NULL) || (region2 == NULL) || (len2 == NULL)) return -2; /* region pointer NULL */
+	if(n == 0) return -3; /* zero n */
+	if(n > fifo->free_size) return FIFO_STATS_PUSH_REJECT(&fifo->stats, -4); /* no place for n elements in FIFO */
 
-	fifo->free_size += m;
+	first = (fifo_size_t)(((uint8_t *)fifo->limit_ptr - (uint8_t *)fifo->tail_ptr) / fifo->entry_size);
 
-	limit = (((uint8_t *)fifo->head_ptr) + (m * fifo->entry_size));
+	*region1 = fifo->tail_ptr;
 
-	if(limit >= fifo->limit_ptr)
+	if(n <= first)
 	{
-		memcpy(pop_buffer, fifo->head_ptr, (size_t)(((uint8_t *)fifo->limit_ptr - (uint8_t *)fifo->head_ptr) * fifo->entry_size));
-		pop_buffer = (((uint8_t *)pop_buffer) + (((uint8_t *)fifo->limit_ptr - (uint8_t *)fifo->head_ptr) * fifo->entry_size));
-		m -= ((uint8_t *)fifo->limit_ptr - (uint8_t *)fifo->head_ptr);
-		fifo->head_ptr = fifo->buffer;
+		*len1 = n;
+		*region2 = NULL;
+		*len2 = 0;
+	}
+	else
+	{
+		*len1 = first;
+		*region2 = fifo->buffer;
+		*len2 = (n - first);
 	}
-
-	memcpy(pop_buffer, fifo->head_ptr, (m * fifo->entry_size));
-	fifo->head_ptr = (((uint8_t *)fifo->head_ptr) + (m * fifo->entry_size));
 
 	return 0;
 }
 
 /**
- *	@brief Pushes value into common FIFO buffer.
+ *	@brief Commits n entries written into the span given by fifo_common_reserve().
  *
  *	@param fifo - pointer to the FIFO buffer
- *	@param val_buffer - value buffer to push
+ *	@param n - amount of entries to be committed
  *
- *	@retval returns: 0 - tail pushed successfully
+ *	@retval returns:	0 - n entries committed
  *					-1 - fifo pointer is NULL
- *					-2 - value buffer pointer is NULL
- *					-3 - FIFO buffer full
+ *					-3 - amount of the entries to be committed is zero
+ *					-4 - no place for n element in FIFO buffer
+ *
  */
-int fifo_common_push(fifo_common_TD *fifo, void *val_buffer)
+int fifo_common_commit(fifo_common_TD *fifo, fifo_size_t n)
 {
+	fifo_size_t first = 0;
+
 	if(fifo == NULL) return -1; /* fifo pointer NULL */
-	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
-	if(fifo->free_size == 0) return -3; /* fifo FULL */
+	if(n == 0) return -3; /* zero n */
+	if(n > fifo->free_size) return -4; /* no place for n elements in FIFO */
 
-	memcpy(fifo->tail_ptr, val_buffer, fifo->entry_size);
-	fifo->tail_ptr = (((uint8_t *)fifo->tail_ptr) + fifo->entry_size);
-	fifo->free_size--;
+	fifo->free_size -= n;
 
-	if(fifo->tail_ptr >= fifo->limit_ptr) fifo->tail_ptr = fifo->buffer;
+	first = (fifo_size_t)(((uint8_t *)fifo->limit_ptr - (uint8_t *)fifo->tail_ptr) / fifo->entry_size);
+
+	if(n >= first) fifo->tail_ptr = (((uint8_t *)fifo->buffer) + ((size_t)(n - first) * fifo->entry_size));
+	else fifo->tail_ptr = (((uint8_t *)fifo->tail_ptr) + ((size_t)n * fifo->entry_size));
+
+	FIFO_STATS_PUSH(&fifo->stats, n, (fifo->max_size - fifo->free_size), 0);
 
 	return 0;
 }
 
 /**
- *	@brief Pushes m entries into FIFO buffer.
+ *	@brief Pushes as many of m entries as fit into FIFO buffer.
  *
  *	@param fifo - pointer to the FIFO buffer
  *	@param push_buffer - pointer to the buffer from which the values will be pushed
- *	@param m - amount of entries to be pushed
- *
- *	@retval returns:	0 - all of the m entries was pushed
- *					-1 - fifo pointer is NULL
- *					-2 - push buffer pointer is NULL
- *					-3 - amount of the entries to be pushed is zero
- *					-4 - no place for m element in FIFO buffer
+ *	@param m - maximal amount of entries to be pushed
  *
+ *	@retval returns: amount of entries pushed, 0 if FIFO buffer is full or any pointer is NULL
  */
-int fifo_common_push_mul(fifo_common_TD *fifo, void *push_buffer, uint16_t m)
+fifo_size_t fifo_common_write_some(fifo_common_TD *fifo, void *push_buffer, fifo_size_t m)
 {
-	void* limit = NULL;
+	void *region1 = NULL;
+	void *region2 = NULL;
+	fifo_size_t len1 = 0;
+	fifo_size_t len2 = 0;
 
-	if(fifo == NULL) return -1; /* fifo pointer NULL */
-	if(push_buffer == NULL) return -2; /* push buffer pointer NULL */
-	if(m == 0) return -3; /* zero m */
-	if(m > fifo->free_size) return -4; /* no place for m elements in FIFO */
+	if((fifo == NULL) || (push_buffer == NULL)) return 0; /* pointer NULL */
 
-	fifo->free_size -= m;
+	if(m > fifo->free_size) m = fifo->free_size;
+	if(m == 0) return 0; /* fifo full */
 
-	limit = (((uint8_t *)fifo->tail_ptr) +  (m * fifo->entry_size));
+	fifo_common_reserve(fifo, m, &region1, &len1, &region2, &len2);
 
-	if(limit >= fifo->limit_ptr)
-	{
-		memcpy(fifo->tail_ptr, push_buffer, (size_t)(((uint8_t *)fifo->limit_ptr - (uint8_t *)fifo->tail_ptr) * fifo->entry_size));
-		push_buffer = (((uint8_t *)push_buffer) + (((uint8_t *)fifo->limit_ptr - (uint8_t *)fifo->tail_ptr) * fifo->entry_size));
-		m -=  (((uint8_t *)fifo->limit_ptr - (uint8_t *)fifo->tail_ptr) / fifo->entry_size);
-		fifo->tail_ptr = fifo->buffer;
-	}
+	memcpy(region1, push_buffer, ((size_t)len1 * fifo->entry_size));
+	if(len2 != 0) memcpy(region2, (((uint8_t *)push_buffer) + ((size_t)len1 * fifo->entry_size)), ((size_t)len2 * fifo->entry_size));
 
-	memcpy(fifo->tail_ptr, push_buffer, (m * fifo->entry_size));
-	fifo->tail_ptr = (((uint8_t *)fifo->tail_ptr) + (m * fifo->entry_size));
+	fifo_common_commit(fifo, m);
 
-	return 0;
+	return m;
 }
 
 /**
@@ -762,7 +902,7 @@ int fifo_common_push_mul(fifo_common_TD *fifo, void *push_buffer, uint16_t m)
  *	@param buffer - pointer to buffer that stores values
  *	@param size - size of FIFO buffer
  *	@param entry_size - size of an entry of common FIFO buffer
- *	@param clear_flag - specifies whether the buffer need to be cleared
+ *	@param clear_flag - specifies whether the buffer need to be cleared, see FIFO_WIPE_MODE
  *
  *	@retval returns: 0 - uint8_t FIFO buffer created successfully
  *					-1 - fifo pointer is NULL
@@ -770,7 +910,7 @@ int fifo_common_push_mul(fifo_common_TD *fifo, void *push_buffer, uint16_t m)
  *					-3 - size of FIFO buffer is 0
  *					-4 - size of entry is 0
  */
-int fifo_common_init(fifo_common_TD *fifo, void *buffer, uint16_t size, uint16_t entry_size, bool clear_flag)
+int fifo_common_init(fifo_common_TD *fifo, void *buffer, fifo_size_t size, uint16_t entry_size, bool clear_flag)
 {
 	if(fifo == NULL) return -1; /* fifo pointer NULL */
 	if(buffer == NULL) return -2; /* buffer pointer NULL */
@@ -780,16 +920,133 @@ int fifo_common_init(fifo_common_TD *fifo, void *buffer, uint16_t size, uint16_t
 	fifo->buffer = buffer;
 	fifo->head_ptr = buffer;
 	fifo->tail_ptr = buffer;
-	fifo->limit_ptr = (((uint8_t *)buffer) + (entry_size * size));
+	fifo->limit_ptr = (((uint8_t *)buffer) + ((size_t)entry_size * size));
 	fifo->entry_size = entry_size;
 	fifo->max_size = size;
 	fifo->free_size = size;
+	FIFO_STATS_INIT(&fifo->stats);
+
+	if(clear_flag == true) fifo_wipe(buffer, ((size_t)size * entry_size));
+
+	return 0;
+}
+
+/**
+ *	@brief Starts in-place iteration over up to n oldest entries of common FIFO buffer and prefetches
+ *	the first distance of them. Entries are visited with fifo_common_iter_next() straight in the ring,
+ *	without a copy, and released all at once by fifo_common_iter_end().
+ *	Alert: no other pop function may be called on the FIFO buffer until fifo_common_iter_end().
+ *
+ *	@param iter - pointer to the iterator
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param n - maximal amount of entries to be visited
+ *	@param distance - prefetch distance in entries, 0 - no prefetch, see FIFO_PREFETCH_DISTANCE
+ *
+ *	@retval returns: amount of entries to be visited, 0 if FIFO buffer is empty or a pointer is NULL
+ */
+fifo_size_t fifo_common_iter_begin(fifo_common_iter_TD *iter, fifo_common_TD *fifo, fifo_size_t n, fifo_size_t distance)
+{
+	fifo_size_t i = 0;
+
+	if(iter == NULL) return 0; /* iter pointer NULL */
+
+	iter->fifo = fifo;
+	iter->left = 0;
+	iter->ahead_left = 0;
+	iter->visited = 0;
+
+	if(fifo == NULL) return 0; /* fifo pointer NULL */
+
+	if(n > (fifo->max_size - fifo->free_size)) n = (fifo->max_size - fifo->free_size);
+	if(distance > n) distance = n;
+
+	iter->buffer = fifo->buffer;
+	iter->limit = fifo->limit_ptr;
+	iter->pos = fifo->head_ptr;
+	iter->ahead = fifo->head_ptr;
+	iter->entry_size = fifo->entry_size;
+	iter->left = n;
+	iter->ahead_left = n;
+
+	for(i = 0; i < distance; i++)
+	{
+		FIFO_PREFETCH(iter->ahead);
+		iter->ahead += iter->entry_size;
+		if(iter->ahead == iter->limit) iter->ahead = iter->buffer;
+		iter->ahead_left--;
+	}
 
-	if(clear_flag == true) memset(buffer, 0, (size * entry_size));
+	return n;
+}
+
+/**
+ *	@brief Ends iteration and releases every entry visited by fifo_common_iter_next() with one head update.
+ *
+ *	@param iter - pointer to the iterator
+ *
+ *	@retval returns: 0 - visited entries released
+ *					-1 - iter or its fifo pointer is NULL
+ */
+int fifo_common_iter_end(fifo_common_iter_TD *iter)
+{
+	fifo_common_TD *fifo = NULL;
+
+	if((iter == NULL) || (iter->fifo == NULL)) return -1; /* iter or fifo pointer NULL */
+
+	fifo = iter->fifo;
+
+	if(iter->visited != 0)
+	{
+		fifo->free_size += iter->visited;
+		fifo->head_ptr = iter->pos;
+
+		FIFO_STATS_POP(&fifo->stats, iter->visited, 0);
+	}
+
+	iter->left = 0;
+	iter->ahead_left = 0;
+	iter->visited = 0;
 
 	return 0;
 }
 
+/**
+ *	@brief Calls visit for up to n oldest entries of common FIFO buffer in place, prefetching distance entries
+ *	ahead, and releases the visited entries with one head update at the end.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param n - maximal amount of entries to be visited
+ *	@param distance - prefetch distance in entries, 0 - no prefetch, see FIFO_PREFETCH_DISTANCE
+ *	@param visit - visitor, returns false to stop, the entry it got then stays in FIFO buffer
+ *	@param context - passed to visit as is
+ *
+ *	@retval returns: amount of entries visited and popped, 0 if FIFO buffer is empty or a pointer is NULL
+ */
+fifo_size_t fifo_common_foreach(fifo_common_TD *fifo, fifo_size_t n, fifo_size_t distance, fifo_common_visit_TD visit, void *context)
+{
+	fifo_common_iter_TD iter;
+	uint8_t *entry = NULL;
+	fifo_size_t visited = 0;
+
+	if(visit == NULL) return 0; /* visit pointer NULL */
+	if(fifo_common_iter_begin(&iter, fifo, n, distance) == 0) return 0; /* nothing to visit */
+
+	while((entry = fifo_common_iter_next(&iter)) != NULL)
+	{
+		if(visit(entry, context) == false)
+		{
+			iter.pos = entry; /* entry stays in FIFO buffer */
+			iter.visited--;
+			break;
+		}
+	}
+
+	visited = iter.visited;
+	fifo_common_iter_end(&iter);
+
+	return visited;
+}
+
 /**
 * 	@}
 */
@@ -13,50 +13,22 @@
 #include <string.h>
 #include <stdbool.h>
 
+#include "fifo_template.h"
+
 /**
-* 	@brief  uint8_t FIFO buffer type. Used for store uint8_t entries.
+* 	@brief	uint8_t FIFO buffer type. Used for store uint8_t entries.
 */
-typedef struct
-{
-	uint8_t *buffer;		/**< Pointer to buffer that stores uint8_t values */
-	uint8_t *head_ptr;		/**< Pointer to a head of uint8_t FIFO buffer */
-	uint8_t *tail_ptr;		/**< Pointer to a tail of uint8_t FIFO buffer  */
-	uint8_t *limit_ptr;		/**< Pointer to a limit of uint8_t FIFO buffer */
-	
-	uint16_t max_size;		/**< Size of uint8_t FIFO buffer */
-	uint16_t free_size; 	/**< Free size of uint8_t FIFO buffer */
-	
-}fifo_uint8_TD;
+FIFO_TEMPLATE_TYPE(uint8, uint8_t)
 
 /**
 * 	@brief	uint16_t FIFO buffer type. Used for store uint16_t entries.
 */
-typedef struct
-{
-	uint16_t *buffer;		/**< Pointer to buffer that stores uint16_t values */
-	uint16_t *head_ptr;		/**< Pointer to a head of uint16_t FIFO buffer */
-	uint16_t *tail_ptr;		/**< Pointer to a tail of uint16_t FIFO buffer  */
-	uint16_t *limit_ptr;	/**< Pointer to a limit of uint16_t FIFO buffer */
-
-	uint16_t max_size;		/**< Size of uint16_t FIFO buffer */
-	uint16_t free_size; 	/**< Free size of uint16_t FIFO buffer */
-
-}fifo_uint16_TD;
+FIFO_TEMPLATE_TYPE(uint16, uint16_t)
 
 /**
 * 	@brief	uint32_t FIFO buffer type. Used for store uint32_t entries.
 */
-typedef struct
-{
-	uint32_t *buffer;		/**< Pointer to buffer that stores uint32_t values */
-	uint32_t *head_ptr;		/**< Pointer to a head of uint32_t FIFO buffer */
-	uint32_t *tail_ptr;		/**< Pointer to a tail of uint32_t FIFO buffer  */
-	uint32_t *limit_ptr;	/**< Pointer to a limit of uint32_t FIFO buffer */
-
-	uint16_t max_size;		/**< Size of uint32_t FIFO buffer */
-	uint16_t free_size; 	/**< Free size of uint32_t FIFO buffer */
-
-}fifo_uint32_TD;
+FIFO_TEMPLATE_TYPE(uint32, uint32_t)
 
 /**
 * 	@brief	common FIFO buffer type. Used for store entries with user defined size.
@@ -70,38 +42,99 @@ typedef struct
 
 	uint16_t entry_size;	/**< Size of common FIFO buffer entry in Bytes */
 
-	uint16_t max_size;		/**< Size of common FIFO buffer */
-	uint16_t free_size; 	/**< Free size of common FIFO buffer */
+	fifo_size_t max_size;	/**< Size of common FIFO buffer */
+	fifo_size_t free_size;	/**< Free size of common FIFO buffer */
+	FIFO_STATS_FIELD		/**< Statistics of common FIFO buffer, only with FIFO_STATS */
 
 }fifo_common_TD;
 
-int fifo_uint8_clear(fifo_uint8_TD *fifo);
-int fifo_uint8_pop(fifo_uint8_TD *fifo, uint8_t *val);
-int fifo_uint8_pop_mul(fifo_uint8_TD *fifo, uint8_t *pop_buffer, uint16_t m);
-int fifo_uint8_push(fifo_uint8_TD *fifo, uint8_t val);
-int fifo_uint8_push_mul(fifo_uint8_TD *fifo, uint8_t *push_buffer, uint16_t m);
-int fifo_uint8_init(fifo_uint8_TD *fifo, uint8_t *buffer, uint16_t size, bool clear_flag);
-
-int fifo_uint16_clear(fifo_uint16_TD *fifo);
-int fifo_uint16_pop(fifo_uint16_TD *fifo, uint16_t *val);
-int fifo_uint16_pop_mul(fifo_uint16_TD *fifo, uint16_t *pop_buffer, uint16_t m);
-int fifo_uint16_push(fifo_uint16_TD *fifo, uint16_t val);
-int fifo_uint16_push_mul(fifo_uint16_TD *fifo, uint16_t *push_buffer, uint16_t m);
-int fifo_uint16_init(fifo_uint16_TD *fifo, uint16_t *buffer, uint16_t size, bool clear_flag);
-
-int fifo_uint32_clear(fifo_uint32_TD *fifo);
-int fifo_uint32_pop(fifo_uint32_TD *fifo, uint32_t *val);
-int fifo_uint32_pop_mul(fifo_uint32_TD *fifo, uint32_t *pop_buffer, uint16_t m);
-int fifo_uint32_push(fifo_uint32_TD *fifo, uint32_t val);
-int fifo_uint32_push_mul(fifo_uint32_TD *fifo, uint32_t *push_buffer, uint16_t m);
-int fifo_uint32_init(fifo_uint32_TD *fifo, uint32_t *buffer, uint16_t size, bool clear_flag);
+/**
+* 	@brief	In-place consumer iterator of common FIFO buffer, see fifo_common_iter_begin().
+*/
+typedef struct
+{
+	fifo_common_TD *fifo;	/**< Pointer to the iterated FIFO buffer */
+	uint8_t *buffer;		/**< Copy of fifo->buffer */
+	uint8_t *limit;			/**< Copy of fifo->limit_ptr */
+	uint8_t *pos;			/**< Entry returned by the next fifo_common_iter_next() call */
+	uint8_t *ahead;			/**< Entry prefetched by the next fifo_common_iter_next() call */
+	uint16_t entry_size;	/**< Copy of fifo->entry_size */
+	fifo_size_t left;		/**< Entries not visited yet */
+	fifo_size_t ahead_left;	/**< Entries not prefetched yet */
+	fifo_size_t visited;	/**< Entries visited since fifo_common_iter_begin(), released by fifo_common_iter_end() */
+
+}fifo_common_iter_TD;
+
+/**
+* 	@brief	Visitor of fifo_common_foreach(): returns false to stop, the entry it got then stays in FIFO buffer.
+*/
+typedef bool (*fifo_common_visit_TD)(void *entry, void *context);
+
+FIFO_TEMPLATE_PROTOTYPES(uint8, uint8_t)
+FIFO_TEMPLATE_FAST(uint8, uint8_t)
+int fifo_uint8_pop_mul_convert_u16(fifo_uint8_TD *fifo, uint16_t *pop_buffer, fifo_size_t m);
+
+FIFO_TEMPLATE_PROTOTYPES(uint16, uint16_t)
+FIFO_TEMPLATE_FAST(uint16, uint16_t)
+int fifo_uint16_pop_mul_convert_i32(fifo_uint16_TD *fifo, int32_t *pop_buffer, fifo_size_t m);
+int fifo_uint16_pop_mul_convert_f32(fifo_uint16_TD *fifo, float *pop_buffer, fifo_size_t m);
+int fifo_uint16_pop_sum(fifo_uint16_TD *fifo, fifo_size_t m, uint64_t *sum);
+int fifo_uint16_pop_minmax(fifo_uint16_TD *fifo, fifo_size_t m, uint16_t *min, uint16_t *max);
+int fifo_uint16_pop_decimate(fifo_uint16_TD *fifo, uint16_t *pop_buffer, fifo_size_t m, uint16_t factor);
+int fifo_uint16_pop_mavg(fifo_uint16_TD *fifo, uint16_t *pop_buffer, fifo_size_t m, fifo_size_t window);
 
+FIFO_TEMPLATE_PROTOTYPES(uint32, uint32_t)
+FIFO_TEMPLATE_FAST(uint32, uint32_t)
+
+int fifo_common_reset(fifo_common_TD *fifo);
 int fifo_common_clear(fifo_common_TD *fifo);
 int fifo_common_pop(fifo_common_TD *fifo, void *val_buffer);
-int fifo_common_pop_mul(fifo_common_TD *fifo, void *pop_buffer, uint16_t m);
+int fifo_common_pop_mul(fifo_common_TD *fifo, void *pop_buffer, fifo_size_t m);
+fifo_size_t fifo_common_read_some(fifo_common_TD *fifo, void *pop_buffer, fifo_size_t m);
+int fifo_common_popv(fifo_common_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count);
+int fifo_common_peek(fifo_common_TD *fifo, fifo_size_t n, void **region1, fifo_size_t *len1, void **region2, fifo_size_t *len2);
+int fifo_common_release(fifo_common_TD *fifo, fifo_size_t n);
 int fifo_common_push(fifo_common_TD *fifo, void *val_buffer);
-int fifo_common_push_mul(fifo_common_TD *fifo, void *push_buffer, uint16_t m);
-int fifo_common_init(fifo_common_TD *fifo, void *buffer, uint16_t size, uint16_t entry_size, bool clear_flag);
+int fifo_common_push_mul(fifo_common_TD *fifo, void *push_buffer, fifo_size_t m);
+int fifo_common_pushv(fifo_common_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count);
+fifo_size_t fifo_common_write_some(fifo_common_TD *fifo, void *push_buffer, fifo_size_t m);
+int fifo_common_reserve(fifo_common_TD *fifo, fifo_size_t n, void **region1, fifo_size_t *len1, void **region2, fifo_size_t *len2);
+int fifo_common_commit(fifo_common_TD *fifo, fifo_size_t n);
+int fifo_common_init(fifo_common_TD *fifo, void *buffer, fifo_size_t size, uint16_t entry_size, bool clear_flag);
+
+fifo_size_t fifo_common_iter_begin(fifo_common_iter_TD *iter, fifo_common_TD *fifo, fifo_size_t n, fifo_size_t distance);
+int fifo_common_iter_end(fifo_common_iter_TD *iter);
+fifo_size_t fifo_common_foreach(fifo_common_TD *fifo, fifo_size_t n, fifo_size_t distance, fifo_common_visit_TD visit, void *context);
+
+/**
+ *	@brief Gives the next entry of the iterator in place and prefetches the entry distance ahead of it.
+ *	The entry stays valid until fifo_common_iter_end().
+ *
+ *	@param iter - pointer to the iterator started by fifo_common_iter_begin()
+ *
+ *	@retval returns: pointer to the entry, NULL when all entries of the iteration were visited
+ */
+static inline void *fifo_common_iter_next(fifo_common_iter_TD *iter)
+{
+	uint8_t *entry = iter->pos;
+
+	if(iter->left == 0) return NULL; /* iteration done */
+
+	if(iter->ahead_left != 0)
+	{
+		FIFO_PREFETCH(iter->ahead);
+		iter->ahead += iter->entry_size;
+		if(iter->ahead == iter->limit) iter->ahead = iter->buffer;
+		iter->ahead_left--;
+	}
+
+	iter->pos += iter->entry_size;
+	if(iter->pos == iter->limit) iter->pos = iter->buffer;
+	iter->left--;
+	iter->visited++;
+
+	return entry;
+}
 
 int fifo_test(void);
 
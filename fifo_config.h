@@ -0,0 +1,238 @@
+/**
+ * 	@file fifo_config.h
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Build-time configuration of software FIFO buffers.
+ *  Every option may be overridden from the compiler command line (-D) or before including fifo headers.
+ */
+
+#ifndef FIFO_CONFIG_H_
+#define FIFO_CONFIG_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <assert.h>
+
+/**
+* 	@brief	Width of FIFO buffer size type in bits: 16, 32 or 64.
+*
+* 	Sets the type of max_size, free_size and of the amount argument of every bulk function.
+* 	Default 16 keeps the original footprint, 32 or 64 allow rings of hundreds of MB on hosts.
+*/
+#ifndef FIFO_SIZE_BITS
+#define FIFO_SIZE_BITS			16
+#endif
+
+#if (FIFO_SIZE_BITS == 16)
+typedef uint16_t fifo_size_t;			/**< Type of FIFO buffer sizes and entry amounts */
+typedef uint32_t fifo_index_t;			/**< Type of FIFO buffer head/tail counters */
+#define FIFO_SIZE_MAX			UINT16_MAX
+#define FIFO_INDEX_MAX			UINT32_MAX
+#elif (FIFO_SIZE_BITS == 32)
+typedef uint32_t fifo_size_t;			/**< Type of FIFO buffer sizes and entry amounts */
+typedef uint32_t fifo_index_t;			/**< Type of FIFO buffer head/tail counters */
+#define FIFO_SIZE_MAX			UINT32_MAX
+#define FIFO_INDEX_MAX			UINT32_MAX
+#elif (FIFO_SIZE_BITS == 64)
+typedef uint64_t fifo_size_t;			/**< Type of FIFO buffer sizes and entry amounts */
+typedef uint64_t fifo_index_t;			/**< Type of FIFO buffer head/tail counters */
+#define FIFO_SIZE_MAX			UINT64_MAX
+#define FIFO_INDEX_MAX			UINT64_MAX
+#else
+#error "FIFO_SIZE_BITS must be 16, 32 or 64"
+#endif
+
+/**
+* 	@brief	One piece of a scatter/gather list of pushv/popv functions.
+*/
+typedef struct
+{
+	void *base;			/**< Pointer to the piece */
+	fifo_size_t len;	/**< Length of the piece in entries */
+
+}fifo_iovec_TD;
+
+/**
+* 	@brief	Returns total length of a scatter/gather list, FIFO_INDEX_MAX when a non-empty piece pointer is NULL, saturated below it.
+*/
+static inline fifo_index_t fifo_iov_total(const fifo_iovec_TD *iov, fifo_size_t iov_count)
+{
+	fifo_index_t total = 0;
+	fifo_size_t i = 0;
+
+	for(i = 0; i < iov_count; i++)
+	{
+		if((iov[i].base == NULL) && (iov[i].len != 0)) return FIFO_INDEX_MAX; /* piece pointer NULL */
+		if(iov[i].len > ((FIFO_INDEX_MAX - 1) - total)) return (FIFO_INDEX_MAX - 1); /* saturate, larger than any FIFO buffer */
+		total += iov[i].len;
+	}
+
+	return total;
+}
+
+/**
+* 	@brief	Size of a cache line of the target in Bytes.
+*/
+#ifndef FIFO_CACHE_LINE_SIZE
+#define FIFO_CACHE_LINE_SIZE	64
+#endif
+
+/**
+* 	@brief	Places producer-owned and consumer-owned SPSC state on separate cache lines when defined to 1.
+*
+* 	Avoids the line with head and tail ping-ponging between cores on multicore targets.
+* 	Costs up to 3 cache lines per FIFO, so it is disabled by default for MCU targets.
+* 	FIFO objects must then be allocated with FIFO_CACHE_LINE_SIZE alignment (static, aligned_alloc).
+*/
+#ifndef FIFO_SPSC_CACHE_ALIGNED
+#define FIFO_SPSC_CACHE_ALIGNED	0
+#endif
+
+#if (FIFO_SPSC_CACHE_ALIGNED == 1)
+#define FIFO_SPSC_ALIGN			_Alignas(FIFO_CACHE_LINE_SIZE)
+#else
+#define FIFO_SPSC_ALIGN
+#endif
+
+/**
+* 	@brief	Places positions shared by producers and by consumers of MPMC/MPSC FIFO buffers on separate cache lines when defined to 1.
+*/
+#ifndef FIFO_MPMC_CACHE_ALIGNED
+#define FIFO_MPMC_CACHE_ALIGNED	0
+#endif
+
+#if (FIFO_MPMC_CACHE_ALIGNED == 1)
+#define FIFO_MPMC_ALIGN			_Alignas(FIFO_CACHE_LINE_SIZE)
+#else
+#define FIFO_MPMC_ALIGN
+#endif
+
+/**
+* 	@brief	Spin-wait hint of the target, executed once per spin of the drain functions.
+*/
+#ifndef FIFO_CPU_RELAX
+#if defined(__x86_64__) || defined(__i386__)
+#define FIFO_CPU_RELAX()		__builtin_ia32_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+#define FIFO_CPU_RELAX()		__asm__ __volatile__("yield")
+#else
+#define FIFO_CPU_RELAX()		((void)0)
+#endif
+#endif
+
+/**
+* 	@brief	Yield of the CPU to other threads, used by waits that may outlast a time slice (e.g. behind a preempted producer).
+* 	sched_yield() is declared by <sched.h> in the translation units that yield, the headers do not pull it in.
+*/
+#ifndef FIFO_CPU_YIELD
+#if defined(__unix__) || defined(__APPLE__)
+#define FIFO_CPU_YIELD()		((void)sched_yield())
+#else
+#define FIFO_CPU_YIELD()		((void)0)
+#endif
+#endif
+
+/**
+* 	@brief	Amount of FIFO_CPU_RELAX() spins of such waits before each FIFO_CPU_YIELD(), 0 - never yield.
+*/
+#ifndef FIFO_SPIN_YIELD_LIMIT
+#define FIFO_SPIN_YIELD_LIMIT	64
+#endif
+
+/**
+* 	@brief	Software prefetch of the cache line at addr for reading, a no-op without compiler support.
+*/
+#ifndef FIFO_PREFETCH
+#if defined(__GNUC__)
+#define FIFO_PREFETCH(addr)		__builtin_prefetch((addr), 0, 3)
+#else
+#define FIFO_PREFETCH(addr)		((void)(addr))
+#endif
+#endif
+
+/**
+* 	@brief	Default distance in entries between the visited and the prefetched entry of common FIFO buffer iterators.
+*/
+#ifndef FIFO_PREFETCH_DISTANCE
+#define FIFO_PREFETCH_DISTANCE	8
+#endif
+
+/**
+* 	@brief	Enables AVX2/SSE2/NEON copy and widening kernels of bulk functions when defined to 1.
+*
+* 	Kernels are picked from the compiler target flags (-mavx2, -msse2, NEON), 0 keeps portable C only.
+*/
+#ifndef FIFO_SIMD
+#define FIFO_SIMD				1
+#endif
+
+/**
+* 	@brief	Check of the preconditions of *_fast functions, compiled out with NDEBUG.
+*
+* 	May be redefined to a port specific trap, e.g. a breakpoint in an ISR build.
+*/
+#ifndef FIFO_ASSERT
+#define FIFO_ASSERT(cond)		assert(cond)
+#endif
+
+/**
+* 	@brief	Selects what clear functions and init with clear_flag do with the buffer contents.
+*
+* 	0 - nothing, only indices are rewound (O(1), head == tail already means empty),
+* 	1 - buffer is zeroed with memset,
+* 	2 - buffer is zeroed through volatile stores the compiler cannot drop, for buffers that held secrets.
+* 	reset functions never touch the buffer whatever the mode.
+*/
+#ifndef FIFO_WIPE_MODE
+#define FIFO_WIPE_MODE			0
+#endif
+
+/**
+ *	@brief Wipes bytes of buffer as selected by FIFO_WIPE_MODE.
+ */
+static inline void fifo_wipe(void *buffer, size_t bytes)
+{
+#if (FIFO_WIPE_MODE == 1)
+	memset(buffer, 0, bytes);
+#elif (FIFO_WIPE_MODE == 2)
+	volatile uint8_t *p = buffer;
+	size_t i = 0;
+
+	for(i = 0; i < bytes; i++) p[i] = 0;
+#else
+	(void)buffer;
+	(void)bytes;
+#endif
+}
+
+/**
+* 	@brief	Adds statistics counters to template, common and SPSC FIFO buffers when defined to 1, see fifo_stats.h.
+*
+* 	FIFO_STATS_TIMING set to 1 additionally sums cycles spent in push/pop functions, read with
+* 	FIFO_STATS_CYCLES() (TSC on x86, CNTVCT on AArch64, to be defined by the port elsewhere).
+*/
+#ifndef FIFO_STATS
+#define FIFO_STATS				0
+#endif
+
+#ifndef FIFO_STATS_TIMING
+#define FIFO_STATS_TIMING		0
+#endif
+
+/**
+* 	@brief	Selects how fifo_wait functions sleep: 1 - Linux futex, 0 - fifo_wait_port_* hooks provided by the user.
+*
+* 	Hooks let an RTOS port map the wait words onto semaphores or event flags.
+*/
+#ifndef FIFO_WAIT_FUTEX
+#if defined(__linux__)
+#define FIFO_WAIT_FUTEX			1
+#else
+#define FIFO_WAIT_FUTEX			0
+#endif
+#endif
+
+#endif /* FIFO_CONFIG_H_ */
@@ -0,0 +1,300 @@
+/**
+ * 	@file fifo_event.c
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Implementation of eventfd notification layer on top of SPSC FIFO buffers.
+ *  Alert: Linux only, fifo_event_arm_data/fifo_event_pop/fifo_event_read_some must be called
+ *  from the consumer context only and the space/push counterparts from the producer context only.
+ *
+ */
+
+#if defined(__linux__)
+
+#define _GNU_SOURCE
+
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+#include "fifo_event.h"
+
+/**
+*	@addtogroup Software_FIFO_buffer Software FIFO buffers
+* 	@{
+*/
+
+/**
+*	@addtogroup event_FIFO_buffer eventfd FIFO buffer layer
+* 	@{
+*/
+
+/**
+ *	@brief Arms edge of fd when the level (entries or free entries) is 0, returns 0 when armed and 1 otherwise.
+ *	Shared by data and space arms.
+ *
+ *	The armer publishes armed and re-checks the level after a full fence, the notifier
+ *	publishes its index and checks armed after a full fence, so an edge can not be lost.
+ */
+static int fifo_event_arm(int fd, _Atomic uint32_t *armed, fifo_spsc_ring_TD *ring, bool space)
+{
+	uint64_t value = 0;
+	fifo_size_t level = 0;
+
+	if(read(fd, &value, sizeof(value)) < 0) value = 0; /* EAGAIN, no edge pending */
+
+	atomic_store_explicit(armed, 1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_seq_cst);
+
+	level = fifo_spsc_ring_count(ring);
+	if(space) level = ring->max_size - level;
+
+	if(level == 0) return 0; /* armed, wait for the edge */
+
+	atomic_store_explicit(armed, 0, memory_order_relaxed); /* not waiting, a racing notify gives one spurious edge */
+
+	return 1;
+}
+
+/**
+ *	@brief Writes the edge of fd when the other side armed it. Shared by data and space notifies.
+ */
+static inline void fifo_event_signal(int fd, _Atomic uint32_t *armed)
+{
+	uint64_t one = 1;
+
+	atomic_thread_fence(memory_order_seq_cst);
+
+	if(atomic_load_explicit(armed, memory_order_relaxed) == 0) return; /* nobody waits */
+	if(atomic_exchange_explicit(armed, 0, memory_order_relaxed) == 0) return; /* already signaled */
+
+	if(write(fd, &one, sizeof(one)) < 0) return; /* counter saturated, fd readable anyway */
+}
+
+/**
+ *	@brief Creates event state of SPSC FIFO buffer with two non-blocking eventfds.
+ *
+ *	@param event - pointer to the event state
+ *
+ *	@retval returns: 0 - event state created successfully
+ *					-1 - event pointer is NULL
+ *					-6 - eventfd failed, errno is left as set by it
+ */
+int fifo_event_init(fifo_event_TD *event)
+{
+	if(event == NULL) return -1; /* event pointer NULL */
+
+	atomic_init(&event->data_armed, 0);
+	atomic_init(&event->space_armed, 0);
+
+	event->data_fd = eventfd(0, (EFD_NONBLOCK | EFD_CLOEXEC));
+	if(event->data_fd < 0) return -6; /* no eventfd */
+
+	event->space_fd = eventfd(0, (EFD_NONBLOCK | EFD_CLOEXEC));
+
+	if(event->space_fd < 0)
+	{
+		close(event->data_fd);
+		event->data_fd = -1;
+		return -6; /* no eventfd */
+	}
+
+	return 0;
+}
+
+/**
+ *	@brief Destroys event state and closes its eventfds.
+ *
+ *	@param event - pointer to the event state
+ *
+ *	@retval returns: 0 - event state destroyed successfully
+ *					-1 - event pointer is NULL
+ */
+int fifo_event_deinit(fifo_event_TD *event)
+{
+	if(event == NULL) return -1; /* event pointer NULL */
+
+	if(event->data_fd >= 0) close(event->data_fd);
+	if(event->space_fd >= 0) close(event->space_fd);
+
+	event->data_fd = -1;
+	event->space_fd = -1;
+
+	return 0;
+}
+
+/**
+ *	@brief Arms data_fd for the next empty -> non-empty edge if SPSC FIFO buffer is empty. Consumer side only.
+ *	Clears a pending edge of data_fd, so it is also the acknowledge after epoll reported it.
+ *
+ *	@param event - pointer to the event state
+ *	@param ring - pointer to the SPSC ring state
+ *
+ *	@retval returns: 0 - FIFO buffer empty and data_fd armed, wait for it
+ *					 1 - FIFO buffer holds entries, keep popping
+ *					-1 - event pointer is NULL
+ *					-2 - ring pointer is NULL
+ */
+int fifo_event_arm_data(fifo_event_TD *event, fifo_spsc_ring_TD *ring)
+{
+	if(event == NULL) return -1; /* event pointer NULL */
+	if(ring == NULL) return -2; /* ring pointer NULL */
+
+	return fifo_event_arm(event->data_fd, &event->data_armed, ring, false);
+}
+
+/**
+ *	@brief Arms space_fd for the next full -> not-full edge if SPSC FIFO buffer is full. Producer side only.
+ *	Clears a pending edge of space_fd, so it is also the acknowledge after epoll reported it.
+ *
+ *	@param event - pointer to the event state
+ *	@param ring - pointer to the SPSC ring state
+ *
+ *	@retval returns: 0 - FIFO buffer full and space_fd armed, wait for it
+ *					 1 - FIFO buffer has place, keep pushing
+ *					-1 - event pointer is NULL
+ *					-2 - ring pointer is NULL
+ */
+int fifo_event_arm_space(fifo_event_TD *event, fifo_spsc_ring_TD *ring)
+{
+	if(event == NULL) return -1; /* event pointer NULL */
+	if(ring == NULL) return -2; /* ring pointer NULL */
+
+	return fifo_event_arm(event->space_fd, &event->space_armed, ring, true);
+}
+
+/**
+ *	@brief Signals data_fd if the consumer armed it. Producer side only.
+ *	Must be called after every push/commit done with plain SPSC functions.
+ *
+ *	@param event - pointer to the event state
+ */
+void fifo_event_notify_data(fifo_event_TD *event)
+{
+	if(event == NULL) return; /* event pointer NULL */
+
+	fifo_event_signal(event->data_fd, &event->data_armed);
+}
+
+/**
+ *	@brief Signals space_fd if the producer armed it. Consumer side only.
+ *	Must be called after every pop/release done with plain SPSC functions.
+ *
+ *	@param event - pointer to the event state
+ */
+void fifo_event_notify_space(fifo_event_TD *event)
+{
+	if(event == NULL) return; /* event pointer NULL */
+
+	fifo_event_signal(event->space_fd, &event->space_armed);
+}
+
+/**
+ *	@brief Pops m entries from SPSC FIFO buffer and signals space_fd if the producer armed it. Consumer side only.
+ *
+ *	@param event - pointer to the event state
+ *	@param ring - pointer to the SPSC ring state
+ *	@param buffer - pointer to buffer that stores values
+ *	@param pop_buffer - pointer to the buffer into which the values will be popped
+ *	@param m - amount of entries to be popped
+ *
+ *	@retval returns:	0 - all of the m entries was popped
+ *					-1 - event or ring pointer is NULL
+ *					-2 - buffer or pop buffer pointer is NULL
+ *					-3 - amount of the entries to be popped is zero
+ *					-4 - FIFO buffer current size lower than m
+ */
+int fifo_event_pop(fifo_event_TD *event, fifo_spsc_ring_TD *ring, const void *buffer, void *pop_buffer, fifo_size_t m)
+{
+	int result = 0;
+
+	if((event == NULL) || (ring == NULL)) return -1; /* pointer NULL */
+
+	result = fifo_spsc_ring_pop_mul(ring, buffer, pop_buffer, m);
+	if(result == 0) fifo_event_signal(event->space_fd, &event->space_armed);
+
+	return result;
+}
+
+/**
+ *	@brief Pops as many of m entries as SPSC FIFO buffer holds and signals space_fd if the producer armed it. Consumer side only.
+ *
+ *	@param event - pointer to the event state
+ *	@param ring - pointer to the SPSC ring state
+ *	@param buffer - pointer to buffer that stores values
+ *	@param pop_buffer - pointer to the buffer into which the values will be popped
+ *	@param m - maximal amount of entries to be popped
+ *
+ *	@retval returns: amount of entries popped, 0 if FIFO buffer is empty or any pointer is NULL
+ */
+fifo_size_t fifo_event_read_some(fifo_event_TD *event, fifo_spsc_ring_TD *ring, const void *buffer, void *pop_buffer, fifo_size_t m)
+{
+	fifo_size_t n = 0;
+
+	if((event == NULL) || (ring == NULL)) return 0; /* pointer NULL */
+
+	n = fifo_spsc_ring_read_some(ring, buffer, pop_buffer, m);
+	if(n != 0) fifo_event_signal(event->space_fd, &event->space_armed);
+
+	return n;
+}
+
+/**
+ *	@brief Pushes m entries into SPSC FIFO buffer and signals data_fd if the consumer armed it. Producer side only.
+ *
+ *	@param event - pointer to the event state
+ *	@param ring - pointer to the SPSC ring state
+ *	@param buffer - pointer to buffer that stores values
+ *	@param push_buffer - pointer to the buffer from which the values will be pushed
+ *	@param m - amount of entries to be pushed
+ *
+ *	@retval returns:	0 - all of the m entries was pushed
+ *					-1 - event or ring pointer is NULL
+ *					-2 - buffer or push buffer pointer is NULL
+ *					-3 - amount of the entries to be pushed is zero
+ *					-4 - no place for m element in FIFO buffer
+ */
+int fifo_event_push(fifo_event_TD *event, fifo_spsc_ring_TD *ring, void *buffer, const void *push_buffer, fifo_size_t m)
+{
+	int result = 0;
+
+	if((event == NULL) || (ring == NULL)) return -1; /* pointer NULL */
+
+	result = fifo_spsc_ring_push_mul(ring, buffer, push_buffer, m);
+	if(result == 0) fifo_event_signal(event->data_fd, &event->data_armed);
+
+	return result;
+}
+
+/**
+ *	@brief Pushes as many of m entries as fit into SPSC FIFO buffer and signals data_fd if the consumer armed it. Producer side only.
+ *
+ *	@param event - pointer to the event state
+ *	@param ring - pointer to the SPSC ring state
+ *	@param buffer - pointer to buffer that stores values
+ *	@param push_buffer - pointer to the buffer from which the values will be pushed
+ *	@param m - maximal amount of entries to be pushed
+ *
+ *	@retval returns: amount of entries pushed, 0 if FIFO buffer is full or any pointer is NULL
+ */
+fifo_size_t fifo_event_write_some(fifo_event_TD *event, fifo_spsc_ring_TD *ring, void *buffer, const void *push_buffer, fifo_size_t m)
+{
+	fifo_size_t n = 0;
+
+	if((event == NULL) || (ring == NULL)) return 0; /* pointer NULL */
+
+	n = fifo_spsc_ring_write_some(ring, buffer, push_buffer, m);
+	if(n != 0) fifo_event_signal(event->data_fd, &event->data_armed);
+
+	return n;
+}
+
+/**
+* 	@}
+*/
+
+/**
+* 	@}
+*/
+
+#endif /* __linux__ */
@@ -0,0 +1,54 @@
+/**
+ * 	@file fifo_event.h
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  eventfd notification layer on top of SPSC FIFO buffers (Linux).
+ *  data_fd becomes readable on the empty -> non-empty edge and space_fd on the full -> not-full edge,
+ *  so a consumer or producer may sit in an epoll/select/io_uring loop next to sockets.
+ *  An edge is signaled only if the waiting side armed it, i.e. saw the FIFO empty (full) and
+ *  called fifo_event_arm_data (fifo_event_arm_space); one eventfd write covers any amount of
+ *  pushes (pops) until the next arm. The notifying side pays one fence and one load when not armed.
+ *
+ *  Consumer loop:
+ *  	on data_fd readable: pop with fifo_event_pop/fifo_event_read_some until it gives nothing,
+ *  	then if fifo_event_arm_data() returns 0 go back to epoll_wait, if it returns 1 keep popping.
+ *  Producer loop is the same with push functions, space_fd and fifo_event_arm_space().
+ */
+
+#ifndef FIFO_EVENT_H_
+#define FIFO_EVENT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "fifo_config.h"
+#include "fifo_spsc.h"
+
+/**
+* 	@brief	Event state of one SPSC FIFO buffer.
+*/
+typedef struct
+{
+	int data_fd;					/**< eventfd readable when entries arrived after the consumer armed it */
+	int space_fd;					/**< eventfd readable when place was freed after the producer armed it */
+
+	_Atomic uint32_t data_armed;	/**< 1 while the consumer waits on data_fd */
+	_Atomic uint32_t space_armed;	/**< 1 while the producer waits on space_fd */
+
+}fifo_event_TD;
+
+int fifo_event_init(fifo_event_TD *event);
+int fifo_event_deinit(fifo_event_TD *event);
+int fifo_event_arm_data(fifo_event_TD *event, fifo_spsc_ring_TD *ring);
+int fifo_event_arm_space(fifo_event_TD *event, fifo_spsc_ring_TD *ring);
+void fifo_event_notify_data(fifo_event_TD *event);
+void fifo_event_notify_space(fifo_event_TD *event);
+int fifo_event_pop(fifo_event_TD *event, fifo_spsc_ring_TD *ring, const void *buffer, void *pop_buffer, fifo_size_t m);
+fifo_size_t fifo_event_read_some(fifo_event_TD *event, fifo_spsc_ring_TD *ring, const void *buffer, void *pop_buffer, fifo_size_t m);
+int fifo_event_push(fifo_event_TD *event, fifo_spsc_ring_TD *ring, void *buffer, const void *push_buffer, fifo_size_t m);
+fifo_size_t fifo_event_write_some(fifo_event_TD *event, fifo_spsc_ring_TD *ring, void *buffer, const void *push_buffer, fifo_size_t m);
+
+#endif /* FIFO_EVENT_H_ */
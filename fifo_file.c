@@ -0,0 +1,603 @@
+/**
+ * 	@file fifo_file.c
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Implementation of persistent SPSC FIFO buffers in a memory-mapped file.
+ *  Alert: Linux only, push functions and fifo_file_sync must be called from a single producer context
+ *  and pop functions from a single consumer context.
+ *
+ */
+
+#if defined(__linux__)
+
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "fifo_file.h"
+
+/**
+*	@addtogroup Software_FIFO_buffer Software FIFO buffers
+* 	@{
+*/
+
+/**
+*	@addtogroup file_FIFO_buffer persistent file FIFO buffer
+* 	@{
+*/
+
+/**
+ *	@brief Returns FNV-1a checksum of bytes.
+ */
+static uint32_t fifo_file_fnv(const void *data, size_t bytes)
+{
+	const uint8_t *p = data;
+	uint32_t hash = 2166136261u;
+	size_t i = 0;
+
+	for(i = 0; i < bytes; i++)
+	{
+		hash ^= p[i];
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+/**
+ *	@brief Returns checksum of the geometry fields of the header.
+ */
+static inline uint32_t fifo_file_header_sum(const fifo_file_header_TD *header)
+{
+	return fifo_file_fnv(header, offsetof(fifo_file_header_TD, header_sum));
+}
+
+/**
+ *	@brief Returns checksum of a pair of synced indices.
+ */
+static inline uint32_t fifo_file_sync_sum(fifo_index_t head, fifo_index_t tail)
+{
+	fifo_index_t pair[2];
+
+	pair[0] = head;
+	pair[1] = tail;
+
+	return fifo_file_fnv(pair, sizeof(pair));
+}
+
+/**
+ *	@brief Returns system page size.
+ */
+static inline size_t fifo_file_page(void)
+{
+	long page = sysconf(_SC_PAGESIZE);
+
+	return ((page > 0) ? (size_t)page : 4096);
+}
+
+/**
+ *	@brief Returns offset of the entries from the file start, the header rounded up to a page.
+ */
+static inline size_t fifo_file_data_offset(void)
+{
+	size_t page = fifo_file_page();
+
+	return (((sizeof(fifo_file_header_TD) + (page - 1)) / page) * page);
+}
+
+/**
+ *	@brief msyncs Bytes of the mapping starting at ptr, the start is rounded down to a page.
+ */
+static int fifo_file_msync(const fifo_file_TD *fifo, const uint8_t *ptr, size_t bytes)
+{
+	const uint8_t *base = (const uint8_t *)fifo->header;
+	size_t start = (size_t)(ptr - base);
+	size_t page_start = (start - (start % fifo_file_page()));
+
+	if(bytes == 0) return 0;
+	if(msync((void *)(base + page_start), ((start - page_start) + bytes), MS_SYNC) != 0) return -6; /* msync failed */
+
+	return 0;
+}
+
+/**
+ *	@brief Maps size Bytes of fd shared, returns NULL on failure.
+ */
+static inline void *fifo_file_map(int fd, size_t size)
+{
+	void *area = mmap(NULL, size, (PROT_READ | PROT_WRITE), MAP_SHARED, fd, 0);
+
+	return ((area == MAP_FAILED) ? NULL : area);
+}
+
+/**
+ *	@brief Returns true when the file holds no header yet: its first header Bytes are all zero, as ftruncate
+ *	leaves them when the creating fifo_file_open stopped before fifo_file_format wrote the header.
+ */
+static bool fifo_file_blank(int fd, size_t file_size)
+{
+	uint8_t head[sizeof(fifo_file_header_TD)];
+	size_t bytes = ((file_size < sizeof(head)) ? file_size : sizeof(head));
+	size_t i = 0;
+
+	if(pread(fd, head, bytes, 0) != (ssize_t)bytes) return false; /* unreadable, left to recovery */
+
+	for(i = 0; i < bytes; i++)
+	{
+		if(head[i] != 0) return false; /* written by someone */
+	}
+
+	return true;
+}
+
+/**
+ *	@brief Formats a freshly sized file mapping as an empty FIFO buffer and makes it durable.
+ *	The header is built aside and written with one pwrite, so a crash leaves it either complete or all zero.
+ */
+static int fifo_file_format(int fd, fifo_file_header_TD *area, size_t file_size, fifo_size_t size, uint16_t entry_size)
+{
+	fifo_file_header_TD header;
+	int result = 0;
+
+	memset(&header, 0, sizeof(header));
+
+	result = fifo_spsc_ring_init(&header.ring, size, entry_size);
+	if(result != 0) return result;
+
+	header.magic = FIFO_FILE_MAGIC;
+	header.version = FIFO_FILE_VERSION;
+	header.layout = FIFO_FILE_LAYOUT;
+	header.ring_size = (uint32_t)sizeof(fifo_spsc_ring_TD);
+	header.data_offset = fifo_file_data_offset();
+	header.file_size = file_size;
+	header.header_sum = fifo_file_header_sum(&header);
+	header.sync_head = 0;
+	header.sync_tail = 0;
+	header.sync_sum = fifo_file_sync_sum(0, 0);
+
+	if(pwrite(fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header)) return -6; /* write failed */
+	if(msync(area, header.data_offset, MS_SYNC) != 0) return -6; /* msync failed */
+
+	return 0;
+}
+
+/**
+ *	@brief Validates the header of a reopened file mapping and restores the indices, O(1).
+ */
+static int fifo_file_recover(fifo_file_header_TD *header, size_t file_size, fifo_size_t size, uint16_t entry_size, uint8_t recover)
+{
+	fifo_index_t head = 0;
+	fifo_index_t tail = 0;
+
+	if(file_size < sizeof(fifo_file_header_TD)) return -5; /* not a FIFO file */
+	if(header->magic != FIFO_FILE_MAGIC) return -5; /* not a FIFO file */
+	if(header->header_sum != fifo_file_header_sum(header)) return -5; /* corrupted header */
+	if((header->version != FIFO_FILE_VERSION) || (header->layout != FIFO_FILE_LAYOUT)) return -5; /* other layout */
+	if(header->ring_size != (uint32_t)sizeof(fifo_spsc_ring_TD)) return -5; /* other layout */
+	if((header->data_offset < sizeof(fifo_file_header_TD)) || ((header->data_offset % fifo_file_page()) != 0)) return -5; /* other layout */
+	if(header->file_size != file_size) return -5; /* truncated file */
+	if((header->ring.max_size != size) || (header->ring.entry_size != entry_size)) return -5; /* other geometry */
+	if((header->data_offset + ((size_t)size * entry_size)) > file_size) return -5; /* corrupted sizes */
+
+	if(recover == FIFO_FILE_RECOVER_SYNCED)
+	{
+		head = header->sync_head;
+		tail = header->sync_tail;
+
+		if(header->sync_sum != fifo_file_sync_sum(head, tail)) return -5; /* corrupted sync indices */
+	}
+	else
+	{
+		head = atomic_load_explicit(&header->ring.head, memory_order_relaxed);
+		tail = atomic_load_explicit(&header->ring.tail, memory_order_relaxed);
+	}
+
+	if(!fifo_spsc_ring_indices_valid(head, tail, size)) return -5; /* corrupted indices */
+
+	header->ring.head_cache = head;
+	header->ring.tail_cache = tail;
+	atomic_store_explicit(&header->ring.head, head, memory_order_relaxed);
+	atomic_store_explicit(&header->ring.tail, tail, memory_order_release);
+	FIFO_STATS_INIT(&header->ring.stats);
+
+	return 0;
+}
+
+/**
+ *	@brief Returns true when the synced indices of the header are intact and equal to the live ones, so the
+ *	next sync may flush only past sync_tail. Live indices ahead of them after a crash may cover entries of
+ *	any amount of laps that are dirty in the page cache only, then the first sync flushes all entries.
+ */
+static inline bool fifo_file_sync_valid(const fifo_file_header_TD *header)
+{
+	if(header->sync_sum != fifo_file_sync_sum(header->sync_head, header->sync_tail)) return false;
+	if(atomic_load_explicit(&header->ring.head, memory_order_relaxed) != header->sync_head) return false;
+	if(atomic_load_explicit(&header->ring.tail, memory_order_relaxed) != header->sync_tail) return false;
+
+	return fifo_spsc_ring_indices_valid(header->sync_head, header->sync_tail, header->ring.max_size);
+}
+
+/**
+ *	@brief Gives size in Bytes of a file holding persistent FIFO buffer of size entries of entry_size Bytes.
+ *
+ *	@param size - size of FIFO buffer
+ *	@param entry_size - size of an entry of FIFO buffer
+ *
+ *	@retval returns: size of the file in Bytes, 0 if size or entry_size is 0
+ */
+size_t fifo_file_size(fifo_size_t size, uint16_t entry_size)
+{
+	if((size == 0) || (entry_size == 0)) return 0; /* zero size */
+
+	return (fifo_file_data_offset() + ((size_t)size * entry_size));
+}
+
+/**
+ *	@brief Opens the FIFO file path, recovers its entries if it is a valid FIFO file or creates it empty.
+ *	An existing file whose header is all zero, left by a crash before it was formatted, is formatted again.
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param path - path of the file
+ *	@param size - size of FIFO buffer, must match a recovered file
+ *	@param entry_size - size of an entry of FIFO buffer, must match a recovered file
+ *	@param sync_every - entries pushed between automatic fifo_file_sync calls, 0 - explicit syncs only
+ *	@param recover - FIFO_FILE_RECOVER_LIVE or FIFO_FILE_RECOVER_SYNCED
+ *
+ *	@retval returns: 0 - FIFO file created or recovered successfully, see fifo->recovered
+ *					-1 - fifo pointer is NULL
+ *					-2 - path pointer is NULL
+ *					-3 - size of FIFO buffer is 0 or larger than FIFO_SPSC_MAX_SIZE, or unknown recover mode
+ *					-4 - size of entry is 0
+ *					-5 - file is not a FIFO file of this geometry and layout, or corrupted; it is left untouched (an all-zero header is not rejected but formatted)
+ *					-6 - open, fstat, ftruncate, mmap or msync failed, errno is left as set by them
+ */
+int fifo_file_open(fifo_file_TD *fifo, const char *path, fifo_size_t size, uint16_t entry_size, fifo_size_t sync_every, uint8_t recover)
+{
+	struct stat st;
+	size_t bytes = fifo_file_size(size, entry_size);
+	void *area = NULL;
+	int fd = -1;
+	int result = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(path == NULL) return -2; /* path pointer NULL */
+	if(entry_size == 0) return -4; /* zero entry size */
+	if(size == 0) return -3; /* zero size */
+	if((recover != FIFO_FILE_RECOVER_LIVE) && (recover != FIFO_FILE_RECOVER_SYNCED)) return -3; /* unknown recover mode */
+
+	fd = open(path, (O_RDWR | O_CREAT | O_CLOEXEC), FIFO_FILE_MODE);
+	if(fd < 0) return -6; /* file not opened */
+
+	if(fstat(fd, &st) != 0)
+	{
+		close(fd);
+		return -6; /* stat failed */
+	}
+
+	fifo->recovered = ((st.st_size != 0) && !fifo_file_blank(fd, (size_t)st.st_size)); /* a blank file was never formatted */
+
+	if(fifo->recovered == false)
+	{
+		if(ftruncate(fd, (off_t)bytes) != 0)
+		{
+			close(fd);
+			return -6; /* no space */
+		}
+	}
+	else
+	{
+		bytes = (size_t)st.st_size;
+	}
+
+	area = fifo_file_map(fd, bytes);
+
+	if(area == NULL)
+	{
+		close(fd);
+		return -6; /* mapping failed */
+	}
+
+	if(fifo->recovered == false) result = fifo_file_format(fd, area, bytes, size, entry_size);
+	else result = fifo_file_recover(area, bytes, size, entry_size, recover);
+
+	if(result != 0)
+	{
+		munmap(area, bytes);
+		close(fd);
+		return result;
+	}
+
+	fifo->header = area;
+	fifo->buffer = ((uint8_t *)area + fifo->header->data_offset);
+	fifo->map_size = bytes;
+	fifo->fd = fd;
+	fifo->sync_every = sync_every;
+	fifo->recover = recover;
+	fifo->unsynced = (fifo_file_sync_valid(fifo->header) ? 0 : FIFO_SIZE_MAX); /* flush all entries on the first sync */
+
+	return 0;
+}
+
+/**
+ *	@brief Makes entries pushed and popped so far durable. Producer side only.
+ *	msyncs the entries written since the previous sync first, then records the indices as synced
+ *	and msyncs the header, so the synced tail is never ahead of the entries on disk.
+ *
+ *	@param fifo - pointer to the local handle
+ *
+ *	@retval returns: 0 - synced successfully
+ *					-1 - fifo pointer is NULL or not open
+ *					-6 - msync failed, errno is left as set by it
+ */
+int fifo_file_sync(fifo_file_TD *fifo)
+{
+	fifo_file_header_TD *header = NULL;
+	fifo_index_t head = 0;
+	fifo_index_t tail = 0;
+	fifo_index_t pos = 0;
+	fifo_index_t n = 0;
+	fifo_index_t first = 0;
+	size_t entry_size = 0;
+
+	if((fifo == NULL) || (fifo->header == NULL)) return -1; /* not open */
+
+	header = fifo->header;
+	entry_size = header->ring.entry_size;
+	tail = atomic_load_explicit(&header->ring.tail, memory_order_acquire);
+	head = atomic_load_explicit(&header->ring.head, memory_order_acquire);
+
+	if(fifo->unsynced >= header->ring.max_size)
+	{
+		if(fifo_file_msync(fifo, fifo->buffer, ((size_t)header->ring.max_size * entry_size)) != 0) return -6; /* msync failed */
+	}
+	else
+	{
+		n = fifo_spsc_ring_distance(header->sync_tail, tail, header->ring.max_size);
+		pos = ((header->sync_tail >= header->ring.max_size) ? (header->sync_tail - header->ring.max_size) : header->sync_tail);
+		first = (header->ring.max_size - pos);
+
+		if(n > first)
+		{
+			if(fifo_file_msync(fifo, (fifo->buffer + (pos * entry_size)), (first * entry_size)) != 0) return -6; /* msync failed */
+			if(fifo_file_msync(fifo, fifo->buffer, ((n - first) * entry_size)) != 0) return -6; /* msync failed */
+		}
+		else
+		{
+			if(fifo_file_msync(fifo, (fifo->buffer + (pos * entry_size)), (n * entry_size)) != 0) return -6; /* msync failed */
+		}
+	}
+
+	header->sync_head = head;
+	header->sync_tail = tail;
+	header->sync_sum = fifo_file_sync_sum(head, tail);
+
+	if(msync(header, header->data_offset, MS_SYNC) != 0) return -6; /* msync failed */
+
+	fifo->unsynced = 0;
+
+	return 0;
+}
+
+/**
+ *	@brief Syncs and closes the FIFO file, its entries stay in the file for the next fifo_file_open.
+ *
+ *	@param fifo - pointer to the local handle
+ *
+ *	@retval returns: 0 - closed successfully
+ *					-1 - fifo pointer is NULL or not open
+ *					-6 - final msync failed, the file is closed anyway
+ */
+int fifo_file_close(fifo_file_TD *fifo)
+{
+	int result = 0;
+
+	if((fifo == NULL) || (fifo->header == NULL)) return -1; /* not open */
+
+	result = fifo_file_sync(fifo);
+
+	munmap(fifo->header, fifo->map_size);
+	close(fifo->fd);
+
+	fifo->header = NULL;
+	fifo->buffer = NULL;
+	fifo->map_size = 0;
+	fifo->fd = -1;
+
+	return result;
+}
+
+/**
+ *	@brief Counts pushed entries and syncs when sync_every is reached. Producer side only.
+ */
+static inline void fifo_file_pushed(fifo_file_TD *fifo, fifo_size_t n)
+{
+	fifo->unsynced = ((fifo->unsynced > (FIFO_SIZE_MAX - n)) ? FIFO_SIZE_MAX : (fifo->unsynced + n));
+
+	if(fifo->sync_every == 0) return; /* explicit syncs only */
+	if(fifo->unsynced >= fifo->sync_every) (void)fifo_file_sync(fifo); /* a failed sync keeps unsynced, it is retried and reported by the next one */
+}
+
+/**
+ *	@brief Gives how many of m entries may be pushed, producer side only. With FIFO_FILE_RECOVER_SYNCED
+ *	the free place counts from the synced head, the slots of entries popped after the last sync still
+ *	hold what a synced recovery delivers again; when m does not fit the FIFO file is synced first.
+ */
+static fifo_size_t fifo_file_room(fifo_file_TD *fifo, fifo_size_t m)
+{
+	fifo_file_header_TD *header = fifo->header;
+	fifo_index_t tail = 0;
+	fifo_index_t room = 0;
+
+	if(fifo->recover != FIFO_FILE_RECOVER_SYNCED) return m; /* live recovery, the ring checks the free place */
+
+	tail = atomic_load_explicit(&header->ring.tail, memory_order_relaxed);
+	room = (header->ring.max_size - fifo_spsc_ring_distance(header->sync_head, tail, header->ring.max_size));
+
+	if(m > room)
+	{
+		(void)fifo_file_sync(fifo); /* a failed sync keeps the synced head, the push is then limited by it */
+		room = (header->ring.max_size - fifo_spsc_ring_distance(header->sync_head, tail, header->ring.max_size));
+	}
+
+	return ((m > room) ? (fifo_size_t)room : m);
+}
+
+/**
+ *	@brief Gives amount of entries stored in FIFO file, may be called from either side.
+ *
+ *	@param fifo - pointer to the local handle
+ *
+ *	@retval returns: amount of entries in FIFO buffer, 0 if fifo pointer is NULL or not open
+ */
+fifo_size_t fifo_file_count(fifo_file_TD *fifo)
+{
+	if((fifo == NULL) || (fifo->header == NULL)) return 0; /* not open */
+
+	return fifo_spsc_ring_count(&fifo->header->ring);
+}
+
+/**
+ *	@brief Pops value from FIFO file. Consumer side only.
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param val_buffer - pointer to value store buffer
+ *
+ *	@retval returns: 0 - head popped successfully
+ *					-1 - fifo pointer is NULL or not open
+ *					-2 - value buffer pointer is NULL
+ *					-3 - FIFO buffer empty
+ */
+int fifo_file_pop(fifo_file_TD *fifo, void *val_buffer)
+{
+	if((fifo == NULL) || (fifo->header == NULL)) return -1; /* fifo pointer NULL */
+	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
+	if(fifo_spsc_ring_pop_mul(&fifo->header->ring, fifo->buffer, val_buffer, 1) != 0) return -3; /* fifo empty */
+
+	return 0;
+}
+
+/**
+ *	@brief Pops m entries from FIFO file. Consumer side only.
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param pop_buffer - pointer to the buffer into which the values will be popped
+ *	@param m - amount of entries to be popped
+ *
+ *	@retval returns:	0 - all of the m entries was popped
+ *					-1 - fifo pointer is NULL or not open
+ *					-2 - pop buffer pointer is NULL
+ *					-3 - amount of the entries to be popped is zero
+ *					-4 - FIFO buffer current size lower than m
+ */
+int fifo_file_pop_mul(fifo_file_TD *fifo, void *pop_buffer, fifo_size_t m)
+{
+	if((fifo == NULL) || (fifo->header == NULL)) return -1; /* fifo pointer NULL */
+
+	return fifo_spsc_ring_pop_mul(&fifo->header->ring, fifo->buffer, pop_buffer, m);
+}
+
+/**
+ *	@brief Pops as many of m entries as FIFO file holds. Consumer side only.
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param pop_buffer - pointer to the buffer into which the values will be popped
+ *	@param m - maximal amount of entries to be popped
+ *
+ *	@retval returns: amount of entries popped, 0 if FIFO buffer is empty or any pointer is NULL
+ */
+fifo_size_t fifo_file_read_some(fifo_file_TD *fifo, void *pop_buffer, fifo_size_t m)
+{
+	if((fifo == NULL) || (fifo->header == NULL)) return 0; /* fifo pointer NULL */
+
+	return fifo_spsc_ring_read_some(&fifo->header->ring, fifo->buffer, pop_buffer, m);
+}
+
+/**
+ *	@brief Pushes value into FIFO file. Producer side only.
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param val_buffer - value buffer to push
+ *
+ *	@retval returns: 0 - tail pushed successfully
+ *					-1 - fifo pointer is NULL or not open
+ *					-2 - value buffer pointer is NULL
+ *					-3 - FIFO buffer full, with FIFO_FILE_RECOVER_SYNCED also when the sync releasing popped slots failed
+ */
+int fifo_file_push(fifo_file_TD *fifo, const void *val_buffer)
+{
+	if((fifo == NULL) || (fifo->header == NULL)) return -1; /* fifo pointer NULL */
+	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
+	if(fifo_file_room(fifo, 1) == 0) return -3; /* synced entries would be overwritten */
+	if(fifo_spsc_ring_push_mul(&fifo->header->ring, fifo->buffer, val_buffer, 1) != 0) return -3; /* fifo full */
+
+	fifo_file_pushed(fifo, 1);
+
+	return 0;
+}
+
+/**
+ *	@brief Pushes m entries into FIFO file. Producer side only.
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param push_buffer - pointer to the buffer from which the values will be pushed
+ *	@param m - amount of entries to be pushed
+ *
+ *	@retval returns:	0 - all of the m entries was pushed
+ *					-1 - fifo pointer is NULL or not open
+ *					-2 - push buffer pointer is NULL
+ *					-3 - amount of the entries to be pushed is zero
+ *					-4 - no place for m element in FIFO buffer, with FIFO_FILE_RECOVER_SYNCED also when the sync releasing popped slots failed
+ */
+int fifo_file_push_mul(fifo_file_TD *fifo, const void *push_buffer, fifo_size_t m)
+{
+	int result = 0;
+
+	if((fifo == NULL) || (fifo->header == NULL)) return -1; /* fifo pointer NULL */
+	if(push_buffer == NULL) return -2; /* push buffer pointer NULL */
+	if(m == 0) return -3; /* zero m */
+	if(fifo_file_room(fifo, m) < m) return -4; /* synced entries would be overwritten */
+
+	result = fifo_spsc_ring_push_mul(&fifo->header->ring, fifo->buffer, push_buffer, m);
+	if(result == 0) fifo_file_pushed(fifo, m);
+
+	return result;
+}
+
+/**
+ *	@brief Pushes as many of m entries as fit into FIFO file. Producer side only.
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param push_buffer - pointer to the buffer from which the values will be pushed
+ *	@param m - maximal amount of entries to be pushed
+ *
+ *	@retval returns: amount of entries pushed, 0 if FIFO buffer is full or any pointer is NULL
+ */
+fifo_size_t fifo_file_write_some(fifo_file_TD *fifo, const void *push_buffer, fifo_size_t m)
+{
+	fifo_size_t n = 0;
+
+	if((fifo == NULL) || (fifo->header == NULL) || (push_buffer == NULL)) return 0; /* pointer NULL */
+
+	m = fifo_file_room(fifo, m);
+	if(m == 0) return 0; /* synced entries would be overwritten */
+
+	n = fifo_spsc_ring_write_some(&fifo->header->ring, fifo->buffer, push_buffer, m);
+	if(n != 0) fifo_file_pushed(fifo, n);
+
+	return n;
+}
+
+/**
+* 	@}
+*/
+
+/**
+* 	@}
+*/
+
+#endif /* __linux__ */
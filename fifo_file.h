@@ -0,0 +1,118 @@
+/**
+ * 	@file fifo_file.h
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Persistent SPSC FIFO buffers in a memory-mapped file (Linux).
+ *  The file starts with a header that holds the geometry, an FNV-1a checksum of it and the SPSC ring
+ *  state (indices only), followed by the entries at a page aligned data_offset. Push and pop work on the
+ *  shared file mapping like fifo_shm, the tail is stored after the entries and the head after they
+ *  were consumed, so a process that crashes leaves a consistent FIFO in the page cache and reopening
+ *  validates the header and the two indices only: recovery is O(1), nothing is scanned or replayed.
+ *
+ *  Durability against OS crash or power loss is batched: fifo_file_sync() msyncs the entries written
+ *  since the previous sync, then records the indices as synced with their own checksum and msyncs the
+ *  header page. Push functions call it every sync_every entries (0 - only explicit fifo_file_sync).
+ *  Opening with FIFO_FILE_RECOVER_SYNCED rolls back to the synced indices, which are never ahead of
+ *  the entries on disk; entries popped after the last sync are then delivered again (at least once).
+ *  In this mode the producer never overwrites entries from the synced head on: a push that would reach
+ *  them syncs first, so the popped ones are released, and is rejected if they are still stored.
+ *
+ *  Alert: push functions and fifo_file_sync from a single producer context, pop functions from a
+ *  single consumer context. The file must be reopened by a build with the same FIFO_SIZE_BITS,
+ *  FIFO_SPSC_CACHE_ALIGNED and FIFO_STATS.
+ */
+
+#ifndef FIFO_FILE_H_
+#define FIFO_FILE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "fifo_config.h"
+#include "fifo_spsc.h"
+
+/**
+* 	@brief	Value of the header magic word of a formatted file ("FIFP").
+*/
+#define FIFO_FILE_MAGIC				0x46494650u
+
+/**
+* 	@brief	Version of the file layout.
+*/
+#define FIFO_FILE_VERSION			1u
+
+/**
+* 	@brief	Build options the ring state layout depends on, checked on reopen.
+*/
+#define FIFO_FILE_LAYOUT			((uint32_t)FIFO_SIZE_BITS | ((uint32_t)FIFO_SPSC_CACHE_ALIGNED << 8) | ((uint32_t)FIFO_STATS << 9))
+
+/**
+* 	@brief	Access mode of files created by fifo_file_open().
+*/
+#ifndef FIFO_FILE_MODE
+#define FIFO_FILE_MODE				0600
+#endif
+
+/**
+* 	@brief	Recovery modes of fifo_file_open().
+*/
+#define FIFO_FILE_RECOVER_LIVE		0	/**< Keep the indices as left by the previous process, survives process crashes */
+#define FIFO_FILE_RECOVER_SYNCED	1	/**< Roll back to the indices of the last fifo_file_sync, survives power loss */
+
+/**
+* 	@brief	Header at the start of a FIFO file.
+*/
+typedef struct
+{
+	uint32_t magic;					/**< FIFO_FILE_MAGIC */
+	uint32_t version;				/**< FIFO_FILE_VERSION of the creator */
+	uint32_t layout;				/**< FIFO_FILE_LAYOUT of the creator */
+	uint32_t ring_size;				/**< sizeof(fifo_spsc_ring_TD) of the creator */
+	uint64_t data_offset;			/**< Offset of the entries from the file start in Bytes, page aligned */
+	uint64_t file_size;				/**< Size of the file in Bytes */
+	uint32_t header_sum;			/**< FNV-1a checksum of the fields above */
+
+	uint32_t sync_sum;				/**< FNV-1a checksum of sync_head and sync_tail */
+	fifo_index_t sync_head;			/**< Head index at the last fifo_file_sync */
+	fifo_index_t sync_tail;			/**< Tail index at the last fifo_file_sync, entries before it are on disk */
+
+	fifo_spsc_ring_TD ring;			/**< SPSC ring state: sizes and live head/tail indices */
+
+}fifo_file_header_TD;
+
+/**
+* 	@brief	Process-local handle of a FIFO file.
+*/
+typedef struct
+{
+	fifo_file_header_TD *header;	/**< Local address of the file header */
+	uint8_t *buffer;				/**< Local address of the entries */
+	size_t map_size;				/**< Size of the mapping in Bytes */
+	int fd;							/**< File descriptor of the FIFO file */
+
+	fifo_size_t sync_every;			/**< Entries pushed between automatic syncs, 0 - explicit syncs only */
+	fifo_size_t unsynced;			/**< Entries pushed since the last sync */
+	uint8_t recover;				/**< Recovery mode the file was opened with */
+	bool recovered;					/**< true when fifo_file_open found a valid FIFO file */
+
+}fifo_file_TD;
+
+size_t fifo_file_size(fifo_size_t size, uint16_t entry_size);
+int fifo_file_open(fifo_file_TD *fifo, const char *path, fifo_size_t size, uint16_t entry_size, fifo_size_t sync_every, uint8_t recover);
+int fifo_file_sync(fifo_file_TD *fifo);
+int fifo_file_close(fifo_file_TD *fifo);
+
+fifo_size_t fifo_file_count(fifo_file_TD *fifo);
+int fifo_file_pop(fifo_file_TD *fifo, void *val_buffer);
+int fifo_file_pop_mul(fifo_file_TD *fifo, void *pop_buffer, fifo_size_t m);
+fifo_size_t fifo_file_read_some(fifo_file_TD *fifo, void *pop_buffer, fifo_size_t m);
+int fifo_file_push(fifo_file_TD *fifo, const void *val_buffer);
+int fifo_file_push_mul(fifo_file_TD *fifo, const void *push_buffer, fifo_size_t m);
+fifo_size_t fifo_file_write_some(fifo_file_TD *fifo, const void *push_buffer, fifo_size_t m);
+
+#endif /* FIFO_FILE_H_ */
@@ -0,0 +1,333 @@
+/**
+ * 	@file fifo_group.c
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Implementation of priority groups of common FIFO buffers.
+ *  Alert: not thread-safe, push into members through group functions or call fifo_group_refresh()
+ *
+ */
+
+#include "fifo_group.h"
+
+/**
+*	@addtogroup Software_FIFO_buffer Software FIFO buffers
+* 	@{
+*/
+
+/**
+*	@addtogroup group_FIFO_buffer FIFO buffer group
+* 	@{
+*/
+
+/**
+ *	@brief Returns index of the lowest set bit of a non-zero mask.
+ */
+static inline uint8_t fifo_group_ctz(uint32_t mask)
+{
+#if defined(__GNUC__)
+	return (uint8_t)__builtin_ctz(mask);
+#else
+	uint8_t i = 0;
+
+	while((mask & 1u) == 0)
+	{
+		mask >>= 1;
+		i++;
+	}
+
+	return i;
+#endif
+}
+
+/**
+ *	@brief Starts a new round of weighted round-robin, every member gets its weight as credit.
+ */
+static void fifo_group_new_round(fifo_group_TD *group)
+{
+	uint32_t bits = group->members;
+	uint8_t i = 0;
+
+	while(bits != 0)
+	{
+		i = fifo_group_ctz(bits);
+		group->credit[i] = group->weight[i];
+		bits &= (bits - 1);
+	}
+
+	group->round = group->members;
+}
+
+/**
+ *	@brief Picks the member to pop from, returns -3 when all members are empty.
+ */
+static int fifo_group_pick(fifo_group_TD *group)
+{
+	uint32_t eligible = group->ready;
+
+	if(eligible == 0) return -3; /* group empty */
+
+	if(group->mode == FIFO_GROUP_WRR)
+	{
+		eligible &= group->round;
+
+		if(eligible == 0)
+		{
+			fifo_group_new_round(group);
+			eligible = group->ready;
+		}
+	}
+
+	return fifo_group_ctz(eligible);
+}
+
+/**
+ *	@brief Creates empty FIFO group.
+ *
+ *	@param group - pointer to the FIFO group
+ *	@param mode - FIFO_GROUP_STRICT or FIFO_GROUP_WRR
+ *
+ *	@retval returns: 0 - FIFO group created successfully
+ *					-1 - group pointer is NULL
+ *					-3 - unknown mode
+ */
+int fifo_group_init(fifo_group_TD *group, uint8_t mode)
+{
+	if(group == NULL) return -1; /* group pointer NULL */
+	if((mode != FIFO_GROUP_STRICT) && (mode != FIFO_GROUP_WRR)) return -3; /* unknown mode */
+
+	memset(group, 0, sizeof(*group));
+	group->mode = mode;
+
+	return 0;
+}
+
+/**
+ *	@brief Adds common FIFO buffer to FIFO group as member of priority index.
+ *
+ *	@param group - pointer to the FIFO group
+ *	@param index - slot and priority of the member, 0 highest, lower than FIFO_GROUP_MAX
+ *	@param fifo - pointer to the FIFO buffer, entry size must match the other members
+ *	@param weight - entries per round in FIFO_GROUP_WRR mode, ignored in FIFO_GROUP_STRICT mode
+ *
+ *	@retval returns: 0 - member added successfully
+ *					-1 - group pointer is NULL
+ *					-2 - fifo pointer is NULL
+ *					-3 - index out of range or slot taken
+ *					-4 - weight is 0 in FIFO_GROUP_WRR mode
+ *					-5 - entry size differs from the other members
+ */
+int fifo_group_add(fifo_group_TD *group, uint8_t index, fifo_common_TD *fifo, fifo_size_t weight)
+{
+	uint32_t bit = 0;
+
+	if(group == NULL) return -1; /* group pointer NULL */
+	if(fifo == NULL) return -2; /* fifo pointer NULL */
+	if((index >= FIFO_GROUP_MAX) || (group->fifo[index] != NULL)) return -3; /* bad slot */
+	if((group->mode == FIFO_GROUP_WRR) && (weight == 0)) return -4; /* zero weight */
+	if((group->members != 0) && (fifo->entry_size != group->entry_size)) return -5; /* other entry size */
+
+	bit = (1u << index);
+
+	group->fifo[index] = fifo;
+	group->weight[index] = weight;
+	group->credit[index] = weight;
+	group->entry_size = fifo->entry_size;
+	group->members |= bit;
+	group->round |= bit;
+
+	if(fifo->free_size != fifo->max_size) group->ready |= bit;
+
+	return 0;
+}
+
+/**
+ *	@brief Removes member of priority index from FIFO group, its entries stay in the FIFO buffer.
+ *
+ *	@param group - pointer to the FIFO group
+ *	@param index - slot of the member
+ *
+ *	@retval returns: 0 - member removed successfully
+ *					-1 - group pointer is NULL
+ *					-3 - index out of range or slot free
+ */
+int fifo_group_remove(fifo_group_TD *group, uint8_t index)
+{
+	uint32_t bit = 0;
+
+	if(group == NULL) return -1; /* group pointer NULL */
+	if((index >= FIFO_GROUP_MAX) || (group->fifo[index] == NULL)) return -3; /* bad slot */
+
+	bit = (1u << index);
+
+	group->fifo[index] = NULL;
+	group->members &= ~bit;
+	group->ready &= ~bit;
+	group->round &= ~bit;
+
+	return 0;
+}
+
+/**
+ *	@brief Rebuilds the ready mask from the members, after entries were pushed into them directly.
+ *
+ *	@param group - pointer to the FIFO group
+ *
+ *	@retval returns: 0 - ready mask rebuilt successfully
+ *					-1 - group pointer is NULL
+ */
+int fifo_group_refresh(fifo_group_TD *group)
+{
+	uint32_t bits = 0;
+	uint8_t i = 0;
+
+	if(group == NULL) return -1; /* group pointer NULL */
+
+	group->ready = 0;
+
+	for(bits = group->members; bits != 0; bits &= (bits - 1))
+	{
+		i = fifo_group_ctz(bits);
+		if(group->fifo[i]->free_size != group->fifo[i]->max_size) group->ready |= (1u << i);
+	}
+
+	return 0;
+}
+
+/**
+ *	@brief Pushes value into member of priority index and marks it ready.
+ *
+ *	@param group - pointer to the FIFO group
+ *	@param index - slot of the member
+ *	@param val_buffer - value buffer to push
+ *
+ *	@retval returns: 0 - tail pushed successfully
+ *					-1 - group pointer is NULL or no member at index
+ *					-2 - value buffer pointer is NULL
+ *					-3 - member FIFO buffer full
+ */
+int fifo_group_push(fifo_group_TD *group, uint8_t index, void *val_buffer)
+{
+	int result = 0;
+
+	if(group == NULL) return -1; /* group pointer NULL */
+	if((index >= FIFO_GROUP_MAX) || (group->fifo[index] == NULL)) return -1; /* no member */
+
+	result = fifo_common_push(group->fifo[index], val_buffer);
+	if(result == 0) group->ready |= (1u << index);
+
+	return result;
+}
+
+/**
+ *	@brief Pushes m entries into member of priority index and marks it ready.
+ *
+ *	@param group - pointer to the FIFO group
+ *	@param index - slot of the member
+ *	@param push_buffer - pointer to the buffer from which the values will be pushed
+ *	@param m - amount of entries to be pushed
+ *
+ *	@retval returns:	0 - all of the m entries was pushed
+ *					-1 - group pointer is NULL or no member at index
+ *					-2 - push buffer pointer is NULL
+ *					-3 - amount of the entries to be pushed is zero
+ *					-4 - no place for m element in member FIFO buffer
+ */
+int fifo_group_push_mul(fifo_group_TD *group, uint8_t index, void *push_buffer, fifo_size_t m)
+{
+	fifo_common_TD *fifo = NULL;
+
+	if(group == NULL) return -1; /* group pointer NULL */
+	if((index >= FIFO_GROUP_MAX) || (group->fifo[index] == NULL)) return -1; /* no member */
+	if(push_buffer == NULL) return -2; /* push buffer pointer NULL */
+	if(m == 0) return -3; /* zero m */
+
+	fifo = group->fifo[index];
+
+	if(m > fifo->free_size) return -4; /* no place for m elements in FIFO */
+
+	fifo_common_write_some(fifo, push_buffer, m);
+	group->ready |= (1u << index);
+
+	return 0;
+}
+
+/**
+ *	@brief Pops value from the member picked by the scheduling mode of FIFO group.
+ *
+ *	@param group - pointer to the FIFO group
+ *	@param val_buffer - pointer to value store buffer
+ *	@param index - pointer to store index of the member popped from, may be NULL
+ *
+ *	@retval returns: 0 - head popped successfully
+ *					-1 - group pointer is NULL
+ *					-2 - value buffer pointer is NULL
+ *					-3 - all members empty
+ */
+int fifo_group_pop(fifo_group_TD *group, void *val_buffer, uint8_t *index)
+{
+	if(group == NULL) return -1; /* group pointer NULL */
+	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
+	if(fifo_group_pop_mul(group, val_buffer, 1, index) == 0) return -3; /* group empty */
+
+	return 0;
+}
+
+/**
+ *	@brief Pops up to m entries from the single member picked by the scheduling mode of FIFO group.
+ * 	In FIFO_GROUP_WRR mode at most the credit left to the member in the current round is popped.
+ *
+ *	@param group - pointer to the FIFO group
+ *	@param pop_buffer - pointer to the buffer into which the values will be popped
+ *	@param m - maximal amount of entries to be popped
+ *	@param index - pointer to store index of the member popped from, may be NULL
+ *
+ *	@retval returns: amount of entries popped, 0 if all members are empty or any pointer is NULL
+ */
+fifo_size_t fifo_group_pop_mul(fifo_group_TD *group, void *pop_buffer, fifo_size_t m, uint8_t *index)
+{
+	fifo_common_TD *fifo = NULL;
+	fifo_size_t batch = 0;
+	fifo_size_t n = 0;
+	uint32_t bit = 0;
+	int i = 0;
+
+	if((group == NULL) || (pop_buffer == NULL)) return 0; /* pointer NULL */
+	if(m == 0) return 0; /* zero m */
+
+	for(;;)
+	{
+		i = fifo_group_pick(group);
+		if(i < 0) return 0; /* group empty */
+
+		fifo = group->fifo[i];
+		bit = (1u << i);
+
+		batch = m;
+		if((group->mode == FIFO_GROUP_WRR) && (batch > group->credit[i])) batch = group->credit[i]; /* caller's m stays for the next member */
+
+		n = fifo_common_read_some(fifo, pop_buffer, batch);
+
+		if(fifo->free_size == fifo->max_size) group->ready &= ~bit;
+		if(n != 0) break;
+	}
+
+	if(group->mode == FIFO_GROUP_WRR)
+	{
+		group->credit[i] -= n;
+		if(group->credit[i] == 0) group->round &= ~bit;
+	}
+
+	if(index != NULL) *index = (uint8_t)i;
+
+	return n;
+}
+
+/**
+* 	@}
+*/
+
+/**
+* 	@}
+*/
@@ -0,0 +1,68 @@
+/**
+ * 	@file fifo_group.h
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Priority groups of common FIFO buffers.
+ *  A group holds up to FIFO_GROUP_MAX member FIFO buffers of one entry size, member index is its priority
+ *  (0 highest). A ready bitmask kept by group push functions lets fifo_group_pop/fifo_group_pop_mul pick
+ *  the next non-empty member with a single count-trailing-zeros instead of probing empty FIFO buffers.
+ *
+ *  FIFO_GROUP_STRICT always drains the highest priority non-empty member.
+ *  FIFO_GROUP_WRR gives each member weight entries per round, in priority order, so high priority
+ *  traffic keeps low latency while low priority members still get their share.
+ *
+ *  Alert: not thread-safe, like the member common FIFO buffers. Entries pushed into a member directly
+ *  must be followed by fifo_group_refresh() or they stay invisible to the group.
+ */
+
+#ifndef FIFO_GROUP_H_
+#define FIFO_GROUP_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "fifo.h"
+
+/**
+* 	@brief	Largest amount of members of FIFO group, bits of the ready mask.
+*/
+#define FIFO_GROUP_MAX			32
+
+/**
+* 	@brief	Scheduling modes of FIFO group.
+*/
+#define FIFO_GROUP_STRICT		0	/**< Highest priority non-empty member first */
+#define FIFO_GROUP_WRR			1	/**< Weighted round-robin in priority order */
+
+/**
+* 	@brief	FIFO group type.
+*/
+typedef struct
+{
+	fifo_common_TD *fifo[FIFO_GROUP_MAX];	/**< Member FIFO buffers by priority, NULL for free slots */
+	fifo_size_t weight[FIFO_GROUP_MAX];		/**< Entries per round of each member in FIFO_GROUP_WRR mode */
+	fifo_size_t credit[FIFO_GROUP_MAX];		/**< Entries left in the current round of each member */
+
+	uint32_t members;						/**< Bit i set when slot i holds a member */
+	uint32_t ready;							/**< Bit i set when member i holds entries */
+	uint32_t round;							/**< Bit i set when member i has credit left in the current round */
+
+	uint16_t entry_size;					/**< Entry size shared by all members, 0 until the first member is added */
+	uint8_t mode;							/**< FIFO_GROUP_STRICT or FIFO_GROUP_WRR */
+
+}fifo_group_TD;
+
+int fifo_group_init(fifo_group_TD *group, uint8_t mode);
+int fifo_group_add(fifo_group_TD *group, uint8_t index, fifo_common_TD *fifo, fifo_size_t weight);
+int fifo_group_remove(fifo_group_TD *group, uint8_t index);
+int fifo_group_refresh(fifo_group_TD *group);
+int fifo_group_push(fifo_group_TD *group, uint8_t index, void *val_buffer);
+int fifo_group_push_mul(fifo_group_TD *group, uint8_t index, void *push_buffer, fifo_size_t m);
+int fifo_group_pop(fifo_group_TD *group, void *val_buffer, uint8_t *index);
+fifo_size_t fifo_group_pop_mul(fifo_group_TD *group, void *pop_buffer, fifo_size_t m, uint8_t *index);
+
+#endif /* FIFO_GROUP_H_ */
@@ -0,0 +1,346 @@
+/**
+ * 	@file fifo_io.c
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Implementation of direct file/socket I/O of uint8_t FIFO buffers.
+ *  Alert: Linux only, readv/writev are retried on EINTR, any other failure including EAGAIN gives -6
+ *
+ */
+
+#if defined(__linux__)
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <unistd.h>
+
+#include "fifo_io.h"
+
+/**
+*	@addtogroup Software_FIFO_buffer Software FIFO buffers
+* 	@{
+*/
+
+/**
+*	@addtogroup io_FIFO_buffer FIFO buffer file/socket I/O
+* 	@{
+*/
+
+/**
+ *	@brief Fills iov with the one or two spans of a reserve/peek, returns amount of iovec used.
+ */
+static inline int fifo_io_fill(struct iovec *iov, uint8_t *region1, fifo_size_t len1, uint8_t *region2, fifo_size_t len2)
+{
+	iov[0].iov_base = region1;
+	iov[0].iov_len = len1;
+
+	if(len2 == 0) return 1;
+
+	iov[1].iov_base = region2;
+	iov[1].iov_len = len2;
+
+	return 2;
+}
+
+/**
+ *	@brief readv(2) retried on EINTR.
+ */
+static inline ssize_t fifo_io_readv(int fd, const struct iovec *iov, int count)
+{
+	ssize_t n = 0;
+
+	do
+	{
+		n = readv(fd, iov, count);
+	}
+	while((n < 0) && (errno == EINTR));
+
+	return n;
+}
+
+/**
+ *	@brief writev(2) retried on EINTR.
+ */
+static inline ssize_t fifo_io_writev(int fd, const struct iovec *iov, int count)
+{
+	ssize_t n = 0;
+
+	do
+	{
+		n = writev(fd, iov, count);
+	}
+	while((n < 0) && (errno == EINTR));
+
+	return n;
+}
+
+/**
+ *	@brief Fills iov with the free spans of uint8_t FIFO buffer for up to m Bytes, nothing is committed.
+ *	After the read completed with n Bytes call fifo_uint8_commit(fifo, n).
+ *
+ *	@param fifo - pointer to the uint8_t FIFO buffer
+ *	@param m - maximal amount of Bytes to be read
+ *	@param iov - pointer to an array of two iovec
+ *
+ *	@retval returns: 1 or 2 - amount of iovec filled
+ *					-1 - fifo pointer is NULL
+ *					-2 - iov pointer is NULL
+ *					-3 - m is zero
+ *					-4 - FIFO buffer full
+ */
+int fifo_uint8_read_iov(fifo_uint8_TD *fifo, fifo_size_t m, struct iovec *iov)
+{
+	uint8_t *region1 = NULL;
+	uint8_t *region2 = NULL;
+	fifo_size_t len1 = 0;
+	fifo_size_t len2 = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(iov == NULL) return -2; /* iov pointer NULL */
+	if(m == 0) return -3; /* zero m */
+
+	if(m > fifo->free_size) m = fifo->free_size;
+	if(m == 0) return -4; /* FIFO full */
+
+	fifo_uint8_reserve(fifo, m, &region1, &len1, &region2, &len2);
+
+	return fifo_io_fill(iov, region1, len1, region2, len2);
+}
+
+/**
+ *	@brief Fills iov with the stored spans of uint8_t FIFO buffer for up to m Bytes, nothing is released.
+ *	After the write completed with n Bytes call fifo_uint8_release(fifo, n).
+ *
+ *	@param fifo - pointer to the uint8_t FIFO buffer
+ *	@param m - maximal amount of Bytes to be written
+ *	@param iov - pointer to an array of two iovec
+ *
+ *	@retval returns: 1 or 2 - amount of iovec filled
+ *					-1 - fifo pointer is NULL
+ *					-2 - iov pointer is NULL
+ *					-3 - m is zero
+ *					-4 - FIFO buffer empty
+ */
+int fifo_uint8_write_iov(fifo_uint8_TD *fifo, fifo_size_t m, struct iovec *iov)
+{
+	uint8_t *region1 = NULL;
+	uint8_t *region2 = NULL;
+	fifo_size_t len1 = 0;
+	fifo_size_t len2 = 0;
+	fifo_size_t used = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(iov == NULL) return -2; /* iov pointer NULL */
+	if(m == 0) return -3; /* zero m */
+
+	used = (fifo->max_size - fifo->free_size);
+
+	if(m > used) m = used;
+	if(m == 0) return -4; /* FIFO empty */
+
+	fifo_uint8_peek(fifo, m, &region1, &len1, &region2, &len2);
+
+	return fifo_io_fill(iov, region1, len1, region2, len2);
+}
+
+/**
+ *	@brief Reads up to m Bytes from fd straight into uint8_t FIFO buffer with one readv(2).
+ *
+ *	@param fifo - pointer to the uint8_t FIFO buffer
+ *	@param fd - file descriptor to read from
+ *	@param m - maximal amount of Bytes to be read
+ *
+ *	@retval returns: >0 - amount of Bytes read and pushed
+ *					 0 - end of file
+ *					-1 - fifo pointer is NULL
+ *					-3 - m is zero
+ *					-4 - FIFO buffer full
+ *					-6 - readv failed, errno is left as set by it
+ */
+ssize_t fifo_uint8_read_fd(fifo_uint8_TD *fifo, int fd, fifo_size_t m)
+{
+	struct iovec iov[2];
+	ssize_t n = 0;
+	int count = fifo_uint8_read_iov(fifo, m, iov);
+
+	if(count < 0) return count; /* nothing to read into */
+
+	n = fifo_io_readv(fd, iov, count);
+	if(n < 0) return -6; /* readv failed */
+
+	if(n > 0) fifo_uint8_commit(fifo, (fifo_size_t)n);
+
+	return n;
+}
+
+/**
+ *	@brief Writes up to m Bytes from uint8_t FIFO buffer straight to fd with one writev(2).
+ *
+ *	@param fifo - pointer to the uint8_t FIFO buffer
+ *	@param fd - file descriptor to write to
+ *	@param m - maximal amount of Bytes to be written
+ *
+ *	@retval returns: >=0 - amount of Bytes written and popped
+ *					-1 - fifo pointer is NULL
+ *					-3 - m is zero
+ *					-4 - FIFO buffer empty
+ *					-6 - writev failed, errno is left as set by it
+ */
+ssize_t fifo_uint8_write_fd(fifo_uint8_TD *fifo, int fd, fifo_size_t m)
+{
+	struct iovec iov[2];
+	ssize_t n = 0;
+	int count = fifo_uint8_write_iov(fifo, m, iov);
+
+	if(count < 0) return count; /* nothing to write */
+
+	n = fifo_io_writev(fd, iov, count);
+	if(n < 0) return -6; /* writev failed */
+
+	if(n > 0) fifo_uint8_release(fifo, (fifo_size_t)n);
+
+	return n;
+}
+
+/**
+ *	@brief Fills iov with the free spans of uint8_t SPSC FIFO buffer for up to m Bytes. Producer side only.
+ *	After the read completed with n Bytes call fifo_spsc_uint8_commit(fifo, n).
+ *
+ *	@param fifo - pointer to the uint8_t SPSC FIFO buffer
+ *	@param m - maximal amount of Bytes to be read
+ *	@param iov - pointer to an array of two iovec
+ *
+ *	@retval returns: 1 or 2 - amount of iovec filled
+ *					-1 - fifo pointer is NULL
+ *					-2 - iov pointer is NULL
+ *					-3 - m is zero
+ *					-4 - FIFO buffer full
+ */
+int fifo_spsc_uint8_read_iov(fifo_spsc_uint8_TD *fifo, fifo_size_t m, struct iovec *iov)
+{
+	uint8_t *region1 = NULL;
+	uint8_t *region2 = NULL;
+	fifo_size_t len1 = 0;
+	fifo_size_t len2 = 0;
+	fifo_size_t free_size = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(iov == NULL) return -2; /* iov pointer NULL */
+	if(m == 0) return -3; /* zero m */
+
+	free_size = (fifo->ring.max_size - fifo_spsc_ring_count(&fifo->ring));
+
+	if(m > free_size) m = free_size;
+	if(m == 0) return -4; /* FIFO full */
+
+	fifo_spsc_uint8_reserve(fifo, m, &region1, &len1, &region2, &len2);
+
+	return fifo_io_fill(iov, region1, len1, region2, len2);
+}
+
+/**
+ *	@brief Fills iov with the stored spans of uint8_t SPSC FIFO buffer for up to m Bytes. Consumer side only.
+ *	After the write completed with n Bytes call fifo_spsc_uint8_release(fifo, n).
+ *
+ *	@param fifo - pointer to the uint8_t SPSC FIFO buffer
+ *	@param m - maximal amount of Bytes to be written
+ *	@param iov - pointer to an array of two iovec
+ *
+ *	@retval returns: 1 or 2 - amount of iovec filled
+ *					-1 - fifo pointer is NULL
+ *					-2 - iov pointer is NULL
+ *					-3 - m is zero
+ *					-4 - FIFO buffer empty
+ */
+int fifo_spsc_uint8_write_iov(fifo_spsc_uint8_TD *fifo, fifo_size_t m, struct iovec *iov)
+{
+	uint8_t *region1 = NULL;
+	uint8_t *region2 = NULL;
+	fifo_size_t len1 = 0;
+	fifo_size_t len2 = 0;
+	fifo_size_t used = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(iov == NULL) return -2; /* iov pointer NULL */
+	if(m == 0) return -3; /* zero m */
+
+	used = fifo_spsc_ring_count(&fifo->ring);
+
+	if(m > used) m = used;
+	if(m == 0) return -4; /* FIFO empty */
+
+	fifo_spsc_uint8_peek(fifo, m, &region1, &len1, &region2, &len2);
+
+	return fifo_io_fill(iov, region1, len1, region2, len2);
+}
+
+/**
+ *	@brief Reads up to m Bytes from fd straight into uint8_t SPSC FIFO buffer with one readv(2). Producer side only.
+ *
+ *	@param fifo - pointer to the uint8_t SPSC FIFO buffer
+ *	@param fd - file descriptor to read from
+ *	@param m - maximal amount of Bytes to be read
+ *
+ *	@retval returns: >0 - amount of Bytes read and pushed
+ *					 0 - end of file
+ *					-1 - fifo pointer is NULL
+ *					-3 - m is zero
+ *					-4 - FIFO buffer full
+ *					-6 - readv failed, errno is left as set by it
+ */
+ssize_t fifo_spsc_uint8_read_fd(fifo_spsc_uint8_TD *fifo, int fd, fifo_size_t m)
+{
+	struct iovec iov[2];
+	ssize_t n = 0;
+	int count = fifo_spsc_uint8_read_iov(fifo, m, iov);
+
+	if(count < 0) return count; /* nothing to read into */
+
+	n = fifo_io_readv(fd, iov, count);
+	if(n < 0) return -6; /* readv failed */
+
+	if(n > 0) fifo_spsc_uint8_commit(fifo, (fifo_size_t)n);
+
+	return n;
+}
+
+/**
+ *	@brief Writes up to m Bytes from uint8_t SPSC FIFO buffer straight to fd with one writev(2). Consumer side only.
+ *
+ *	@param fifo - pointer to the uint8_t SPSC FIFO buffer
+ *	@param fd - file descriptor to write to
+ *	@param m - maximal amount of Bytes to be written
+ *
+ *	@retval returns: >=0 - amount of Bytes written and popped
+ *					-1 - fifo pointer is NULL
+ *					-3 - m is zero
+ *					-4 - FIFO buffer empty
+ *					-6 - writev failed, errno is left as set by it
+ */
+ssize_t fifo_spsc_uint8_write_fd(fifo_spsc_uint8_TD *fifo, int fd, fifo_size_t m)
+{
+	struct iovec iov[2];
+	ssize_t n = 0;
+	int count = fifo_spsc_uint8_write_iov(fifo, m, iov);
+
+	if(count < 0) return count; /* nothing to write */
+
+	n = fifo_io_writev(fd, iov, count);
+	if(n < 0) return -6; /* writev failed */
+
+	if(n > 0) fifo_spsc_uint8_release(fifo, (fifo_size_t)n);
+
+	return n;
+}
+
+/**
+* 	@}
+*/
+
+/**
+* 	@}
+*/
+
+#endif /* __linux__ */
@@ -0,0 +1,41 @@
+/**
+ * 	@file fifo_io.h
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Direct file/socket I/O of uint8_t FIFO buffers (Linux).
+ *  read_fd functions readv(2) straight into the one or two free spans of the FIFO buffer and commit
+ *  what was read, write_fd functions writev(2) straight out of the one or two stored spans and release
+ *  what was written: one syscall per batch and no staging copy.
+ *  read_iov/write_iov functions only fill the spans into an iovec array, for callers that submit
+ *  IORING_OP_READV/IORING_OP_WRITEV (or sendmsg/recvmsg) themselves and commit/release on completion.
+ *
+ *  Alert: SPSC variants follow the SPSC rules, read_fd/read_iov on the producer side only,
+ *  write_fd/write_iov on the consumer side only.
+ */
+
+#ifndef FIFO_IO_H_
+#define FIFO_IO_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include "fifo_config.h"
+#include "fifo.h"
+#include "fifo_spsc.h"
+
+ssize_t fifo_uint8_read_fd(fifo_uint8_TD *fifo, int fd, fifo_size_t m);
+ssize_t fifo_uint8_write_fd(fifo_uint8_TD *fifo, int fd, fifo_size_t m);
+int fifo_uint8_read_iov(fifo_uint8_TD *fifo, fifo_size_t m, struct iovec *iov);
+int fifo_uint8_write_iov(fifo_uint8_TD *fifo, fifo_size_t m, struct iovec *iov);
+
+ssize_t fifo_spsc_uint8_read_fd(fifo_spsc_uint8_TD *fifo, int fd, fifo_size_t m);
+ssize_t fifo_spsc_uint8_write_fd(fifo_spsc_uint8_TD *fifo, int fd, fifo_size_t m);
+int fifo_spsc_uint8_read_iov(fifo_spsc_uint8_TD *fifo, fifo_size_t m, struct iovec *iov);
+int fifo_spsc_uint8_write_iov(fifo_spsc_uint8_TD *fifo, fifo_size_t m, struct iovec *iov);
+
+#endif /* FIFO_IO_H_ */
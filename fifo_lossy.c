@@ -0,0 +1,312 @@
+/**
+ * 	@file fifo_lossy.c
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Implementation of overwrite-oldest (lossy) FIFO buffers.
+ *  Alert: size of FIFO buffer must be a power of two, a buffer must hold
+ *  FIFO_LOSSY_BUFFER_SIZE(size, entry_size) Bytes aligned to fifo_index_t and
+ *  push functions must be called from a single producer context.
+ *
+ */
+
+#include "fifo_lossy.h"
+
+/**
+*	@addtogroup Software_FIFO_buffer Software FIFO buffers
+* 	@{
+*/
+
+/**
+*	@addtogroup Lossy_FIFO_buffer Lossy FIFO buffer
+* 	@{
+*/
+
+/**
+ *	@brief Returns sequence number of the slot of position pos.
+ */
+static inline _Atomic fifo_index_t *fifo_lossy_seq(const fifo_lossy_TD *fifo, fifo_index_t pos)
+{
+	return (_Atomic fifo_index_t *)(fifo->buffer + ((size_t)(pos & fifo->mask) * fifo->slot_size));
+}
+
+/**
+ *	@brief Returns entry of the slot of position pos.
+ */
+static inline uint8_t *fifo_lossy_entry(const fifo_lossy_TD *fifo, fifo_index_t pos)
+{
+	return (fifo->buffer + ((size_t)(pos & fifo->mask) * fifo->slot_size) + sizeof(fifo_index_t));
+}
+
+/**
+ *	@brief Returns sequence number of a slot holding complete entry of position pos, the odd value before it marks a write in progress.
+ */
+static inline fifo_index_t fifo_lossy_done(fifo_index_t pos)
+{
+	return (fifo_index_t)((pos << 1) + 2);
+}
+
+/**
+ *	@brief Writes entry of position pos into its slot, the tail is left to the caller.
+ */
+static inline void fifo_lossy_write(fifo_lossy_TD *fifo, fifo_index_t pos, const void *src)
+{
+	_Atomic fifo_index_t *seq = fifo_lossy_seq(fifo, pos);
+
+	atomic_store_explicit(seq, (fifo_lossy_done(pos) - 1), memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+	memcpy(fifo_lossy_entry(fifo, pos), src, fifo->entry_size);
+	atomic_store_explicit(seq, fifo_lossy_done(pos), memory_order_release);
+}
+
+/**
+ *	@brief Pushes value into lossy FIFO buffer, overwriting the oldest entry when it is full. Producer side only.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param val_buffer - value buffer to push
+ *
+ *	@retval returns: 0 - tail pushed successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - value buffer pointer is NULL
+ */
+int fifo_lossy_push(fifo_lossy_TD *fifo, const void *val_buffer)
+{
+	fifo_index_t pos = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
+
+	pos = atomic_load_explicit(&fifo->tail, memory_order_relaxed);
+
+	fifo_lossy_write(fifo, pos, val_buffer);
+	atomic_store_explicit(&fifo->tail, (pos + 1), memory_order_release);
+
+	return 0;
+}
+
+/**
+ *	@brief Pushes m values into lossy FIFO buffer, overwriting the oldest entries when it is full. Producer side only.
+ * 	Of more than max_size values only the last max_size are written, the tail is published once for the whole run.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param push_buffer - pointer to buffer that contains values to be pushed
+ *	@param m - amount of entries to be pushed
+ *
+ *	@retval returns: 0 - all of the m entries was pushed
+ *					-1 - fifo pointer is NULL
+ *					-2 - push buffer pointer is NULL
+ *					-3 - amount of the entries to be pushed is zero
+ */
+int fifo_lossy_push_mul(fifo_lossy_TD *fifo, const void *push_buffer, fifo_size_t m)
+{
+	const uint8_t *src = push_buffer;
+	fifo_index_t pos = 0;
+	fifo_size_t i = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(push_buffer == NULL) return -2; /* push buffer pointer NULL */
+	if(m == 0) return -3; /* zero amount */
+
+	pos = atomic_load_explicit(&fifo->tail, memory_order_relaxed);
+
+	if(m > fifo->max_size)
+	{
+		i = (m - fifo->max_size); /* leading values would be overwritten by the same run */
+		pos += i;
+	}
+
+	for(; i < m; i++, pos++) fifo_lossy_write(fifo, pos, (src + ((size_t)i * fifo->entry_size)));
+
+	atomic_store_explicit(&fifo->tail, pos, memory_order_release);
+
+	return 0;
+}
+
+/**
+ *	@brief Creates lossy FIFO buffer. Must not run concurrently with push/pop.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param buffer - pointer to buffer of FIFO_LOSSY_BUFFER_SIZE(size, entry_size) Bytes
+ *	@param size - size of FIFO buffer, must be a power of two
+ *	@param entry_size - size of an entry of FIFO buffer
+ *
+ *	@retval returns: 0 - lossy FIFO buffer created successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - buffer pointer is NULL or not aligned to fifo_index_t
+ *					-3 - size of FIFO buffer is 0
+ *					-4 - size of entry is 0
+ *					-5 - size of FIFO buffer is not a power of two
+ */
+int fifo_lossy_init(fifo_lossy_TD *fifo, void *buffer, fifo_size_t size, uint16_t entry_size)
+{
+	fifo_index_t i = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(buffer == NULL) return -2; /* buffer pointer NULL */
+	if(((uintptr_t)buffer % _Alignof(fifo_index_t)) != 0) return -2; /* buffer not aligned */
+	if(size == 0) return -3; /* zero size */
+	if(entry_size == 0) return -4; /* zero entry size */
+	if((size & (size - 1)) != 0) return -5; /* size not a power of two */
+
+	fifo->buffer = buffer;
+	fifo->mask = (fifo_index_t)(size - 1);
+	fifo->slot_size = FIFO_LOSSY_SLOT_SIZE(entry_size);
+	fifo->entry_size = entry_size;
+	fifo->max_size = size;
+
+	for(i = 0; i < size; i++) atomic_init(fifo_lossy_seq(fifo, i), 0); /* matches no position */
+
+	atomic_init(&fifo->tail, 0);
+
+	return 0;
+}
+
+/**
+ *	@brief Pops oldest value the reader has not seen yet from lossy FIFO buffer.
+ * 	Entries overwritten before they were read are skipped and added to reader->lost.
+ *
+ *	@param reader - pointer to the reader cursor
+ *	@param val_buffer - pointer to value store buffer, its contents are undefined when nothing was popped
+ *
+ *	@retval returns: 0 - head popped successfully
+ *					-1 - reader pointer is NULL
+ *					-2 - value buffer pointer is NULL
+ *					-3 - no entries left for the reader
+ */
+int fifo_lossy_pop(fifo_lossy_reader_TD *reader, void *val_buffer)
+{
+	fifo_lossy_TD *fifo = NULL;
+	_Atomic fifo_index_t *seq = NULL;
+	fifo_index_t tail = 0;
+	fifo_index_t start = 0;
+
+	if(reader == NULL) return -1; /* reader pointer NULL */
+	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
+
+	fifo = reader->fifo;
+
+	for(;;)
+	{
+		tail = atomic_load_explicit(&fifo->tail, memory_order_acquire);
+
+		if(tail == reader->head) return -3; /* nothing new */
+
+		if((fifo_index_t)(tail - reader->head) > fifo->max_size)
+		{
+			reader->lost += ((tail - reader->head) - fifo->max_size); /* producer lapped the reader */
+			reader->head = (tail - fifo->max_size);
+		}
+
+		seq = fifo_lossy_seq(fifo, reader->head);
+		start = atomic_load_explicit(seq, memory_order_acquire);
+
+		if(start == fifo_lossy_done(reader->head))
+		{
+			memcpy(val_buffer, fifo_lossy_entry(fifo, reader->head), fifo->entry_size);
+			atomic_thread_fence(memory_order_acquire);
+
+			if(atomic_load_explicit(seq, memory_order_relaxed) == start)
+			{
+				reader->head++;
+				return 0;
+			}
+		}
+
+		reader->head++; /* slot overwritten before or during the copy */
+		reader->lost++;
+	}
+}
+
+/**
+ *	@brief Pops up to m values the reader has not seen yet from lossy FIFO buffer.
+ *
+ *	@param reader - pointer to the reader cursor
+ *	@param pop_buffer - pointer to the buffer into which the values will be popped
+ *	@param m - maximal amount of entries to be popped
+ *
+ *	@retval returns: amount of popped entries, 0 if a pointer is NULL or there is nothing to pop
+ */
+fifo_size_t fifo_lossy_read_some(fifo_lossy_reader_TD *reader, void *pop_buffer, fifo_size_t m)
+{
+	uint8_t *dst = pop_buffer;
+	fifo_size_t n = 0;
+
+	if(reader == NULL) return 0; /* reader pointer NULL */
+	if(pop_buffer == NULL) return 0; /* pop buffer pointer NULL */
+
+	for(n = 0; n < m; n++)
+	{
+		if(fifo_lossy_pop(reader, (dst + ((size_t)n * reader->fifo->entry_size))) != 0) break;
+	}
+
+	return n;
+}
+
+/**
+ *	@brief Gives amount of entries the reader has not seen yet, at most max_size.
+ *
+ *	@param reader - pointer to the reader cursor
+ *
+ *	@retval returns: amount of unread entries, 0 if reader pointer is NULL
+ */
+fifo_size_t fifo_lossy_count(fifo_lossy_reader_TD *reader)
+{
+	fifo_index_t tail = 0;
+
+	if(reader == NULL) return 0; /* reader pointer NULL */
+
+	tail = atomic_load_explicit(&reader->fifo->tail, memory_order_acquire);
+
+	if((fifo_index_t)(tail - reader->head) > reader->fifo->max_size) return reader->fifo->max_size;
+
+	return (fifo_size_t)(tail - reader->head);
+}
+
+/**
+ *	@brief Creates reader cursor of lossy FIFO buffer, positioned at the oldest entry still held.
+ * 	Once the ring has filled that is tail - max_size modulo the counter width, also after the tail counter wrapped.
+ *
+ *	@param reader - pointer to the reader cursor
+ *	@param fifo - pointer to the FIFO buffer to read from
+ *
+ *	@retval returns: 0 - reader created successfully
+ *					-1 - reader pointer is NULL
+ *					-2 - fifo pointer is NULL
+ */
+int fifo_lossy_reader_init(fifo_lossy_reader_TD *reader, fifo_lossy_TD *fifo)
+{
+	fifo_index_t tail = 0;
+	fifo_index_t seq = 0;
+
+	if(reader == NULL) return -1; /* reader pointer NULL */
+	if(fifo == NULL) return -2; /* fifo pointer NULL */
+
+	for(;;)
+	{
+		tail = atomic_load_explicit(&fifo->tail, memory_order_acquire);
+
+		if(tail >= fifo->max_size) break; /* ring filled */
+
+		seq = atomic_load_explicit(fifo_lossy_seq(fifo, tail), memory_order_acquire);
+
+		if(seq == 0) break; /* slot of tail never written, ring not filled yet */
+		if((seq != fifo_lossy_done(tail)) && (seq != (fifo_lossy_done(tail) - 1))) break; /* counter wrapped after the ring filled */
+
+		FIFO_CPU_RELAX(); /* position tail being written, what the slot held before is unknown */
+	}
+
+	reader->fifo = fifo;
+	reader->head = (((tail >= fifo->max_size) || (seq != 0)) ? (fifo_index_t)(tail - fifo->max_size) : 0);
+	reader->lost = 0;
+
+	return 0;
+}
+
+/**
+* 	@}
+*/
+
+/**
+* 	@}
+*/
@@ -0,0 +1,75 @@
+/**
+ * 	@file fifo_lossy.h
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Overwrite-oldest (lossy) FIFO buffers for telemetry and trace capture.
+ *  The producer never stalls: when the buffer is full a push overwrites the oldest entry,
+ *  there is no full check and no error path besides NULL arguments.
+ *  Every slot holds a sequence number followed by the entry. The producer marks a slot
+ *  odd while writing it and even when done, so readers detect torn and overrun reads
+ *  and skip them, counting every skipped entry as lost. Requires C11 atomics.
+ *
+ *  Any number of readers may follow one FIFO, each with its own fifo_lossy_reader_TD cursor.
+ */
+
+#ifndef FIFO_LOSSY_H_
+#define FIFO_LOSSY_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "fifo_config.h"
+
+/**
+* 	@brief	Size in Bytes of one lossy slot: sequence number and entry rounded up to the sequence alignment.
+*/
+#define FIFO_LOSSY_SLOT_SIZE(entry_size)		\
+	((((sizeof(fifo_index_t) + (size_t)(entry_size)) + (_Alignof(fifo_index_t) - 1)) / _Alignof(fifo_index_t)) * _Alignof(fifo_index_t))
+
+/**
+* 	@brief	Size in Bytes of the buffer passed to fifo_lossy_init() for size entries of entry_size Bytes.
+*/
+#define FIFO_LOSSY_BUFFER_SIZE(size, entry_size)		((size_t)(size) * FIFO_LOSSY_SLOT_SIZE(entry_size))
+
+/**
+* 	@brief	Lossy FIFO buffer type. Used for store entries with user defined size.
+*/
+typedef struct
+{
+	uint8_t *buffer;								/**< Pointer to buffer of slots, aligned to fifo_index_t */
+	fifo_index_t mask;								/**< Index mask of FIFO buffer, equal to max_size - 1 */
+	size_t slot_size;								/**< Size of one slot in Bytes */
+
+	uint16_t entry_size;							/**< Size of FIFO buffer entry in Bytes */
+	fifo_size_t max_size;							/**< Size of FIFO buffer, power of two */
+
+	FIFO_MPMC_ALIGN _Atomic fifo_index_t tail;		/**< Free-running write counter, written by the producer only */
+
+}fifo_lossy_TD;
+
+/**
+* 	@brief	Reader cursor of lossy FIFO buffer.
+*/
+typedef struct
+{
+	fifo_lossy_TD *fifo;	/**< Pointer to the lossy FIFO buffer to read from */
+	fifo_index_t head;		/**< Free-running read counter of this reader */
+	fifo_index_t lost;		/**< Free-running counter of entries overwritten before this reader got them */
+
+}fifo_lossy_reader_TD;
+
+int fifo_lossy_push(fifo_lossy_TD *fifo, const void *val_buffer);
+int fifo_lossy_push_mul(fifo_lossy_TD *fifo, const void *push_buffer, fifo_size_t m);
+int fifo_lossy_init(fifo_lossy_TD *fifo, void *buffer, fifo_size_t size, uint16_t entry_size);
+
+int fifo_lossy_pop(fifo_lossy_reader_TD *reader, void *val_buffer);
+fifo_size_t fifo_lossy_read_some(fifo_lossy_reader_TD *reader, void *pop_buffer, fifo_size_t m);
+fifo_size_t fifo_lossy_count(fifo_lossy_reader_TD *reader);
+int fifo_lossy_reader_init(fifo_lossy_reader_TD *reader, fifo_lossy_TD *fifo);
+
+#endif /* FIFO_LOSSY_H_ */
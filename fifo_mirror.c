@@ -0,0 +1,538 @@
+/**
+ * 	@file fifo_mirror.c
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Implementation of virtual-memory mirrored FIFO buffers.
+ *  Buffer is an anonymous memfd mapped twice into one reserved address range.
+ *  Alert: Linux only, size * entry_size must be a multiple of the system page size
+ *
+ */
+
+#if defined(__linux__)
+
+#define _GNU_SOURCE
+
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "fifo_mirror.h"
+
+/**
+*	@addtogroup Software_FIFO_buffer Software FIFO buffers
+* 	@{
+*/
+
+/**
+*	@addtogroup mirror_FIFO_buffer mirrored FIFO buffer
+* 	@{
+*/
+
+/**
+ *	@brief Moves ptr forward by n entries and folds it back into the first mapping.
+ */
+static inline uint8_t *fifo_mirror_advance(const fifo_mirror_TD *fifo, uint8_t *ptr, fifo_size_t n)
+{
+	ptr += ((size_t)n * fifo->entry_size);
+
+	if(ptr >= fifo->limit_ptr) ptr -= (fifo->limit_ptr - fifo->buffer);
+
+	return ptr;
+}
+
+/**
+ *	@brief Gives the granularity of mirrored FIFO buffer size for entry_size.
+ *
+ *	@param entry_size - size of an entry of FIFO buffer
+ *
+ *	@retval returns: size of FIFO buffer must be a multiple of the returned value, 0 if entry_size is 0
+ */
+size_t fifo_mirror_granularity(uint16_t entry_size)
+{
+	size_t page = (size_t)sysconf(_SC_PAGESIZE);
+	size_t a = page;
+	size_t b = entry_size;
+	size_t t = 0;
+
+	if(entry_size == 0) return 0; /* zero entry size */
+
+	while(b != 0)
+	{
+		t = a % b;
+		a = b;
+		b = t;
+	}
+
+	return (page / a);
+}
+
+/**
+ * 	@brief Empties mirrored FIFO buffer in O(1), only indices are rewound.
+ *
+ * 	@param fifo - pointer to the FIFO buffer
+ *
+ * 	@retval returns: 0 - FIFO buffer reset successfully
+ * 					-1 - fifo pointer is NULL
+ *
+ */
+int fifo_mirror_reset(fifo_mirror_TD *fifo)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+
+	fifo->head_ptr = fifo->buffer;
+	fifo->tail_ptr = fifo->buffer;
+	fifo->free_size = fifo->max_size;
+
+	return 0;
+}
+
+/**
+ * 	@brief Clears mirrored FIFO buffer, buffer contents are wiped as selected by FIFO_WIPE_MODE.
+ *
+ * 	@param fifo - pointer to the FIFO buffer
+ *
+ * 	@retval returns: 0 - FIFO buffer cleared successfully
+ * 					-1 - fifo pointer is NULL
+ *
+ */
+int fifo_mirror_clear(fifo_mirror_TD *fifo)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+
+	fifo_wipe(fifo->buffer, ((size_t)fifo->max_size * fifo->entry_size));
+
+	return fifo_mirror_reset(fifo);
+}
+
+/**
+ *	@brief Pops head value from mirrored FIFO buffer.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param val_buffer - pointer to value store buffer
+ *
+ *	@retval returns: 0 - head popped successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - value buffer pointer is NULL
+ *					-3 - FIFO buffer empty
+ */
+int fifo_mirror_pop(fifo_mirror_TD *fifo, void *val_buffer)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
+	if(fifo->free_size == fifo->max_size) return -3; /* fifo empty */
+
+	memcpy(val_buffer, fifo->head_ptr, fifo->entry_size);
+	fifo->head_ptr = fifo_mirror_advance(fifo, fifo->head_ptr, 1);
+	fifo->free_size++;
+
+	return 0;
+}
+
+/**
+ *	@brief Pops m entries from mirrored FIFO buffer with a single copy.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param pop_buffer - pointer to the buffer into which the values will be popped
+ *	@param m - amount of entries to be popped
+ *
+ *	@retval returns:	0 - all of the m entries was popped
+ *					-1 - fifo pointer is NULL
+ *					-2 - pop buffer pointer is NULL
+ *					-3 - amount of the entries to be popped is zero
+ *					-4 - FIFO buffer current size lower than m
+ *
+ */
+int fifo_mirror_pop_mul(fifo_mirror_TD *fifo, void *pop_buffer, fifo_size_t m)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(pop_buffer == NULL) return -2; /* pop buffer pointer NULL */
+	if(m == 0) return -3; /* zero m */
+	if(m > (fifo->max_size - fifo->free_size)) return -4; /* current size lower than m */
+
+	memcpy(pop_buffer, fifo->head_ptr, ((size_t)m * fifo->entry_size));
+	fifo->head_ptr = fifo_mirror_advance(fifo, fifo->head_ptr, m);
+	fifo->free_size += m;
+
+	return 0;
+}
+
+/**
+ *	@brief Pops as many of m entries as mirrored FIFO buffer holds.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param pop_buffer - pointer to the buffer into which the values will be popped
+ *	@param m - maximal amount of entries to be popped
+ *
+ *	@retval returns: amount of entries popped, 0 if FIFO buffer is empty or any pointer is NULL
+ */
+fifo_size_t fifo_mirror_read_some(fifo_mirror_TD *fifo, void *pop_buffer, fifo_size_t m)
+{
+	if((fifo == NULL) || (pop_buffer == NULL)) return 0; /* pointer NULL */
+
+	if(m > (fifo->max_size - fifo->free_size)) m = (fifo->max_size - fifo->free_size);
+	if(m == 0) return 0; /* fifo empty */
+
+	fifo_mirror_pop_mul(fifo, pop_buffer, m);
+
+	return m;
+}
+
+/**
+ *	@brief Pops entries from mirrored FIFO buffer into a scatter list as one unit, one copy per piece.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param iov - pointer to the list of pieces, lengths in entries
+ *	@param iov_count - amount of pieces in the list
+ *
+ *	@retval returns:	0 - all of the pieces was filled
+ *					-1 - fifo pointer is NULL
+ *					-2 - iovec pointer or pointer of a non-empty piece is NULL
+ *					-3 - total length of the pieces is zero
+ *					-4 - FIFO buffer current size lower than total length
+ *
+ */
+int fifo_mirror_popv(fifo_mirror_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count)
+{
+	fifo_index_t total = 0;
+	fifo_size_t i = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(iov == NULL) return -2; /* iovec pointer NULL */
+
+	total = fifo_iov_total(iov, iov_count);
+
+	if(total == FIFO_INDEX_MAX) return -2; /* piece pointer NULL */
+	if(total == 0) return -3; /* zero total length */
+	if(total > (fifo_index_t)(fifo->max_size - fifo->free_size)) return -4; /* current size lower than total length */
+
+	for(i = 0; i < iov_count; i++)
+	{
+		if(iov[i].len == 0) continue;
+
+		memcpy(iov[i].base, fifo->head_ptr, ((size_t)iov[i].len * fifo->entry_size));
+		fifo->head_ptr = fifo_mirror_advance(fifo, fifo->head_ptr, iov[i].len);
+	}
+
+	fifo->free_size += (fifo_size_t)total;
+
+	return 0;
+}
+
+/**
+ *	@brief Gives direct access to n entries at the head of mirrored FIFO buffer without copying them.
+ *	Entries are contiguous and stay in FIFO buffer until fifo_mirror_release() is called.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param n - amount of entries to be peeked
+ *	@param region - pointer to the contiguous span of n entries
+ *
+ *	@retval returns:	0 - n entries are available in region
+ *					-1 - fifo pointer is NULL
+ *					-2 - region pointer is NULL
+ *					-3 - amount of the entries to be peeked is zero
+ *					-4 - FIFO buffer current size lower than n
+ *
+ */
+int fifo_mirror_peek(fifo_mirror_TD *fifo, fifo_size_t n, void **region)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(region == NULL) return -2; /* region pointer NULL */
+	if(n == 0) return -3; /* zero n */
+	if(n > (fifo->max_size - fifo->free_size)) return -4; /* current size lower than n */
+
+	*region = fifo->head_ptr;
+
+	return 0;
+}
+
+/**
+ *	@brief Releases n entries previously accessed with fifo_mirror_peek().
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param n - amount of entries to be released
+ *
+ *	@retval returns:	0 - n entries released
+ *					-1 - fifo pointer is NULL
+ *					-3 - amount of the entries to be released is zero
+ *					-4 - FIFO buffer current size lower than n
+ *
+ */
+int fifo_mirror_release(fifo_mirror_TD *fifo, fifo_size_t n)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(n == 0) return -3; /* zero n */
+	if(n > (fifo->max_size - fifo->free_size)) return -4; /* current size lower than n */
+
+	fifo->head_ptr = fifo_mirror_advance(fifo, fifo->head_ptr, n);
+	fifo->free_size += n;
+
+	return 0;
+}
+
+/**
+ *	@brief Pushes value into mirrored FIFO buffer.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param val_buffer - value buffer to push
+ *
+ *	@retval returns: 0 - tail pushed successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - value buffer pointer is NULL
+ *					-3 - FIFO buffer full
+ */
+int fifo_mirror_push(fifo_mirror_TD *fifo, void *val_buffer)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
+	if(fifo->free_size == 0) return -3; /* fifo FULL */
+
+	memcpy(fifo->tail_ptr, val_buffer, fifo->entry_size);
+	fifo->tail_ptr = fifo_mirror_advance(fifo, fifo->tail_ptr, 1);
+	fifo->free_size--;
+
+	return 0;
+}
+
+/**
+ *	@brief Pushes m entries into mirrored FIFO buffer with a single copy.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param push_buffer - pointer to the buffer from which the values will be pushed
+ *	@param m - amount of entries to be pushed
+ *
+ *	@retval returns:	0 - all of the m entries was pushed
+ *					-1 - fifo pointer is NULL
+ *					-2 - push buffer pointer is NULL
+ *					-3 - amount of the entries to be pushed is zero
+ *					-4 - no place for m element in FIFO buffer
+ *
+ */
+int fifo_mirror_push_mul(fifo_mirror_TD *fifo, void *push_buffer, fifo_size_t m)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(push_buffer == NULL) return -2; /* push buffer pointer NULL */
+	if(m == 0) return -3; /* zero m */
+	if(m > fifo->free_size) return -4; /* no place for m elements in FIFO */
+
+	memcpy(fifo->tail_ptr, push_buffer, ((size_t)m * fifo->entry_size));
+	fifo->tail_ptr = fifo_mirror_advance(fifo, fifo->tail_ptr, m);
+	fifo->free_size -= m;
+
+	return 0;
+}
+
+/**
+ *	@brief Pushes as many of m entries as fit into mirrored FIFO buffer.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param push_buffer - pointer to the buffer from which the values will be pushed
+ *	@param m - maximal amount of entries to be pushed
+ *
+ *	@retval returns: amount of entries pushed, 0 if FIFO buffer is full or any pointer is NULL
+ */
+fifo_size_t fifo_mirror_write_some(fifo_mirror_TD *fifo, void *push_buffer, fifo_size_t m)
+{
+	if((fifo == NULL) || (push_buffer == NULL)) return 0; /* pointer NULL */
+
+	if(m > fifo->free_size) m = fifo->free_size;
+	if(m == 0) return 0; /* fifo full */
+
+	fifo_mirror_push_mul(fifo, push_buffer, m);
+
+	return m;
+}
+
+/**
+ *	@brief Pushes entries of a gather list into mirrored FIFO buffer as one unit, one copy per piece.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param iov - pointer to the list of pieces, lengths in entries
+ *	@param iov_count - amount of pieces in the list
+ *
+ *	@retval returns:	0 - all of the pieces was pushed
+ *					-1 - fifo pointer is NULL
+ *					-2 - iovec pointer or pointer of a non-empty piece is NULL
+ *					-3 - total length of the pieces is zero
+ *					-4 - no place for total length in FIFO buffer
+ *
+ */
+int fifo_mirror_pushv(fifo_mirror_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count)
+{
+	fifo_index_t total = 0;
+	fifo_size_t i = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(iov == NULL) return -2; /* iovec pointer NULL */
+
+	total = fifo_iov_total(iov, iov_count);
+
+	if(total == FIFO_INDEX_MAX) return -2; /* piece pointer NULL */
+	if(total == 0) return -3; /* zero total length */
+	if(total > fifo->free_size) return -4; /* no place for total length in FIFO */
+
+	for(i = 0; i < iov_count; i++)
+	{
+		if(iov[i].len == 0) continue;
+
+		memcpy(fifo->tail_ptr, iov[i].base, ((size_t)iov[i].len * fifo->entry_size));
+		fifo->tail_ptr = fifo_mirror_advance(fifo, fifo->tail_ptr, iov[i].len);
+	}
+
+	fifo->free_size -= (fifo_size_t)total;
+
+	return 0;
+}
+
+/**
+ *	@brief Reserves contiguous place for n entries at the tail of mirrored FIFO buffer.
+ *	Entries become visible to pop functions after fifo_mirror_commit() is called.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param n - amount of entries to be reserved
+ *	@param region - pointer to the contiguous span of n free entries
+ *
+ *	@retval returns:	0 - place for n entries is available in region
+ *					-1 - fifo pointer is NULL
+ *					-2 - region pointer is NULL
+ *					-3 - amount of the entries to be reserved is zero
+ *					-4 - no place for n elements in FIFO buffer
+ *
+ */
+int fifo_mirror_reserve(fifo_mirror_TD *fifo, fifo_size_t n, void **region)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(region == NULL) return -2; /* region pointer NULL */
+	if(n == 0) return -3; /* zero n */
+	if(n > fifo->free_size) return -4; /* no place for n elements in FIFO */
+
+	*region = fifo->tail_ptr;
+
+	return 0;
+}
+
+/**
+ *	@brief Commits n entries written into the span given by fifo_mirror_reserve().
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param n - amount of entries to be committed
+ *
+ *	@retval returns:	0 - n entries committed
+ *					-1 - fifo pointer is NULL
+ *					-3 - amount of the entries to be committed is zero
+ *					-4 - no place for n elements in FIFO buffer
+ *
+ */
+int fifo_mirror_commit(fifo_mirror_TD *fifo, fifo_size_t n)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(n == 0) return -3; /* zero n */
+	if(n > fifo->free_size) return -4; /* no place for n elements in FIFO */
+
+	fifo->tail_ptr = fifo_mirror_advance(fifo, fifo->tail_ptr, n);
+	fifo->free_size -= n;
+
+	return 0;
+}
+
+/**
+ *	@brief Creates mirrored FIFO buffer, buffer memory is allocated and mapped twice.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param size - size of FIFO buffer, must be a multiple of fifo_mirror_granularity(entry_size)
+ *	@param entry_size - size of an entry of FIFO buffer
+ *
+ *	@retval returns: 0 - mirrored FIFO buffer created successfully
+ *					-1 - fifo pointer is NULL
+ *					-3 - size of FIFO buffer is 0
+ *					-4 - size of entry is 0
+ *					-5 - size * entry_size is not a multiple of the page size
+ *					-6 - buffer memory could not be allocated or mapped
+ */
+int fifo_mirror_init(fifo_mirror_TD *fifo, fifo_size_t size, uint16_t entry_size)
+{
+	size_t bytes = 0;
+	uint8_t *area = NULL;
+	int fd = -1;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(size == 0) return -3; /* zero size */
+	if(entry_size == 0) return -4; /* zero entry size */
+
+	bytes = ((size_t)size * entry_size);
+
+	if((bytes % (size_t)sysconf(_SC_PAGESIZE)) != 0) return -5; /* not a page multiple */
+
+	fd = memfd_create("fifo_mirror", MFD_CLOEXEC);
+	if(fd < 0) return -6; /* no memory */
+
+	if(ftruncate(fd, (off_t)bytes) != 0)
+	{
+		close(fd);
+		return -6; /* no memory */
+	}
+
+	area = mmap(NULL, (2 * bytes), PROT_NONE, (MAP_PRIVATE | MAP_ANONYMOUS), -1, 0);
+
+	if(area == MAP_FAILED)
+	{
+		close(fd);
+		return -6; /* no address range */
+	}
+
+	if((mmap(area, bytes, (PROT_READ | PROT_WRITE), (MAP_SHARED | MAP_FIXED), fd, 0) == MAP_FAILED) ||
+	   (mmap(area + bytes, bytes, (PROT_READ | PROT_WRITE), (MAP_SHARED | MAP_FIXED), fd, 0) == MAP_FAILED))
+	{
+		munmap(area, (2 * bytes));
+		close(fd);
+		return -6; /* mapping failed */
+	}
+
+	close(fd); /* mappings keep the pages alive */
+
+	fifo->buffer = area;
+	fifo->head_ptr = area;
+	fifo->tail_ptr = area;
+	fifo->limit_ptr = area + bytes;
+	fifo->entry_size = entry_size;
+	fifo->max_size = size;
+	fifo->free_size = size;
+
+	return 0;
+}
+
+/**
+ *	@brief Destroys mirrored FIFO buffer and unmaps its buffer memory.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *
+ *	@retval returns: 0 - mirrored FIFO buffer destroyed successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - buffer pointer is NULL
+ */
+int fifo_mirror_deinit(fifo_mirror_TD *fifo)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(fifo->buffer == NULL) return -2; /* buffer pointer NULL */
+
+	munmap(fifo->buffer, (2 * (size_t)(fifo->limit_ptr - fifo->buffer)));
+
+	fifo->buffer = NULL;
+	fifo->head_ptr = NULL;
+	fifo->tail_ptr = NULL;
+	fifo->limit_ptr = NULL;
+	fifo->max_size = 0;
+	fifo->free_size = 0;
+
+	return 0;
+}
+
+/**
+* 	@}
+*/
+
+/**
+* 	@}
+*/
+
+#endif /* __linux__ */
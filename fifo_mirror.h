@@ -0,0 +1,59 @@
+/**
+ * 	@file fifo_mirror.h
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Virtual-memory mirrored FIFO buffers (Linux).
+ *  The buffer pages are mapped twice back to back, so any span of up to size entries starting
+ *  inside the first mapping is contiguous in virtual memory. Push, pop, peek and reserve never split
+ *  a copy and always return a single region that can be passed to write(2)/recv(2) or a parser.
+ *  Alert: size * entry_size must be a multiple of the system page size
+ */
+
+#ifndef FIFO_MIRROR_H_
+#define FIFO_MIRROR_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "fifo_config.h"
+
+/**
+* 	@brief	Mirrored FIFO buffer type. Used for store entries with user defined size.
+*/
+typedef struct
+{
+	uint8_t *buffer;		/**< Pointer to the first of two mappings of the buffer */
+	uint8_t *head_ptr;		/**< Pointer to a head of FIFO buffer, always inside the first mapping */
+	uint8_t *tail_ptr;		/**< Pointer to a tail of FIFO buffer, always inside the first mapping */
+	uint8_t *limit_ptr;		/**< Pointer to the start of the second mapping */
+
+	uint16_t entry_size;	/**< Size of FIFO buffer entry in Bytes */
+	fifo_size_t max_size;	/**< Size of FIFO buffer */
+	fifo_size_t free_size;	/**< Free size of FIFO buffer */
+
+}fifo_mirror_TD;
+
+size_t fifo_mirror_granularity(uint16_t entry_size);
+
+int fifo_mirror_reset(fifo_mirror_TD *fifo);
+int fifo_mirror_clear(fifo_mirror_TD *fifo);
+int fifo_mirror_pop(fifo_mirror_TD *fifo, void *val_buffer);
+int fifo_mirror_pop_mul(fifo_mirror_TD *fifo, void *pop_buffer, fifo_size_t m);
+fifo_size_t fifo_mirror_read_some(fifo_mirror_TD *fifo, void *pop_buffer, fifo_size_t m);
+int fifo_mirror_popv(fifo_mirror_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count);
+int fifo_mirror_peek(fifo_mirror_TD *fifo, fifo_size_t n, void **region);
+int fifo_mirror_release(fifo_mirror_TD *fifo, fifo_size_t n);
+int fifo_mirror_push(fifo_mirror_TD *fifo, void *val_buffer);
+int fifo_mirror_push_mul(fifo_mirror_TD *fifo, void *push_buffer, fifo_size_t m);
+fifo_size_t fifo_mirror_write_some(fifo_mirror_TD *fifo, void *push_buffer, fifo_size_t m);
+int fifo_mirror_pushv(fifo_mirror_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count);
+int fifo_mirror_reserve(fifo_mirror_TD *fifo, fifo_size_t n, void **region);
+int fifo_mirror_commit(fifo_mirror_TD *fifo, fifo_size_t n);
+int fifo_mirror_init(fifo_mirror_TD *fifo, fifo_size_t size, uint16_t entry_size);
+int fifo_mirror_deinit(fifo_mirror_TD *fifo);
+
+#endif /* FIFO_MIRROR_H_ */
@@ -0,0 +1,213 @@
+/**
+ * 	@file fifo_mpmc.c
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Implementation of lock-free bounded multi-producer/multi-consumer FIFO buffers.
+ *  Alert: size of FIFO buffer must be a power of two and a buffer must hold
+ *  FIFO_MPMC_BUFFER_SIZE(size, entry_size) Bytes aligned to fifo_index_t
+ *
+ */
+
+#include "fifo_mpmc.h"
+
+/**
+*	@addtogroup Software_FIFO_buffer Software FIFO buffers
+* 	@{
+*/
+
+/**
+*	@addtogroup MPMC_FIFO_buffer MPMC FIFO buffer
+* 	@{
+*/
+
+/**
+* 	@brief	Signed type of the distance between a slot sequence number and a position.
+*/
+#if (FIFO_SIZE_BITS == 64)
+typedef int64_t fifo_mpmc_diff_t;
+#else
+typedef int32_t fifo_mpmc_diff_t;
+#endif
+
+/**
+ *	@brief Returns sequence number of the slot of position pos.
+ */
+static inline _Atomic fifo_index_t *fifo_mpmc_seq(const fifo_mpmc_TD *fifo, fifo_index_t pos)
+{
+	return (_Atomic fifo_index_t *)(fifo->buffer + ((size_t)(pos & fifo->mask) * fifo->slot_size));
+}
+
+/**
+ *	@brief Returns entry of the slot of position pos.
+ */
+static inline uint8_t *fifo_mpmc_entry(const fifo_mpmc_TD *fifo, fifo_index_t pos)
+{
+	return (fifo->buffer + ((size_t)(pos & fifo->mask) * fifo->slot_size) + sizeof(fifo_index_t));
+}
+
+/**
+ *	@brief Pops head value from MPMC FIFO buffer. May be called from any number of consumers.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param val_buffer - pointer to value store buffer
+ *
+ *	@retval returns: 0 - head popped successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - value buffer pointer is NULL
+ *					-3 - FIFO buffer empty
+ */
+int fifo_mpmc_pop(fifo_mpmc_TD *fifo, void *val_buffer)
+{
+	_Atomic fifo_index_t *seq = NULL;
+	fifo_index_t pos = 0;
+	fifo_mpmc_diff_t diff = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
+
+	pos = atomic_load_explicit(&fifo->dequeue, memory_order_relaxed);
+
+	for(;;)
+	{
+		seq = fifo_mpmc_seq(fifo, pos);
+		diff = (fifo_mpmc_diff_t)(atomic_load_explicit(seq, memory_order_acquire) - (pos + 1));
+
+		if(diff == 0)
+		{
+			if(atomic_compare_exchange_weak_explicit(&fifo->dequeue, &pos, (pos + 1), memory_order_relaxed, memory_order_relaxed)) break;
+		}
+		else if(diff < 0)
+		{
+			return -3; /* fifo empty */
+		}
+		else
+		{
+			pos = atomic_load_explicit(&fifo->dequeue, memory_order_relaxed);
+		}
+	}
+
+	memcpy(val_buffer, fifo_mpmc_entry(fifo, pos), fifo->entry_size);
+	atomic_store_explicit(seq, (pos + fifo->mask + 1), memory_order_release);
+
+	return 0;
+}
+
+/**
+ *	@brief Pushes value into MPMC FIFO buffer. May be called from any number of producers.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param val_buffer - value buffer to push
+ *
+ *	@retval returns: 0 - tail pushed successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - value buffer pointer is NULL
+ *					-3 - FIFO buffer full
+ */
+int fifo_mpmc_push(fifo_mpmc_TD *fifo, const void *val_buffer)
+{
+	_Atomic fifo_index_t *seq = NULL;
+	fifo_index_t pos = 0;
+	fifo_mpmc_diff_t diff = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
+
+	pos = atomic_load_explicit(&fifo->enqueue, memory_order_relaxed);
+
+	for(;;)
+	{
+		seq = fifo_mpmc_seq(fifo, pos);
+		diff = (fifo_mpmc_diff_t)(atomic_load_explicit(seq, memory_order_acquire) - pos);
+
+		if(diff == 0)
+		{
+			if(atomic_compare_exchange_weak_explicit(&fifo->enqueue, &pos, (pos + 1), memory_order_relaxed, memory_order_relaxed)) break;
+		}
+		else if(diff < 0)
+		{
+			return -3; /* fifo FULL */
+		}
+		else
+		{
+			pos = atomic_load_explicit(&fifo->enqueue, memory_order_relaxed);
+		}
+	}
+
+	memcpy(fifo_mpmc_entry(fifo, pos), val_buffer, fifo->entry_size);
+	atomic_store_explicit(seq, (pos + 1), memory_order_release);
+
+	return 0;
+}
+
+/**
+ *	@brief Gives approximate amount of entries in MPMC FIFO buffer, exact when no push/pop runs concurrently.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *
+ *	@retval returns: amount of entries in FIFO buffer, 0 if fifo pointer is NULL
+ */
+fifo_size_t fifo_mpmc_count(fifo_mpmc_TD *fifo)
+{
+	fifo_index_t head = 0;
+	fifo_index_t tail = 0;
+
+	if(fifo == NULL) return 0; /* fifo pointer NULL */
+
+	head = atomic_load_explicit(&fifo->dequeue, memory_order_relaxed);
+	tail = atomic_load_explicit(&fifo->enqueue, memory_order_relaxed);
+
+	if((fifo_mpmc_diff_t)(tail - head) <= 0) return 0; /* empty or consumers ahead of the snapshot */
+	if((fifo_index_t)(tail - head) > fifo->max_size) return fifo->max_size;
+
+	return (fifo_size_t)(tail - head);
+}
+
+/**
+ *	@brief Creates MPMC FIFO buffer. Must not run concurrently with push/pop.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param buffer - pointer to buffer of FIFO_MPMC_BUFFER_SIZE(size, entry_size) Bytes
+ *	@param size - size of FIFO buffer, must be a power of two
+ *	@param entry_size - size of an entry of FIFO buffer
+ *
+ *	@retval returns: 0 - MPMC FIFO buffer created successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - buffer pointer is NULL or not aligned to fifo_index_t
+ *					-3 - size of FIFO buffer is 0
+ *					-4 - size of entry is 0
+ *					-5 - size of FIFO buffer is not a power of two
+ */
+int fifo_mpmc_init(fifo_mpmc_TD *fifo, void *buffer, fifo_size_t size, uint16_t entry_size)
+{
+	fifo_index_t i = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(buffer == NULL) return -2; /* buffer pointer NULL */
+	if(((uintptr_t)buffer % _Alignof(fifo_index_t)) != 0) return -2; /* buffer not aligned */
+	if(size == 0) return -3; /* zero size */
+	if(entry_size == 0) return -4; /* zero entry size */
+	if((size & (size - 1)) != 0) return -5; /* size not a power of two */
+
+	fifo->buffer = buffer;
+	fifo->mask = (fifo_index_t)(size - 1);
+	fifo->slot_size = FIFO_MPMC_SLOT_SIZE(entry_size);
+	fifo->entry_size = entry_size;
+	fifo->max_size = size;
+
+	for(i = 0; i < size; i++) atomic_init(fifo_mpmc_seq(fifo, i), i);
+
+	atomic_init(&fifo->enqueue, 0);
+	atomic_init(&fifo->dequeue, 0);
+
+	return 0;
+}
+
+/**
+* 	@}
+*/
+
+/**
+* 	@}
+*/
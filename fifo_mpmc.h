@@ -0,0 +1,57 @@
+/**
+ * 	@file fifo_mpmc.h
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Lock-free bounded multi-producer/multi-consumer FIFO buffers.
+ *  Every slot of the buffer holds a sequence number followed by the entry (Vyukov-style),
+ *  so producers contend only on the enqueue position and consumers only on the dequeue position,
+ *  each with a single CAS per entry. Requires C11 atomics.
+ */
+
+#ifndef FIFO_MPMC_H_
+#define FIFO_MPMC_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "fifo_config.h"
+
+/**
+* 	@brief	Size in Bytes of one MPMC slot: sequence number and entry rounded up to the sequence alignment.
+*/
+#define FIFO_MPMC_SLOT_SIZE(entry_size)		\
+	((((sizeof(fifo_index_t) + (size_t)(entry_size)) + (_Alignof(fifo_index_t) - 1)) / _Alignof(fifo_index_t)) * _Alignof(fifo_index_t))
+
+/**
+* 	@brief	Size in Bytes of the buffer passed to fifo_mpmc_init() for size entries of entry_size Bytes.
+*/
+#define FIFO_MPMC_BUFFER_SIZE(size, entry_size)		((size_t)(size) * FIFO_MPMC_SLOT_SIZE(entry_size))
+
+/**
+* 	@brief	MPMC FIFO buffer type. Used for store entries with user defined size.
+*/
+typedef struct
+{
+	uint8_t *buffer;								/**< Pointer to buffer of slots, aligned to fifo_index_t */
+	fifo_index_t mask;								/**< Index mask of FIFO buffer, equal to max_size - 1 */
+	size_t slot_size;								/**< Size of one slot in Bytes */
+
+	uint16_t entry_size;							/**< Size of FIFO buffer entry in Bytes */
+	fifo_size_t max_size;							/**< Size of FIFO buffer, power of two */
+
+	FIFO_MPMC_ALIGN _Atomic fifo_index_t enqueue;	/**< Free-running write counter, shared by the producers */
+	FIFO_MPMC_ALIGN _Atomic fifo_index_t dequeue;	/**< Free-running read counter, shared by the consumers */
+
+}fifo_mpmc_TD;
+
+int fifo_mpmc_pop(fifo_mpmc_TD *fifo, void *val_buffer);
+int fifo_mpmc_push(fifo_mpmc_TD *fifo, const void *val_buffer);
+fifo_size_t fifo_mpmc_count(fifo_mpmc_TD *fifo);
+int fifo_mpmc_init(fifo_mpmc_TD *fifo, void *buffer, fifo_size_t size, uint16_t entry_size);
+
+#endif /* FIFO_MPMC_H_ */
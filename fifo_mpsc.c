@@ -0,0 +1,609 @@
+/**
+ * 	@file fifo_mpsc.c
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Implementation of lock-free multi-producer/single-consumer FIFO buffers with batched commit.
+ *  Alert: size of FIFO buffer must be a power of two, pop functions must be called
+ *  from a single consumer context. A producer preempted between claim and commit
+ *  delays publication of the runs claimed after it.
+ *
+ */
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sched.h>
+#endif
+
+#include "fifo_mpsc.h"
+
+/**
+*	@addtogroup Software_FIFO_buffer Software FIFO buffers
+* 	@{
+*/
+
+/**
+*	@addtogroup MPSC_FIFO_buffer MPSC FIFO buffer
+* 	@{
+*/
+
+/**
+ *	@brief Copies m entries into the ring starting at counter, split once at the buffer end.
+ */
+static inline void fifo_mpsc_write(const fifo_mpsc_TD *fifo, fifo_index_t counter, const uint8_t *src, fifo_size_t m)
+{
+	fifo_index_t pos = (counter & fifo->mask);
+	fifo_index_t first = (fifo->mask + 1) - pos;
+	uint8_t *buffer = fifo->buffer;
+
+	if(m <= first)
+	{
+		memcpy(buffer + ((size_t)pos * fifo->entry_size), src, ((size_t)m * fifo->entry_size));
+	}
+	else
+	{
+		memcpy(buffer + ((size_t)pos * fifo->entry_size), src, ((size_t)first * fifo->entry_size));
+		memcpy(buffer, src + ((size_t)first * fifo->entry_size), ((size_t)(m - first) * fifo->entry_size));
+	}
+}
+
+/**
+ *	@brief Copies m entries out of the ring starting at counter, split once at the buffer end.
+ */
+static inline void fifo_mpsc_read(const fifo_mpsc_TD *fifo, fifo_index_t counter, uint8_t *dst, fifo_size_t m)
+{
+	fifo_index_t pos = (counter & fifo->mask);
+	fifo_index_t first = (fifo->mask + 1) - pos;
+	const uint8_t *buffer = fifo->buffer;
+
+	if(m <= first)
+	{
+		memcpy(dst, buffer + ((size_t)pos * fifo->entry_size), ((size_t)m * fifo->entry_size));
+	}
+	else
+	{
+		memcpy(dst, buffer + ((size_t)pos * fifo->entry_size), ((size_t)first * fifo->entry_size));
+		memcpy(dst + ((size_t)first * fifo->entry_size), buffer, ((size_t)(m - first) * fifo->entry_size));
+	}
+}
+
+/**
+ *	@brief Claims a run of m slots with one CAS, returns -4 when there is no place for them.
+ */
+static inline int fifo_mpsc_claim(fifo_mpsc_TD *fifo, fifo_size_t m, fifo_index_t *start)
+{
+	fifo_index_t tail = atomic_load_explicit(&fifo->claim, memory_order_relaxed);
+	fifo_index_t head = 0;
+	fifo_index_t used = 0;
+
+	for(;;)
+	{
+		head = atomic_load_explicit(&fifo->head, memory_order_acquire);
+		used = (tail - head);
+
+		if(used > fifo->max_size)
+		{
+			tail = atomic_load_explicit(&fifo->claim, memory_order_relaxed); /* consumer passed stale tail */
+			continue;
+		}
+
+		if(m > (fifo->max_size - used)) return -4; /* no place for m elements in FIFO */
+		if(atomic_compare_exchange_weak_explicit(&fifo->claim, &tail, (tail + m), memory_order_relaxed, memory_order_relaxed)) break;
+	}
+
+	*start = tail;
+
+	return 0;
+}
+
+/**
+ *	@brief Publishes run of m slots claimed at start once all earlier runs are published.
+ *	Spins with FIFO_CPU_RELAX() and yields every FIFO_SPIN_YIELD_LIMIT spins, so a preempted earlier producer can finish.
+ */
+static inline void fifo_mpsc_publish(fifo_mpsc_TD *fifo, fifo_index_t start, fifo_size_t m)
+{
+	uint32_t spin = 0;
+
+	while(atomic_load_explicit(&fifo->publish, memory_order_acquire) != start)
+	{
+		FIFO_CPU_RELAX(); /* earlier run is still being filled */
+
+#if (FIFO_SPIN_YIELD_LIMIT != 0)
+		if(++spin >= FIFO_SPIN_YIELD_LIMIT)
+		{
+			FIFO_CPU_YIELD();
+			spin = 0;
+		}
+#else
+		(void)spin;
+#endif
+	}
+
+	atomic_store_explicit(&fifo->publish, (start + m), memory_order_release);
+}
+
+/**
+ *	@brief Returns amount of published entries seen by the consumer, re-reads publish counter only when cached copy shows less than m.
+ */
+static inline fifo_size_t fifo_mpsc_available(fifo_mpsc_TD *fifo, fifo_index_t head, fifo_size_t m)
+{
+	fifo_size_t count = (fifo_size_t)(fifo->publish_cache - head);
+
+	if(count < m)
+	{
+		fifo->publish_cache = atomic_load_explicit(&fifo->publish, memory_order_acquire);
+		count = (fifo_size_t)(fifo->publish_cache - head);
+	}
+
+	return count;
+}
+
+/**
+ * 	@brief Empties MPSC FIFO buffer in O(1), only indices are rewound. Must not run concurrently with push/pop.
+ *
+ * 	@param fifo - pointer to the FIFO buffer
+ *
+ * 	@retval returns: 0 - FIFO buffer reset successfully
+ * 					-1 - fifo pointer is NULL
+ *
+ */
+int fifo_mpsc_reset(fifo_mpsc_TD *fifo)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+
+	atomic_store_explicit(&fifo->claim, 0, memory_order_relaxed);
+	atomic_store_explicit(&fifo->publish, 0, memory_order_relaxed);
+	atomic_store_explicit(&fifo->head, 0, memory_order_relaxed);
+	fifo->publish_cache = 0;
+
+	return 0;
+}
+
+/**
+ * 	@brief Clears MPSC FIFO buffer, buffer contents are wiped as selected by FIFO_WIPE_MODE. Must not run concurrently with push/pop.
+ *
+ * 	@param fifo - pointer to the FIFO buffer
+ *
+ * 	@retval returns: 0 - FIFO buffer cleared successfully
+ * 					-1 - fifo pointer is NULL
+ *
+ */
+int fifo_mpsc_clear(fifo_mpsc_TD *fifo)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+
+	fifo_wipe(fifo->buffer, ((size_t)fifo->max_size * fifo->entry_size));
+
+	return fifo_mpsc_reset(fifo);
+}
+
+/**
+ *	@brief Pops head value from MPSC FIFO buffer. Consumer side only.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param val_buffer - pointer to value store buffer
+ *
+ *	@retval returns: 0 - head popped successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - value buffer pointer is NULL
+ *					-3 - FIFO buffer empty
+ */
+int fifo_mpsc_pop(fifo_mpsc_TD *fifo, void *val_buffer)
+{
+	fifo_index_t head = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
+
+	head = atomic_load_explicit(&fifo->head, memory_order_relaxed);
+
+	if(fifo_mpsc_available(fifo, head, 1) == 0) return -3; /* fifo empty */
+
+	memcpy(val_buffer, ((uint8_t *)fifo->buffer) + ((size_t)(head & fifo->mask) * fifo->entry_size), fifo->entry_size);
+	atomic_store_explicit(&fifo->head, (head + 1), memory_order_release);
+
+	return 0;
+}
+
+/**
+ *	@brief Pops m entries from MPSC FIFO buffer. Consumer side only.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param pop_buffer - pointer to the buffer into which the values will be popped
+ *	@param m - amount of entries to be popped
+ *
+ *	@retval returns:	0 - all of the m entries was popped
+ *					-1 - fifo pointer is NULL
+ *					-2 - pop buffer pointer is NULL
+ *					-3 - amount of the entries to be popped is zero
+ *					-4 - FIFO buffer published size lower than m
+ *
+ */
+int fifo_mpsc_pop_mul(fifo_mpsc_TD *fifo, void *pop_buffer, fifo_size_t m)
+{
+	fifo_index_t head = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(pop_buffer == NULL) return -2; /* pop buffer pointer NULL */
+	if(m == 0) return -3; /* zero m */
+
+	head = atomic_load_explicit(&fifo->head, memory_order_relaxed);
+
+	if(m > fifo_mpsc_available(fifo, head, m)) return -4; /* current size lower than m */
+
+	fifo_mpsc_read(fifo, head, pop_buffer, m);
+	atomic_store_explicit(&fifo->head, (head + m), memory_order_release);
+
+	return 0;
+}
+
+/**
+ *	@brief Pops as many of m entries as MPSC FIFO buffer has published. Consumer side only.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param pop_buffer - pointer to the buffer into which the values will be popped
+ *	@param m - maximal amount of entries to be popped
+ *
+ *	@retval returns: amount of entries popped, 0 if FIFO buffer is empty or any pointer is NULL
+ */
+fifo_size_t fifo_mpsc_read_some(fifo_mpsc_TD *fifo, void *pop_buffer, fifo_size_t m)
+{
+	fifo_index_t head = 0;
+	fifo_size_t count = 0;
+
+	if((fifo == NULL) || (pop_buffer == NULL)) return 0; /* pointer NULL */
+
+	head = atomic_load_explicit(&fifo->head, memory_order_relaxed);
+	count = fifo_mpsc_available(fifo, head, m);
+
+	if(m > count) m = count;
+	if(m == 0) return 0; /* fifo empty */
+
+	fifo_mpsc_read(fifo, head, pop_buffer, m);
+	atomic_store_explicit(&fifo->head, (head + m), memory_order_release);
+
+	return m;
+}
+
+/**
+ *	@brief Pops published entries from MPSC FIFO buffer into a scatter list as one unit. Consumer side only.
+ * 	Checks the published size once and moves the head once, pieces are filled in list order.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param iov - pointer to the list of pieces, lengths in entries
+ *	@param iov_count - amount of pieces in the list
+ *
+ *	@retval returns:	0 - all of the pieces was filled
+ *					-1 - fifo pointer is NULL
+ *					-2 - iovec pointer or pointer of a non-empty piece is NULL
+ *					-3 - total length of the pieces is zero
+ *					-4 - FIFO buffer published size lower than total length
+ *
+ */
+int fifo_mpsc_popv(fifo_mpsc_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count)
+{
+	fifo_index_t total = 0;
+	fifo_index_t head = 0;
+	fifo_size_t i = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(iov == NULL) return -2; /* iovec pointer NULL */
+
+	total = fifo_iov_total(iov, iov_count);
+
+	if(total == FIFO_INDEX_MAX) return -2; /* piece pointer NULL */
+	if(total == 0) return -3; /* zero total length */
+	if(total > fifo->max_size) return -4; /* published size lower than total length */
+
+	head = atomic_load_explicit(&fifo->head, memory_order_relaxed);
+
+	if(total > fifo_mpsc_available(fifo, head, (fifo_size_t)total)) return -4; /* published size lower than total length */
+
+	for(i = 0; i < iov_count; i++)
+	{
+		if(iov[i].len == 0) continue;
+
+		fifo_mpsc_read(fifo, head, iov[i].base, iov[i].len);
+		head += iov[i].len;
+	}
+
+	atomic_store_explicit(&fifo->head, head, memory_order_release);
+
+	return 0;
+}
+
+/**
+ *	@brief Pushes value into MPSC FIFO buffer. May be called from any number of producers.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param val_buffer - value buffer to push
+ *
+ *	@retval returns: 0 - tail pushed successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - value buffer pointer is NULL
+ *					-3 - FIFO buffer full
+ */
+int fifo_mpsc_push(fifo_mpsc_TD *fifo, const void *val_buffer)
+{
+	fifo_index_t start = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
+	if(fifo_mpsc_claim(fifo, 1, &start) != 0) return -3; /* fifo FULL */
+
+	memcpy(((uint8_t *)fifo->buffer) + ((size_t)(start & fifo->mask) * fifo->entry_size), val_buffer, fifo->entry_size);
+	fifo_mpsc_publish(fifo, start, 1);
+
+	return 0;
+}
+
+/**
+ *	@brief Pushes m entries into MPSC FIFO buffer as one run. May be called from any number of producers.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param push_buffer - pointer to the buffer from which the values will be pushed
+ *	@param m - amount of entries to be pushed
+ *
+ *	@retval returns:	0 - all of the m entries was pushed
+ *					-1 - fifo pointer is NULL
+ *					-2 - push buffer pointer is NULL
+ *					-3 - amount of the entries to be pushed is zero
+ *					-4 - no place for m element in FIFO buffer
+ *
+ */
+int fifo_mpsc_push_mul(fifo_mpsc_TD *fifo, const void *push_buffer, fifo_size_t m)
+{
+	fifo_index_t start = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(push_buffer == NULL) return -2; /* push buffer pointer NULL */
+	if(m == 0) return -3; /* zero m */
+	if(fifo_mpsc_claim(fifo, m, &start) != 0) return -4; /* no place for m elements in FIFO */
+
+	fifo_mpsc_write(fifo, start, push_buffer, m);
+	fifo_mpsc_publish(fifo, start, m);
+
+	return 0;
+}
+
+/**
+ *	@brief Pushes entries of a gather list into MPSC FIFO buffer as one run. May be called from any number of producers.
+ * 	Claims the total length with one CAS and publishes it with one store, pieces are copied in list order.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param iov - pointer to the list of pieces, lengths in entries
+ *	@param iov_count - amount of pieces in the list
+ *
+ *	@retval returns:	0 - all of the pieces was pushed
+ *					-1 - fifo pointer is NULL
+ *					-2 - iovec pointer or pointer of a non-empty piece is NULL
+ *					-3 - total length of the pieces is zero
+ *					-4 - no place for total length in FIFO buffer
+ *
+ */
+int fifo_mpsc_pushv(fifo_mpsc_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count)
+{
+	fifo_index_t total = 0;
+	fifo_index_t start = 0;
+	fifo_index_t tail = 0;
+	fifo_size_t i = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(iov == NULL) return -2; /* iovec pointer NULL */
+
+	total = fifo_iov_total(iov, iov_count);
+
+	if(total == FIFO_INDEX_MAX) return -2; /* piece pointer NULL */
+	if(total == 0) return -3; /* zero total length */
+	if(total > fifo->max_size) return -4; /* no place for total length in FIFO */
+	if(fifo_mpsc_claim(fifo, (fifo_size_t)total, &start) != 0) return -4; /* no place for total length in FIFO */
+
+	tail = start;
+
+	for(i = 0; i < iov_count; i++)
+	{
+		if(iov[i].len == 0) continue;
+
+		fifo_mpsc_write(fifo, tail, iov[i].base, iov[i].len);
+		tail += iov[i].len;
+	}
+
+	fifo_mpsc_publish(fifo, start, (fifo_size_t)total);
+
+	return 0;
+}
+
+/**
+ *	@brief Claims a run of n slots to be written in place. May be called from any number of producers.
+ *	The run becomes visible to the consumer after fifo_mpsc_commit() with the same ticket is called.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param n - amount of entries to be reserved
+ *	@param ticket - start of the claimed run, to be passed to fifo_mpsc_commit()
+ *	@param region1 - pointer to the first contiguous span of free entries
+ *	@param len1 - amount of entries in the first span
+ *	@param region2 - pointer to the second span after wraparound, NULL if there is no wraparound
+ *	@param len2 - amount of entries in the second span
+ *
+ *	@retval returns:	0 - place for n entries is available in region1 and region2
+ *					-1 - fifo pointer is NULL
+ *					-2 - ticket, region or length pointer is NULL
+ *					-3 - amount of the entries to be reserved is zero
+ *					-4 - no place for n elements in FIFO buffer
+ *
+ */
+int fifo_mpsc_reserve(fifo_mpsc_TD *fifo, fifo_size_t n, fifo_index_t *ticket, void **region1, fifo_size_t *len1, void **region2, fifo_size_t *len2)
+{
+	fifo_index_t start = 0;
+	fifo_index_t pos = 0;
+	fifo_size_t first = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if((ticket == NULL) || (region1 == NULL) || (len1 == NULL) || (region2 == NULL) || (len2 == NULL)) return -2; /* region pointer NULL */
+	if(n == 0) return -3; /* zero n */
+	if(fifo_mpsc_claim(fifo, n, &start) != 0) return -4; /* no place for n elements in FIFO */
+
+	pos = (start & fifo->mask);
+	first = (fifo_size_t)(fifo->max_size - pos);
+
+	*ticket = start;
+	*region1 = ((uint8_t *)fifo->buffer) + ((size_t)pos * fifo->entry_size);
+
+	if(n <= first)
+	{
+		*len1 = n;
+		*region2 = NULL;
+		*len2 = 0;
+	}
+	else
+	{
+		*len1 = first;
+		*region2 = fifo->buffer;
+		*len2 = (n - first);
+	}
+
+	return 0;
+}
+
+/**
+ *	@brief Publishes a run of n entries claimed by fifo_mpsc_reserve(). Waits until earlier runs are published.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param ticket - start of the claimed run given by fifo_mpsc_reserve()
+ *	@param n - amount of entries reserved with the ticket
+ *
+ *	@retval returns:	0 - n entries committed
+ *					-1 - fifo pointer is NULL
+ *					-3 - amount of the entries to be committed is zero
+ */
+int fifo_mpsc_commit(fifo_mpsc_TD *fifo, fifo_index_t ticket, fifo_size_t n)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(n == 0) return -3; /* zero n */
+
+	fifo_mpsc_publish(fifo, ticket, n);
+
+	return 0;
+}
+
+/**
+ *	@brief Creates MPSC FIFO buffer. Must not run concurrently with push/pop.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param buffer - pointer to buffer that stores values
+ *	@param size - size of FIFO buffer, must be a power of two
+ *	@param entry_size - size of an entry of FIFO buffer
+ *	@param clear_flag - specifies whether the buffer need to be cleared, see FIFO_WIPE_MODE
+ *
+ *	@retval returns: 0 - MPSC FIFO buffer created successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - buffer pointer is NULL
+ *					-3 - size of FIFO buffer is 0
+ *					-4 - size of entry is 0
+ *					-5 - size of FIFO buffer is not a power of two
+ */
+int fifo_mpsc_init(fifo_mpsc_TD *fifo, void *buffer, fifo_size_t size, uint16_t entry_size, bool clear_flag)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(buffer == NULL) return -2; /* buffer pointer NULL */
+	if(size == 0) return -3; /* zero size */
+	if(entry_size == 0) return -4; /* zero entry size */
+	if((size & (size - 1)) != 0) return -5; /* size not a power of two */
+
+	fifo->buffer = buffer;
+	fifo->mask = (fifo_index_t)(size - 1);
+	fifo->entry_size = entry_size;
+	fifo->max_size = size;
+	fifo->publish_cache = 0;
+	atomic_init(&fifo->claim, 0);
+	atomic_init(&fifo->publish, 0);
+	atomic_init(&fifo->head, 0);
+
+	if(clear_flag == true) fifo_wipe(buffer, ((size_t)size * entry_size));
+
+	return 0;
+}
+
+/**
+ *	@brief Adds value to the staging buffer, pushes staged entries as one run when it becomes full.
+ *
+ *	@param stage - pointer to the staging buffer
+ *	@param val_buffer - value buffer to stage
+ *
+ *	@retval returns: 0 - value staged successfully
+ *					-1 - stage pointer is NULL
+ *					-2 - value buffer pointer is NULL
+ *					-3 - staging buffer full and MPSC FIFO buffer has no place for it
+ */
+int fifo_mpsc_stage_push(fifo_mpsc_stage_TD *stage, const void *val_buffer)
+{
+	uint16_t entry_size = 0;
+
+	if(stage == NULL) return -1; /* stage pointer NULL */
+	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
+	if((stage->count == stage->size) && (fifo_mpsc_stage_flush(stage) != 0)) return -3; /* stage FULL */
+
+	entry_size = stage->fifo->entry_size;
+
+	memcpy(((uint8_t *)stage->buffer) + ((size_t)stage->count * entry_size), val_buffer, entry_size);
+	stage->count++;
+
+	if(stage->count == stage->size) (void)fifo_mpsc_stage_flush(stage);
+
+	return 0;
+}
+
+/**
+ *	@brief Pushes all of the staged entries into MPSC FIFO buffer as one run.
+ *
+ *	@param stage - pointer to the staging buffer
+ *
+ *	@retval returns: 0 - staged entries pushed or nothing staged
+ *					-1 - stage pointer is NULL
+ *					-4 - no place for staged entries in MPSC FIFO buffer, they stay staged
+ */
+int fifo_mpsc_stage_flush(fifo_mpsc_stage_TD *stage)
+{
+	if(stage == NULL) return -1; /* stage pointer NULL */
+	if(stage->count == 0) return 0; /* nothing staged */
+	if(fifo_mpsc_push_mul(stage->fifo, stage->buffer, stage->count) != 0) return -4; /* no place in FIFO */
+
+	stage->count = 0;
+
+	return 0;
+}
+
+/**
+ *	@brief Creates per-thread staging buffer of MPSC FIFO buffer producer.
+ *
+ *	@param stage - pointer to the staging buffer
+ *	@param fifo - pointer to the MPSC FIFO buffer to flush into
+ *	@param buffer - pointer to buffer of size entries of fifo entry size
+ *	@param size - size of staging buffer, at most size of MPSC FIFO buffer
+ *
+ *	@retval returns: 0 - staging buffer created successfully
+ *					-1 - stage or fifo pointer is NULL
+ *					-2 - buffer pointer is NULL
+ *					-3 - size of staging buffer is 0 or larger than MPSC FIFO buffer
+ */
+int fifo_mpsc_stage_init(fifo_mpsc_stage_TD *stage, fifo_mpsc_TD *fifo, void *buffer, fifo_size_t size)
+{
+	if((stage == NULL) || (fifo == NULL)) return -1; /* pointer NULL */
+	if(buffer == NULL) return -2; /* buffer pointer NULL */
+	if((size == 0) || (size > fifo->max_size)) return -3; /* wrong size */
+
+	stage->fifo = fifo;
+	stage->buffer = buffer;
+	stage->size = size;
+	stage->count = 0;
+
+	return 0;
+}
+
+/**
+* 	@}
+*/
+
+/**
+* 	@}
+*/
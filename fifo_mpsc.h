@@ -0,0 +1,76 @@
+/**
+ * 	@file fifo_mpsc.h
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Lock-free multi-producer/single-consumer FIFO buffers with batched commit.
+ *  A producer claims a run of m slots with one CAS on the claim counter, fills the run and
+ *  publishes it with one store, so the atomic cost is per batch instead of per entry.
+ *  Runs are published in claim order, the consumer sees one contiguous published range
+ *  and drains it with a single pop_mul/read_some call. pushv claims the total length of a gather list
+ *  as one run, so its pieces are never interleaved with entries of other producers. Requires C11 atomics.
+ *
+ *  fifo_mpsc_stage_TD is a per-thread staging buffer that collects single entries
+ *  and pushes them as one run when it is full or flushed.
+ */
+
+#ifndef FIFO_MPSC_H_
+#define FIFO_MPSC_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "fifo_config.h"
+
+/**
+* 	@brief	MPSC FIFO buffer type. Used for store entries with user defined size.
+*/
+typedef struct
+{
+	void *buffer;									/**< Pointer to buffer that stores values */
+	fifo_index_t mask;								/**< Index mask of FIFO buffer, equal to max_size - 1 */
+
+	uint16_t entry_size;							/**< Size of FIFO buffer entry in Bytes */
+	fifo_size_t max_size;							/**< Size of FIFO buffer, power of two */
+
+	FIFO_MPMC_ALIGN _Atomic fifo_index_t claim;		/**< Free-running counter of claimed slots, shared by the producers */
+	FIFO_MPMC_ALIGN _Atomic fifo_index_t publish;	/**< Free-running counter of published slots, advanced in claim order */
+	FIFO_MPMC_ALIGN _Atomic fifo_index_t head;		/**< Free-running read counter, written by the consumer only */
+	fifo_index_t publish_cache;						/**< Consumer copy of publish counter */
+
+}fifo_mpsc_TD;
+
+/**
+* 	@brief	Per-thread staging buffer of MPSC FIFO buffer producer.
+*/
+typedef struct
+{
+	fifo_mpsc_TD *fifo;		/**< Pointer to the MPSC FIFO buffer to flush into */
+	void *buffer;			/**< Pointer to buffer that stores staged values */
+	fifo_size_t size;		/**< Size of staging buffer */
+	fifo_size_t count;		/**< Amount of staged entries */
+
+}fifo_mpsc_stage_TD;
+
+int fifo_mpsc_reset(fifo_mpsc_TD *fifo);
+int fifo_mpsc_clear(fifo_mpsc_TD *fifo);
+int fifo_mpsc_pop(fifo_mpsc_TD *fifo, void *val_buffer);
+int fifo_mpsc_pop_mul(fifo_mpsc_TD *fifo, void *pop_buffer, fifo_size_t m);
+fifo_size_t fifo_mpsc_read_some(fifo_mpsc_TD *fifo, void *pop_buffer, fifo_size_t m);
+int fifo_mpsc_popv(fifo_mpsc_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count);
+int fifo_mpsc_push(fifo_mpsc_TD *fifo, const void *val_buffer);
+int fifo_mpsc_push_mul(fifo_mpsc_TD *fifo, const void *push_buffer, fifo_size_t m);
+int fifo_mpsc_pushv(fifo_mpsc_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count);
+int fifo_mpsc_reserve(fifo_mpsc_TD *fifo, fifo_size_t n, fifo_index_t *ticket, void **region1, fifo_size_t *len1, void **region2, fifo_size_t *len2);
+int fifo_mpsc_commit(fifo_mpsc_TD *fifo, fifo_index_t ticket, fifo_size_t n);
+int fifo_mpsc_init(fifo_mpsc_TD *fifo, void *buffer, fifo_size_t size, uint16_t entry_size, bool clear_flag);
+
+int fifo_mpsc_stage_push(fifo_mpsc_stage_TD *stage, const void *val_buffer);
+int fifo_mpsc_stage_flush(fifo_mpsc_stage_TD *stage);
+int fifo_mpsc_stage_init(fifo_mpsc_stage_TD *stage, fifo_mpsc_TD *fifo, void *buffer, fifo_size_t size);
+
+#endif /* FIFO_MPSC_H_ */
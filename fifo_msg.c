@@ -0,0 +1,337 @@
+/**
+ * 	@file fifo_msg.c
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Implementation of variable-length message FIFO buffers.
+ *  Alert: size of FIFO buffer must be a power of two, push/reserve/commit must be called
+ *  from a single producer context and pop/peek/release from a single consumer context.
+ *
+ */
+
+#include "fifo_msg.h"
+
+/**
+*	@addtogroup Software_FIFO_buffer Software FIFO buffers
+* 	@{
+*/
+
+/**
+*	@addtogroup Message_FIFO_buffer Message FIFO buffer
+* 	@{
+*/
+
+/**
+ *	@brief Reads record header at counter.
+ */
+static inline uint16_t fifo_msg_header(const fifo_msg_TD *fifo, fifo_index_t counter)
+{
+	uint16_t header = 0;
+
+	memcpy(&header, (fifo->buffer + (counter & fifo->mask)), sizeof(header));
+
+	return header;
+}
+
+/**
+ *	@brief Writes record header at counter.
+ */
+static inline void fifo_msg_set_header(fifo_msg_TD *fifo, fifo_index_t counter, uint16_t header)
+{
+	memcpy((fifo->buffer + (counter & fifo->mask)), &header, sizeof(header));
+}
+
+/**
+ *	@brief Finds head record of the consumer, skipping padding markers. Returns -3 when there is none.
+ */
+static inline int fifo_msg_front(fifo_msg_TD *fifo, fifo_index_t *head, uint16_t *len)
+{
+	fifo_index_t tail = atomic_load_explicit(&fifo->tail, memory_order_acquire);
+	uint16_t header = 0;
+
+	*head = atomic_load_explicit(&fifo->head, memory_order_relaxed);
+
+	for(;;)
+	{
+		if(*head == tail) return -3; /* fifo empty */
+
+		header = fifo_msg_header(fifo, *head);
+		if(header != FIFO_MSG_PAD) break;
+
+		*head += (fifo->max_size - (*head & fifo->mask)); /* skip to buffer start */
+		atomic_store_explicit(&fifo->head, *head, memory_order_release);
+	}
+
+	*len = header;
+
+	return 0;
+}
+
+/**
+ * 	@brief Empties message FIFO buffer in O(1), only indices are rewound. Not safe while producer or consumer is active.
+ *
+ * 	@param fifo - pointer to the FIFO buffer
+ *
+ * 	@retval returns: 0 - FIFO buffer reset successfully
+ * 					-1 - fifo pointer is NULL
+ */
+int fifo_msg_reset(fifo_msg_TD *fifo)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+
+	fifo->reserve_start = 0;
+	fifo->reserve_len = 0;
+	atomic_store_explicit(&fifo->head, 0, memory_order_relaxed);
+	atomic_store_explicit(&fifo->tail, 0, memory_order_release);
+
+	return 0;
+}
+
+/**
+ *	@brief Pops head message from message FIFO buffer as a whole. Consumer side only.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param msg_buffer - pointer to the buffer into which the message will be popped
+ *	@param buffer_size - size of the message buffer in Bytes
+ *	@param len - pointer to store length of the popped message, may be NULL
+ *
+ *	@retval returns: 0 - head message popped successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - message buffer pointer is NULL
+ *					-3 - FIFO buffer empty
+ *					-4 - message longer than buffer_size, it is left in FIFO buffer
+ */
+int fifo_msg_pop(fifo_msg_TD *fifo, void *msg_buffer, uint16_t buffer_size, uint16_t *len)
+{
+	fifo_index_t head = 0;
+	uint16_t msg_len = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(msg_buffer == NULL) return -2; /* message buffer pointer NULL */
+	if(fifo_msg_front(fifo, &head, &msg_len) != 0) return -3; /* fifo empty */
+
+	if(len != NULL) *len = msg_len;
+	if(msg_len > buffer_size) return -4; /* message does not fit the buffer */
+
+	memcpy(msg_buffer, (fifo->buffer + (head & fifo->mask) + sizeof(uint16_t)), msg_len);
+	atomic_store_explicit(&fifo->head, (head + FIFO_MSG_RECORD_SIZE(msg_len)), memory_order_release);
+
+	return 0;
+}
+
+/**
+ *	@brief Gives head message of message FIFO buffer in place without removing it. Consumer side only.
+ * 	The message stays valid until fifo_msg_release() is called.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param msg - pointer to store address of the message payload
+ *	@param len - pointer to store length of the message
+ *
+ *	@retval returns: 0 - head message given successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - msg or len pointer is NULL
+ *					-3 - FIFO buffer empty
+ */
+int fifo_msg_peek(fifo_msg_TD *fifo, void **msg, uint16_t *len)
+{
+	fifo_index_t head = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if((msg == NULL) || (len == NULL)) return -2; /* output pointer NULL */
+	if(fifo_msg_front(fifo, &head, len) != 0) return -3; /* fifo empty */
+
+	*msg = (fifo->buffer + (head & fifo->mask) + sizeof(uint16_t));
+
+	return 0;
+}
+
+/**
+ *	@brief Removes head message of message FIFO buffer, completes fifo_msg_peek(). Consumer side only.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *
+ *	@retval returns: 0 - head message released successfully
+ *					-1 - fifo pointer is NULL
+ *					-3 - FIFO buffer empty
+ */
+int fifo_msg_release(fifo_msg_TD *fifo)
+{
+	fifo_index_t head = 0;
+	uint16_t len = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(fifo_msg_front(fifo, &head, &len) != 0) return -3; /* fifo empty */
+
+	atomic_store_explicit(&fifo->head, (head + FIFO_MSG_RECORD_SIZE(len)), memory_order_release);
+
+	return 0;
+}
+
+/**
+ *	@brief Pushes message into message FIFO buffer. Producer side only.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param msg - pointer to the message payload
+ *	@param len - length of the message in Bytes
+ *
+ *	@retval returns: 0 - message pushed successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - message pointer is NULL
+ *					-3 - length is 0 or larger than FIFO_MSG_MAX_LEN
+ *					-4 - no contiguous place for the record in FIFO buffer
+ */
+int fifo_msg_push(fifo_msg_TD *fifo, const void *msg, uint16_t len)
+{
+	void *region = NULL;
+	int result = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(msg == NULL) return -2; /* message pointer NULL */
+
+	result = fifo_msg_reserve(fifo, len, &region);
+	if(result != 0) return result;
+
+	memcpy(region, msg, len);
+
+	return fifo_msg_commit(fifo, len);
+}
+
+/**
+ *	@brief Reserves contiguous place for a message of len Bytes to be written in place. Producer side only.
+ * 	The region is published by fifo_msg_commit(), a new reserve replaces a pending one.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param len - length of the message in Bytes
+ *	@param region - pointer to store address of the payload region
+ *
+ *	@retval returns: 0 - place reserved successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - region pointer is NULL
+ *					-3 - length is 0 or larger than FIFO_MSG_MAX_LEN
+ *					-4 - no contiguous place for the record in FIFO buffer
+ */
+int fifo_msg_reserve(fifo_msg_TD *fifo, uint16_t len, void **region)
+{
+	fifo_index_t tail = 0;
+	fifo_index_t head = 0;
+	fifo_index_t free_size = 0;
+	fifo_index_t to_end = 0;
+	size_t record = FIFO_MSG_RECORD_SIZE(len);
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(region == NULL) return -2; /* region pointer NULL */
+	if((len == 0) || (len > FIFO_MSG_MAX_LEN)) return -3; /* zero or too long message */
+	if(record > fifo->max_size) return -4; /* record larger than FIFO */
+
+	tail = atomic_load_explicit(&fifo->tail, memory_order_relaxed);
+	head = atomic_load_explicit(&fifo->head, memory_order_acquire);
+	free_size = (fifo->max_size - (tail - head));
+	to_end = (fifo->max_size - (tail & fifo->mask));
+
+	if(record <= to_end)
+	{
+		if(record > free_size) return -4; /* no place for the record */
+	}
+	else
+	{
+		if((to_end + record) > free_size) return -4; /* no place for padding and the record */
+
+		fifo_msg_set_header(fifo, tail, FIFO_MSG_PAD);
+		tail += to_end;
+	}
+
+	fifo->reserve_start = tail;
+	fifo->reserve_len = len;
+	*region = (fifo->buffer + (tail & fifo->mask) + sizeof(uint16_t));
+
+	return 0;
+}
+
+/**
+ *	@brief Publishes message written into the region given by fifo_msg_reserve(). Producer side only.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param len - length of the written message, at most the reserved length
+ *
+ *	@retval returns: 0 - message committed successfully
+ *					-1 - fifo pointer is NULL
+ *					-3 - length is 0
+ *					-4 - nothing reserved or length larger than the reserved one
+ */
+int fifo_msg_commit(fifo_msg_TD *fifo, uint16_t len)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(len == 0) return -3; /* zero length */
+	if(len > fifo->reserve_len) return -4; /* longer than reservation */
+
+	fifo_msg_set_header(fifo, fifo->reserve_start, len);
+	fifo->reserve_len = 0;
+	atomic_store_explicit(&fifo->tail, (fifo->reserve_start + FIFO_MSG_RECORD_SIZE(len)), memory_order_release);
+
+	return 0;
+}
+
+/**
+ *	@brief Gives free size of message FIFO buffer in Bytes. Producer side only.
+ * 	A record of FIFO_MSG_RECORD_SIZE(len) Bytes fits for sure only if it does not exceed the contiguous part of it.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *
+ *	@retval returns: free size in Bytes, 0 if fifo pointer is NULL
+ */
+fifo_size_t fifo_msg_free(fifo_msg_TD *fifo)
+{
+	fifo_index_t tail = 0;
+	fifo_index_t head = 0;
+
+	if(fifo == NULL) return 0; /* fifo pointer NULL */
+
+	tail = atomic_load_explicit(&fifo->tail, memory_order_relaxed);
+	head = atomic_load_explicit(&fifo->head, memory_order_acquire);
+
+	return (fifo_size_t)(fifo->max_size - (tail - head));
+}
+
+/**
+ *	@brief Creates message FIFO buffer. Must not run concurrently with push/pop.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param buffer - pointer to byte buffer that stores records
+ *	@param size - size of FIFO buffer in Bytes, must be a power of two
+ *	@param clear_flag - specifies whether the buffer need to be cleared, see FIFO_WIPE_MODE
+ *
+ *	@retval returns: 0 - message FIFO buffer created successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - buffer pointer is NULL
+ *					-3 - size of FIFO buffer is lower than one record header
+ *					-5 - size of FIFO buffer is not a power of two
+ */
+int fifo_msg_init(fifo_msg_TD *fifo, void *buffer, fifo_size_t size, bool clear_flag)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(buffer == NULL) return -2; /* buffer pointer NULL */
+	if(size < FIFO_MSG_RECORD_SIZE(1)) return -3; /* too small size */
+	if((size & (size - 1)) != 0) return -5; /* size not a power of two */
+
+	fifo->buffer = buffer;
+	fifo->mask = (fifo_index_t)(size - 1);
+	fifo->max_size = size;
+	fifo->reserve_start = 0;
+	fifo->reserve_len = 0;
+
+	atomic_init(&fifo->tail, 0);
+	atomic_init(&fifo->head, 0);
+
+	if(clear_flag == true) fifo_wipe(buffer, (size_t)size);
+
+	return 0;
+}
+
+/**
+* 	@}
+*/
+
+/**
+* 	@}
+*/
@@ -0,0 +1,72 @@
+/**
+ * 	@file fifo_msg.h
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Variable-length message FIFO buffers on a byte ring.
+ *  Every record is a uint16_t length header followed by the payload, rounded up to the header size,
+ *  so a ring holds messages of different sizes without padding them to the largest one.
+ *  A record never wraps: when it does not fit before the buffer end the producer writes
+ *  a FIFO_MSG_PAD header there and places the record at the buffer start, so both
+ *  reserve/commit and peek/release hand out one contiguous region.
+ *
+ *  The producer writes only the tail and the consumer writes only the head, so one push side
+ *  and one pop side may run concurrently without critical sections. Requires C11 atomics.
+ */
+
+#ifndef FIFO_MSG_H_
+#define FIFO_MSG_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "fifo_config.h"
+
+/**
+* 	@brief	Header value marking the rest of the buffer up to its end as skipped.
+*/
+#define FIFO_MSG_PAD				UINT16_MAX
+
+/**
+* 	@brief	Largest payload of one message in Bytes.
+*/
+#define FIFO_MSG_MAX_LEN			(FIFO_MSG_PAD - 1)
+
+/**
+* 	@brief	Bytes taken in the ring by a message of len Bytes: header and payload rounded up to the header size.
+*/
+#define FIFO_MSG_RECORD_SIZE(len)	\
+	((((sizeof(uint16_t) + (size_t)(len)) + (sizeof(uint16_t) - 1)) / sizeof(uint16_t)) * sizeof(uint16_t))
+
+/**
+* 	@brief	Message FIFO buffer type. Used for store messages of variable length.
+*/
+typedef struct
+{
+	uint8_t *buffer;							/**< Pointer to byte buffer that stores records */
+	fifo_index_t mask;							/**< Index mask of FIFO buffer, equal to max_size - 1 */
+	fifo_size_t max_size;						/**< Size of FIFO buffer in Bytes, power of two */
+
+	FIFO_SPSC_ALIGN _Atomic fifo_index_t tail;	/**< Free-running write counter in Bytes, written by the producer only */
+	fifo_index_t reserve_start;					/**< Record position of the pending reservation */
+	uint16_t reserve_len;						/**< Payload length of the pending reservation, 0 if there is none */
+
+	FIFO_SPSC_ALIGN _Atomic fifo_index_t head;	/**< Free-running read counter in Bytes, written by the consumer only */
+
+}fifo_msg_TD;
+
+int fifo_msg_reset(fifo_msg_TD *fifo);
+int fifo_msg_pop(fifo_msg_TD *fifo, void *msg_buffer, uint16_t buffer_size, uint16_t *len);
+int fifo_msg_peek(fifo_msg_TD *fifo, void **msg, uint16_t *len);
+int fifo_msg_release(fifo_msg_TD *fifo);
+int fifo_msg_push(fifo_msg_TD *fifo, const void *msg, uint16_t len);
+int fifo_msg_reserve(fifo_msg_TD *fifo, uint16_t len, void **region);
+int fifo_msg_commit(fifo_msg_TD *fifo, uint16_t len);
+fifo_size_t fifo_msg_free(fifo_msg_TD *fifo);
+int fifo_msg_init(fifo_msg_TD *fifo, void *buffer, fifo_size_t size, bool clear_flag);
+
+#endif /* FIFO_MSG_H_ */
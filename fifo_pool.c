@@ -0,0 +1,324 @@
+/**
+ * 	@file fifo_pool.c
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Implementation of pools of equally sized FIFO buffers carved out of one arena.
+ *  Alert: not thread-safe, fifo_pool_create is Linux only
+ *
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE
+#include <sys/mman.h>
+#endif
+
+#include "fifo_pool.h"
+
+/**
+*	@addtogroup Software_FIFO_buffer Software FIFO buffers
+* 	@{
+*/
+
+/**
+*	@addtogroup pool_FIFO_buffer FIFO buffer pool
+* 	@{
+*/
+
+/**
+ *	@brief Rounds n up to a multiple of align, align is a power of two.
+ */
+static inline size_t fifo_pool_round(size_t n, size_t align)
+{
+	return ((n + (align - 1)) & ~(align - 1));
+}
+
+/**
+ *	@brief Gives descriptor of slot i of FIFO pool.
+ */
+static inline fifo_pool_desc_TD *fifo_pool_slot(fifo_pool_TD *pool, uint32_t i)
+{
+	return (fifo_pool_desc_TD *)(pool->arena + ((size_t)i * pool->slot_size));
+}
+
+/**
+ *	@brief Takes the first free slot of FIFO pool, returns NULL when exhausted.
+ */
+static inline fifo_pool_desc_TD *fifo_pool_take(fifo_pool_TD *pool)
+{
+	fifo_pool_desc_TD *desc = NULL;
+
+	if(pool == NULL) return NULL; /* pool pointer NULL */
+	if(pool->free_head == FIFO_POOL_NONE) return NULL; /* pool exhausted */
+
+	desc = fifo_pool_slot(pool, pool->free_head);
+	pool->free_head = desc->next;
+	pool->free_count--;
+	desc->state = FIFO_POOL_USED;
+
+	return desc;
+}
+
+/**
+ *	@brief Gives size of one slot of FIFO pool: descriptor and buffer storage, cache line aligned.
+ *
+ *	@param size - size of FIFO buffers
+ *	@param entry_size - size of an entry of FIFO buffers
+ *
+ *	@retval returns: size of a slot in Bytes, 0 if size or entry size is 0
+ */
+size_t fifo_pool_slot_size(fifo_size_t size, uint16_t entry_size)
+{
+	size_t desc_size = fifo_pool_round(sizeof(fifo_pool_desc_TD), FIFO_CACHE_LINE_SIZE);
+
+	if((size == 0) || (entry_size == 0)) return 0; /* zero size */
+
+	return fifo_pool_round((desc_size + ((size_t)size * entry_size)), FIFO_CACHE_LINE_SIZE);
+}
+
+/**
+ *	@brief Gives size of an arena holding count FIFO buffers.
+ *
+ *	@param count - amount of FIFO buffers
+ *	@param size - size of FIFO buffers
+ *	@param entry_size - size of an entry of FIFO buffers
+ *
+ *	@retval returns: size of the arena in Bytes, 0 if any argument is 0 or the size overflows
+ */
+size_t fifo_pool_arena_size(uint32_t count, fifo_size_t size, uint16_t entry_size)
+{
+	size_t slot_size = fifo_pool_slot_size(size, entry_size);
+
+	if((count == 0) || (slot_size == 0)) return 0; /* zero size */
+	if(slot_size > (SIZE_MAX / count)) return 0; /* size overflow */
+
+	return (slot_size * count);
+}
+
+/**
+ *	@brief Creates FIFO pool in the arena given by the caller, every slot is free.
+ *
+ *	@param pool - pointer to the FIFO pool
+ *	@param arena - pointer to the arena, FIFO_CACHE_LINE_SIZE aligned, owned by the caller
+ *	@param arena_size - size of the arena in Bytes, see fifo_pool_arena_size
+ *	@param size - size of FIFO buffers
+ *	@param entry_size - size of an entry of FIFO buffers
+ *
+ *	@retval returns: 0 - FIFO pool created successfully
+ *					-1 - pool pointer is NULL
+ *					-2 - arena pointer is NULL
+ *					-3 - size of FIFO buffers or size of entry is 0
+ *					-4 - arena smaller than one slot
+ *					-5 - arena not aligned to FIFO_CACHE_LINE_SIZE
+ */
+int fifo_pool_init(fifo_pool_TD *pool, void *arena, size_t arena_size, fifo_size_t size, uint16_t entry_size)
+{
+	size_t slot_size = fifo_pool_slot_size(size, entry_size);
+	size_t slots = 0;
+	uint32_t i = 0;
+
+	if(pool == NULL) return -1; /* pool pointer NULL */
+	if(arena == NULL) return -2; /* arena pointer NULL */
+	if(slot_size == 0) return -3; /* zero size */
+	if(arena_size < slot_size) return -4; /* arena too small */
+	if(((uintptr_t)arena % FIFO_CACHE_LINE_SIZE) != 0) return -5; /* arena not aligned */
+
+	slots = (arena_size / slot_size);
+	if(slots >= FIFO_POOL_NONE) slots = (FIFO_POOL_NONE - 1);
+
+	pool->arena = arena;
+	pool->arena_size = arena_size;
+	pool->desc_size = fifo_pool_round(sizeof(fifo_pool_desc_TD), FIFO_CACHE_LINE_SIZE);
+	pool->slot_size = slot_size;
+	pool->slots = (uint32_t)slots;
+	pool->free_count = (uint32_t)slots;
+	pool->free_head = 0;
+	pool->size = size;
+	pool->entry_size = entry_size;
+	pool->mapped = false;
+
+	for(i = 0; i < pool->slots; i++)
+	{
+		fifo_pool_slot(pool, i)->next = (i + 1);
+		fifo_pool_slot(pool, i)->state = FIFO_POOL_FREE;
+	}
+
+	fifo_pool_slot(pool, (pool->slots - 1))->next = FIFO_POOL_NONE;
+
+	return 0;
+}
+
+/**
+ *	@brief Destroys FIFO pool, unmaps the arena if it was mapped by fifo_pool_create.
+ *	FIFO buffers acquired from the pool must not be used after it.
+ *
+ *	@param pool - pointer to the FIFO pool
+ *
+ *	@retval returns: 0 - FIFO pool destroyed successfully
+ *					-1 - pool pointer is NULL
+ */
+int fifo_pool_deinit(fifo_pool_TD *pool)
+{
+	if(pool == NULL) return -1; /* pool pointer NULL */
+
+#if defined(__linux__)
+	if((pool->mapped == true) && (pool->arena != NULL)) munmap(pool->arena, pool->arena_size);
+#endif
+
+	memset(pool, 0, sizeof(*pool));
+	pool->free_head = FIFO_POOL_NONE;
+
+	return 0;
+}
+
+/**
+ *	@brief Acquires common FIFO buffer from FIFO pool, its buffer is the storage of the same slot.
+ *
+ *	@param pool - pointer to the FIFO pool
+ *	@param clear_flag - specifies whether the buffer need to be cleared, see FIFO_WIPE_MODE
+ *
+ *	@retval returns: pointer to the empty FIFO buffer, NULL if pool pointer is NULL or pool exhausted
+ */
+fifo_common_TD *fifo_pool_acquire_common(fifo_pool_TD *pool, bool clear_flag)
+{
+	fifo_pool_desc_TD *desc = fifo_pool_take(pool);
+
+	if(desc == NULL) return NULL; /* no slot */
+
+	fifo_common_init(&desc->common, (((uint8_t *)desc) + pool->desc_size), pool->size, pool->entry_size, clear_flag);
+
+	return &desc->common;
+}
+
+/**
+ *	@brief Acquires common SPSC FIFO buffer from FIFO pool, its buffer is the storage of the same slot.
+ *
+ *	@param pool - pointer to the FIFO pool
+ *	@param clear_flag - specifies whether the buffer need to be cleared, see FIFO_WIPE_MODE
+ *
+ *	@retval returns: pointer to the empty SPSC FIFO buffer, NULL if pool pointer is NULL, pool exhausted
+ *					or pool size is not valid for SPSC FIFO buffers
+ */
+fifo_spsc_common_TD *fifo_pool_acquire_spsc(fifo_pool_TD *pool, bool clear_flag)
+{
+	fifo_pool_desc_TD *desc = fifo_pool_take(pool);
+
+	if(desc == NULL) return NULL; /* no slot */
+
+	if(fifo_spsc_common_init(&desc->spsc, (((uint8_t *)desc) + pool->desc_size), pool->size, pool->entry_size, clear_flag) != 0)
+	{
+		fifo_pool_release(pool, desc);
+		return NULL; /* size not valid for SPSC */
+	}
+
+	return &desc->spsc;
+}
+
+/**
+ *	@brief Returns FIFO buffer acquired from FIFO pool back to it.
+ *
+ *	@param pool - pointer to the FIFO pool
+ *	@param fifo - pointer to the common or SPSC FIFO buffer given by fifo_pool_acquire_common/fifo_pool_acquire_spsc
+ *
+ *	@retval returns: 0 - FIFO buffer released successfully
+ *					-1 - pool pointer is NULL
+ *					-2 - fifo pointer is NULL
+ *					-3 - fifo is not a slot of the pool
+ *					-5 - slot is already free, released twice or never acquired
+ *					-6 - state word of the slot overwritten, the slot is left as it is
+ */
+int fifo_pool_release(fifo_pool_TD *pool, void *fifo)
+{
+	fifo_pool_desc_TD *desc = fifo;
+	size_t offset = 0;
+
+	if(pool == NULL) return -1; /* pool pointer NULL */
+	if(fifo == NULL) return -2; /* fifo pointer NULL */
+	if((uint8_t *)fifo < pool->arena) return -3; /* not in the pool */
+
+	offset = (size_t)((uint8_t *)fifo - pool->arena);
+
+	if(offset >= ((size_t)pool->slots * pool->slot_size)) return -3; /* not in the pool */
+	if((offset % pool->slot_size) != 0) return -3; /* not a slot */
+	if(desc->state == FIFO_POOL_FREE) return -5; /* double release */
+	if(desc->state != FIFO_POOL_USED) return -6; /* state corrupted */
+
+	desc->state = FIFO_POOL_FREE;
+	desc->next = pool->free_head;
+	pool->free_head = (uint32_t)(offset / pool->slot_size);
+	pool->free_count++;
+
+	return 0;
+}
+
+#if defined(__linux__)
+
+/**
+ *	@brief Creates FIFO pool of at least count FIFO buffers in an arena mapped once, prefaulted.
+ *	With huge_flag the slots filling the rest of the last huge page are usable too.
+ *
+ *	@param pool - pointer to the FIFO pool
+ *	@param count - amount of FIFO buffers
+ *	@param size - size of FIFO buffers
+ *	@param entry_size - size of an entry of FIFO buffers
+ *	@param huge_flag - map the arena on FIFO_POOL_HUGE_PAGE pages, falls back to transparent huge pages
+ *
+ *	@retval returns: 0 - FIFO pool created successfully
+ *					-1 - pool pointer is NULL
+ *					-3 - count, size of FIFO buffers or size of entry is 0
+ *					-4 - arena size overflows
+ *					-6 - mmap failed, errno is left as set by it
+ */
+int fifo_pool_create(fifo_pool_TD *pool, uint32_t count, fifo_size_t size, uint16_t entry_size, bool huge_flag)
+{
+	size_t arena_size = fifo_pool_arena_size(count, size, entry_size);
+	void *area = MAP_FAILED;
+	int result = 0;
+
+	if(pool == NULL) return -1; /* pool pointer NULL */
+	if((count == 0) || (fifo_pool_slot_size(size, entry_size) == 0)) return -3; /* zero size */
+	if(arena_size == 0) return -4; /* size overflow */
+
+	if(huge_flag == true)
+	{
+		if(arena_size > (SIZE_MAX - FIFO_POOL_HUGE_PAGE)) return -4; /* size overflow */
+
+		arena_size = fifo_pool_round(arena_size, FIFO_POOL_HUGE_PAGE);
+		area = mmap(NULL, arena_size, (PROT_READ | PROT_WRITE), (MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | MAP_POPULATE), -1, 0);
+	}
+
+	if(area == MAP_FAILED)
+	{
+		area = mmap(NULL, arena_size, (PROT_READ | PROT_WRITE), (MAP_PRIVATE | MAP_ANONYMOUS | ((huge_flag == true) ? 0 : MAP_POPULATE)), -1, 0);
+		if(area == MAP_FAILED) return -6; /* no mapping */
+
+		if(huge_flag == true)
+		{
+			madvise(area, arena_size, MADV_HUGEPAGE); /* best effort, before the first touch */
+			memset(area, 0, arena_size); /* prefault */
+		}
+	}
+
+	result = fifo_pool_init(pool, area, arena_size, size, entry_size);
+
+	if(result != 0)
+	{
+		munmap(area, arena_size);
+		return result;
+	}
+
+	pool->mapped = true;
+
+	return 0;
+}
+
+#endif /* __linux__ */
+
+/**
+* 	@}
+*/
+
+/**
+* 	@}
+*/
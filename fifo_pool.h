@@ -0,0 +1,97 @@
+/**
+ * 	@file fifo_pool.h
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Pools of equally sized FIFO buffers carved out of one arena.
+ *  The arena is split into slots, each slot holds a FIFO descriptor on its own cache lines followed
+ *  by the buffer storage, so a FIFO buffer and its entries are adjacent in memory and acquire/release
+ *  are O(1) pops/pushes of an intrusive free list with no allocator calls or syscalls.
+ *  The arena may be given by the caller or mapped once by fifo_pool_create (Linux), optionally
+ *  on huge pages and prefaulted.
+ *
+ *  A state word after each descriptor lets release reject a slot that is already free or overwritten.
+ *
+ *  Alert: not thread-safe, acquire and release from one thread or under a lock.
+ */
+
+#ifndef FIFO_POOL_H_
+#define FIFO_POOL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "fifo_config.h"
+#include "fifo.h"
+#include "fifo_spsc.h"
+
+/**
+* 	@brief	Size of a huge page used by fifo_pool_create, arena size is rounded up to it.
+*/
+#ifndef FIFO_POOL_HUGE_PAGE
+#define FIFO_POOL_HUGE_PAGE		((size_t)2 * 1024 * 1024)
+#endif
+
+/**
+* 	@brief	Marks the end of the free list of FIFO pool.
+*/
+#define FIFO_POOL_NONE			UINT32_MAX
+
+/**
+* 	@brief	Values of the state word of a slot of FIFO pool ("FREE" and "USED").
+*/
+#define FIFO_POOL_FREE			0x46524545u
+#define FIFO_POOL_USED			0x55534544u
+
+/**
+* 	@brief	Descriptor part of a slot of FIFO pool.
+*/
+typedef struct
+{
+	union
+	{
+		fifo_common_TD common;		/**< Descriptor of an acquired common FIFO buffer */
+		fifo_spsc_common_TD spsc;	/**< Descriptor of an acquired common SPSC FIFO buffer */
+		uint32_t next;				/**< Index of the next free slot while the slot is free */
+	};
+
+	uint32_t state;					/**< FIFO_POOL_FREE or FIFO_POOL_USED, checked by fifo_pool_release */
+
+}fifo_pool_desc_TD;
+
+/**
+* 	@brief	FIFO pool type.
+*/
+typedef struct
+{
+	uint8_t *arena;			/**< Pointer to the first slot, FIFO_CACHE_LINE_SIZE aligned */
+	size_t arena_size;		/**< Size of the arena in Bytes */
+	size_t desc_size;		/**< Offset of the buffer storage inside a slot */
+	size_t slot_size;		/**< Size of a slot in Bytes, multiple of FIFO_CACHE_LINE_SIZE */
+
+	uint32_t slots;			/**< Amount of slots */
+	uint32_t free_count;	/**< Amount of free slots */
+	uint32_t free_head;		/**< Index of the first free slot, FIFO_POOL_NONE when exhausted */
+
+	fifo_size_t size;		/**< Size of every FIFO buffer of the pool */
+	uint16_t entry_size;	/**< Size of an entry of every FIFO buffer of the pool */
+	bool mapped;			/**< true when the arena was mapped by fifo_pool_create */
+
+}fifo_pool_TD;
+
+size_t fifo_pool_slot_size(fifo_size_t size, uint16_t entry_size);
+size_t fifo_pool_arena_size(uint32_t count, fifo_size_t size, uint16_t entry_size);
+int fifo_pool_init(fifo_pool_TD *pool, void *arena, size_t arena_size, fifo_size_t size, uint16_t entry_size);
+int fifo_pool_deinit(fifo_pool_TD *pool);
+fifo_common_TD *fifo_pool_acquire_common(fifo_pool_TD *pool, bool clear_flag);
+fifo_spsc_common_TD *fifo_pool_acquire_spsc(fifo_pool_TD *pool, bool clear_flag);
+int fifo_pool_release(fifo_pool_TD *pool, void *fifo);
+
+#if defined(__linux__)
+int fifo_pool_create(fifo_pool_TD *pool, uint32_t count, fifo_size_t size, uint16_t entry_size, bool huge_flag);
+#endif
+
+#endif /* FIFO_POOL_H_ */
@@ -0,0 +1,386 @@
+/**
+ * 	@file fifo_pow2.c
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Implementation of power-of-two capacity FIFO buffers.
+ *  Alert: size of FIFO buffer must be a power of two
+ *
+ */
+
+#include "fifo_pow2.h"
+#include "fifo_simd.h"
+
+/**
+*	@addtogroup Software_FIFO_buffer Software FIFO buffers
+* 	@{
+*/
+
+/**
+*	@addtogroup pow2_FIFO_buffer power-of-two FIFO buffer
+* 	@{
+*/
+
+/**
+ *	@brief Copies m entries into the ring starting at counter, split once at the buffer end.
+ */
+static inline void fifo_pow2_write(uint8_t *buffer, fifo_index_t mask, fifo_index_t counter, const uint8_t *src, fifo_size_t m, size_t entry_size)
+{
+	fifo_index_t pos = (counter & mask);
+	fifo_index_t first = (mask + 1) - pos;
+
+	if(m <= first)
+	{
+		fifo_simd_copy(buffer + (pos * entry_size), src, (m * entry_size));
+	}
+	else
+	{
+		fifo_simd_copy(buffer + (pos * entry_size), src, (first * entry_size));
+		fifo_simd_copy(buffer, src + (first * entry_size), ((m - first) * entry_size));
+	}
+}
+
+/**
+ *	@brief Copies m entries out of the ring starting at counter, split once at the buffer end.
+ */
+static inline void fifo_pow2_read(const uint8_t *buffer, fifo_index_t mask, fifo_index_t counter, uint8_t *dst, fifo_size_t m, size_t entry_size)
+{
+	fifo_index_t pos = (counter & mask);
+	fifo_index_t first = (mask + 1) - pos;
+
+	if(m <= first)
+	{
+		fifo_simd_copy(dst, buffer + (pos * entry_size), (m * entry_size));
+	}
+	else
+	{
+		fifo_simd_copy(dst, buffer + (pos * entry_size), (first * entry_size));
+		fifo_simd_copy(dst + (first * entry_size), buffer, ((m - first) * entry_size));
+	}
+}
+
+/**
+ *	@brief Checks that size is a non-zero power of two.
+ */
+static inline bool fifo_pow2_is_pow2(fifo_size_t size)
+{
+	return ((size != 0) && ((size & (size - 1)) == 0));
+}
+
+/**
+* 	@brief	Defines fifo_pow2_<name>_* bulk functions of typed and common power-of-two FIFO buffers, entry_bytes is entry size in Bytes.
+*/
+#define FIFO_POW2_TEMPLATE_FUNCTIONS(name, type, entry_bytes)										\
+																									\
+int fifo_pow2_##name##_reset(fifo_pow2_##name##_TD *fifo)											\
+{																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+																									\
+	fifo->head = 0;																					\
+	fifo->tail = 0;																					\
+																									\
+	return 0;																						\
+}																									\
+																									\
+int fifo_pow2_##name##_clear(fifo_pow2_##name##_TD *fifo)											\
+{																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+																									\
+	fifo_wipe(fifo->buffer, ((size_t)fifo->max_size * (entry_bytes)));								\
+																									\
+	return fifo_pow2_##name##_reset(fifo);															\
+}																									\
+																									\
+int fifo_pow2_##name##_pop_mul(fifo_pow2_##name##_TD *fifo, type *pop_buffer, fifo_size_t m)		\
+{																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(pop_buffer == NULL) return -2; /* pop buffer pointer NULL */									\
+	if(m == 0) return -3; /* zero m */																\
+	if(m > (fifo->tail - fifo->head)) return -4; /* current size lower than m */					\
+																									\
+	fifo_pow2_read((const uint8_t *)fifo->buffer, fifo->mask, fifo->head, (uint8_t *)pop_buffer, m, (entry_bytes)); \
+	fifo->head += m;																				\
+																									\
+	return 0;																						\
+}																									\
+																									\
+fifo_size_t fifo_pow2_##name##_read_some(fifo_pow2_##name##_TD *fifo, type *pop_buffer, fifo_size_t m) \
+{																									\
+	fifo_size_t count = 0;																			\
+																									\
+	if((fifo == NULL) || (pop_buffer == NULL)) return 0; /* pointer NULL */							\
+																									\
+	count = (fifo_size_t)(fifo->tail - fifo->head);													\
+																									\
+	if(m > count) m = count;																		\
+	if(m == 0) return 0; /* fifo empty */															\
+																									\
+	fifo_pow2_read((const uint8_t *)fifo->buffer, fifo->mask, fifo->head, (uint8_t *)pop_buffer, m, (entry_bytes)); \
+	fifo->head += m;																				\
+																									\
+	return m;																						\
+}																									\
+																									\
+int fifo_pow2_##name##_push_mul(fifo_pow2_##name##_TD *fifo, type *push_buffer, fifo_size_t m)		\
+{																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(push_buffer == NULL) return -2; /* push buffer pointer NULL */								\
+	if(m == 0) return -3; /* zero m */																\
+	if(m > (fifo->max_size - (fifo->tail - fifo->head))) return -4; /* no place for m elements in FIFO */ \
+																									\
+	fifo_pow2_write((uint8_t *)fifo->buffer, fifo->mask, fifo->tail, (const uint8_t *)push_buffer, m, (entry_bytes)); \
+	fifo->tail += m;																				\
+																									\
+	return 0;																						\
+}																									\
+																									\
+fifo_size_t fifo_pow2_##name##_write_some(fifo_pow2_##name##_TD *fifo, type *push_buffer, fifo_size_t m) \
+{																									\
+	fifo_size_t free_size = 0;																		\
+																									\
+	if((fifo == NULL) || (push_buffer == NULL)) return 0; /* pointer NULL */						\
+																									\
+	free_size = (fifo_size_t)(fifo->max_size - (fifo->tail - fifo->head));							\
+																									\
+	if(m > free_size) m = free_size;																\
+	if(m == 0) return 0; /* fifo full */															\
+																									\
+	fifo_pow2_write((uint8_t *)fifo->buffer, fifo->mask, fifo->tail, (const uint8_t *)push_buffer, m, (entry_bytes)); \
+	fifo->tail += m;																				\
+																									\
+	return m;																						\
+}																									\
+																									\
+int fifo_pow2_##name##_popv(fifo_pow2_##name##_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count) \
+{																									\
+	fifo_index_t total = 0;																			\
+	fifo_size_t i = 0;																				\
+																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(iov == NULL) return -2; /* iovec pointer NULL */												\
+																									\
+	total = fifo_iov_total(iov, iov_count);															\
+																									\
+	if(total == FIFO_INDEX_MAX) return -2; /* piece pointer NULL */									\
+	if(total == 0) return -3; /* zero total length */												\
+	if(total > (fifo_index_t)(fifo->tail - fifo->head)) return -4; /* current size lower than total length */ \
+																									\
+	for(i = 0; i < iov_count; i++)																	\
+	{																								\
+		if(iov[i].len == 0) continue;																\
+																									\
+		fifo_pow2_read((const uint8_t *)fifo->buffer, fifo->mask, fifo->head, (uint8_t *)iov[i].base, iov[i].len, (entry_bytes)); \
+		fifo->head += iov[i].len;																	\
+	}																								\
+																									\
+	return 0;																						\
+}																									\
+																									\
+int fifo_pow2_##name##_pushv(fifo_pow2_##name##_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count) \
+{																									\
+	fifo_index_t total = 0;																			\
+	fifo_size_t i = 0;																				\
+																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(iov == NULL) return -2; /* iovec pointer NULL */												\
+																									\
+	total = fifo_iov_total(iov, iov_count);															\
+																									\
+	if(total == FIFO_INDEX_MAX) return -2; /* piece pointer NULL */									\
+	if(total == 0) return -3; /* zero total length */												\
+	if(total > (fifo_index_t)(fifo->max_size - (fifo->tail - fifo->head))) return -4; /* no place for total length in FIFO */ \
+																									\
+	for(i = 0; i < iov_count; i++)																	\
+	{																								\
+		if(iov[i].len == 0) continue;																\
+																									\
+		fifo_pow2_write((uint8_t *)fifo->buffer, fifo->mask, fifo->tail, (const uint8_t *)iov[i].base, iov[i].len, (entry_bytes)); \
+		fifo->tail += iov[i].len;																	\
+	}																								\
+																									\
+	return 0;																						\
+}
+
+/**
+* 	@brief	Defines fifo_pow2_<name>_pop, fifo_pow2_<name>_push and fifo_pow2_<name>_init of typed power-of-two FIFO buffer storing entries of type.
+*/
+#define FIFO_POW2_TEMPLATE_VALUE_FUNCTIONS(name, type)												\
+																									\
+int fifo_pow2_##name##_pop(fifo_pow2_##name##_TD *fifo, type *val)									\
+{																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(val == NULL) return -2;  /* val pointer NULL */												\
+	if(fifo->tail == fifo->head) return -3; /* fifo empty */										\
+																									\
+	*val = fifo->buffer[fifo->head & fifo->mask];													\
+	fifo->head++;																					\
+																									\
+	return 0;																						\
+}																									\
+																									\
+int fifo_pow2_##name##_push(fifo_pow2_##name##_TD *fifo, type val)									\
+{																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if((fifo->tail - fifo->head) == fifo->max_size) return -2; /* fifo full */						\
+																									\
+	fifo->buffer[fifo->tail & fifo->mask] = val;													\
+	fifo->tail++;																					\
+																									\
+	return 0;																						\
+}																									\
+																									\
+int fifo_pow2_##name##_init(fifo_pow2_##name##_TD *fifo, type *buffer, fifo_size_t size, bool clear_flag) \
+{																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(buffer == NULL) return -2; /* buffer pointer NULL */											\
+	if(size == 0) return -3; /* zero size */														\
+	if(fifo_pow2_is_pow2(size) == false) return -4; /* size not a power of two */					\
+																									\
+	fifo->buffer = buffer;																			\
+	fifo->head = 0;																					\
+	fifo->tail = 0;																					\
+	fifo->mask = (fifo_index_t)(size - 1);															\
+	fifo->max_size = size;																			\
+																									\
+	if(clear_flag == true) fifo_wipe(buffer, (size * sizeof(type)));								\
+																									\
+	return 0;																						\
+}
+
+/**
+* 	@}
+*/
+
+/**
+*	@addtogroup uint8_t_pow2_FIFO_buffer uint8_t power-of-two FIFO buffer
+* 	@{
+*/
+
+FIFO_POW2_TEMPLATE_FUNCTIONS(uint8, uint8_t, sizeof(uint8_t))
+FIFO_POW2_TEMPLATE_VALUE_FUNCTIONS(uint8, uint8_t)
+
+/**
+* 	@}
+*/
+
+/**
+*	@addtogroup uint16_t_pow2_FIFO_buffer uint16_t power-of-two FIFO buffer
+* 	@{
+*/
+
+FIFO_POW2_TEMPLATE_FUNCTIONS(uint16, uint16_t, sizeof(uint16_t))
+FIFO_POW2_TEMPLATE_VALUE_FUNCTIONS(uint16, uint16_t)
+
+/**
+* 	@}
+*/
+
+/**
+*	@addtogroup uint32_t_pow2_FIFO_buffer uint32_t power-of-two FIFO buffer
+* 	@{
+*/
+
+FIFO_POW2_TEMPLATE_FUNCTIONS(uint32, uint32_t, sizeof(uint32_t))
+FIFO_POW2_TEMPLATE_VALUE_FUNCTIONS(uint32, uint32_t)
+
+/**
+* 	@}
+*/
+
+/**
+*	@addtogroup common_pow2_FIFO_buffer common power-of-two FIFO buffer
+* 	@{
+*/
+
+FIFO_POW2_TEMPLATE_FUNCTIONS(common, void, fifo->entry_size)
+
+/**
+ *	@brief Pops value from common power-of-two FIFO buffer.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param val_buffer - pointer to value store buffer
+ *
+ *	@retval returns: 0 - head popped successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - value buffer pointer is NULL
+ *					-3 - FIFO buffer empty
+ */
+int fifo_pow2_common_pop(fifo_pow2_common_TD *fifo, void *val_buffer)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
+	if(fifo->tail == fifo->head) return -3; /* fifo empty */
+
+	memcpy(val_buffer, ((uint8_t *)fifo->buffer) + ((fifo->head & fifo->mask) * fifo->entry_size), fifo->entry_size);
+	fifo->head++;
+
+	return 0;
+}
+
+/**
+ *	@brief Pushes value into common power-of-two FIFO buffer.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param val_buffer - value buffer to push
+ *
+ *	@retval returns: 0 - tail pushed successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - value buffer pointer is NULL
+ *					-3 - FIFO buffer full
+ */
+int fifo_pow2_common_push(fifo_pow2_common_TD *fifo, void *val_buffer)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
+	if((fifo->tail - fifo->head) == fifo->max_size) return -3; /* fifo FULL */
+
+	memcpy(((uint8_t *)fifo->buffer) + ((fifo->tail & fifo->mask) * fifo->entry_size), val_buffer, fifo->entry_size);
+	fifo->tail++;
+
+	return 0;
+}
+
+/**
+ *	@brief Creates common power-of-two FIFO buffer.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param buffer - pointer to buffer that stores values
+ *	@param size - size of FIFO buffer, must be a power of two
+ *	@param entry_size - size of an entry of common FIFO buffer
+ *	@param clear_flag - specifies whether the buffer need to be cleared, see FIFO_WIPE_MODE
+ *
+ *	@retval returns: 0 - common power-of-two FIFO buffer created successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - buffer pointer is NULL
+ *					-3 - size of FIFO buffer is 0
+ *					-4 - size of entry is 0
+ *					-5 - size of FIFO buffer is not a power of two
+ */
+int fifo_pow2_common_init(fifo_pow2_common_TD *fifo, void *buffer, fifo_size_t size, uint16_t entry_size, bool clear_flag)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(buffer == NULL) return -2; /* buffer pointer NULL */
+	if(size == 0) return -3; /* zero size */
+	if(entry_size == 0) return -4; /* zero entry size */
+	if(fifo_pow2_is_pow2(size) == false) return -5; /* size not a power of two */
+
+	fifo->buffer = buffer;
+	fifo->head = 0;
+	fifo->tail = 0;
+	fifo->mask = (fifo_index_t)(size - 1);
+	fifo->entry_size = entry_size;
+	fifo->max_size = size;
+
+	if(clear_flag == true) fifo_wipe(buffer, ((size_t)size * entry_size));
+
+	return 0;
+}
+
+/**
+* 	@}
+*/
+
+/**
+* 	@}
+*/
@@ -0,0 +1,111 @@
+/**
+ * 	@file fifo_pow2.h
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Power-of-two capacity FIFO buffers.
+ *  Head and tail are free-running counters (32-bit unless FIFO_SIZE_BITS is 64) indexed with (size - 1) mask,
+ *  so push and pop have no wrap branch and no shared free size counter.
+ *
+ *  fifo_pow2_<name>_* functions of the uint8_t, uint16_t, uint32_t and common buffers are generated
+ *  by FIFO_POW2_TEMPLATE_* macros and return:
+ *  	reset, clear: 0 or -1 (fifo pointer NULL)
+ *  	pop_mul, push_mul: 0, -1 (fifo pointer NULL), -2 (buffer pointer NULL), -3 (zero m), -4 (not enough entries or place)
+ *  	popv, pushv: 0, -1 (fifo pointer NULL), -2 (iovec or non-empty piece pointer NULL), -3 (zero total length), -4 (not enough entries or place)
+ *  	read_some, write_some: amount of entries moved, 0 if a pointer is NULL
+ *  	pop: 0, -1, -2 (val pointer NULL), -3 (empty); push: 0, -1, -2 (full for typed, value buffer NULL for common), -3 (full for common)
+ *  	init: 0, -1, -2 (buffer pointer NULL), -3 (size 0), -4 (size not a power of two; entry size 0 for common), -5 (size not a power of two, common)
+ */
+
+#ifndef FIFO_POW2_H_
+#define FIFO_POW2_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "fifo_config.h"
+
+/**
+* 	@brief	Declares power-of-two FIFO buffer type fifo_pow2_<name>_TD that stores entries of type.
+*/
+#define FIFO_POW2_TEMPLATE_TYPE(name, type)															\
+typedef struct																						\
+{																									\
+	type *buffer;			/**< Pointer to buffer that stores values */							\
+	fifo_index_t head;		/**< Free-running read counter of FIFO buffer */						\
+	fifo_index_t tail;		/**< Free-running write counter of FIFO buffer */						\
+	fifo_index_t mask;		/**< Index mask of FIFO buffer, equal to max_size - 1 */				\
+																									\
+	fifo_size_t max_size;	/**< Size of FIFO buffer, power of two */								\
+																									\
+}fifo_pow2_##name##_TD;
+
+/**
+* 	@brief	Declares prototypes of fifo_pow2_<name>_* bulk functions of typed and common power-of-two FIFO buffers.
+*/
+#define FIFO_POW2_TEMPLATE_PROTOTYPES(name, type)													\
+int fifo_pow2_##name##_reset(fifo_pow2_##name##_TD *fifo);											\
+int fifo_pow2_##name##_clear(fifo_pow2_##name##_TD *fifo);											\
+int fifo_pow2_##name##_pop_mul(fifo_pow2_##name##_TD *fifo, type *pop_buffer, fifo_size_t m);		\
+fifo_size_t fifo_pow2_##name##_read_some(fifo_pow2_##name##_TD *fifo, type *pop_buffer, fifo_size_t m); \
+int fifo_pow2_##name##_push_mul(fifo_pow2_##name##_TD *fifo, type *push_buffer, fifo_size_t m);		\
+fifo_size_t fifo_pow2_##name##_write_some(fifo_pow2_##name##_TD *fifo, type *push_buffer, fifo_size_t m); \
+int fifo_pow2_##name##_popv(fifo_pow2_##name##_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count); \
+int fifo_pow2_##name##_pushv(fifo_pow2_##name##_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count);
+
+/**
+* 	@brief	Declares prototypes of fifo_pow2_<name>_pop, fifo_pow2_<name>_push and fifo_pow2_<name>_init of typed power-of-two FIFO buffer.
+*/
+#define FIFO_POW2_TEMPLATE_VALUE_PROTOTYPES(name, type)												\
+int fifo_pow2_##name##_pop(fifo_pow2_##name##_TD *fifo, type *val);									\
+int fifo_pow2_##name##_push(fifo_pow2_##name##_TD *fifo, type val);									\
+int fifo_pow2_##name##_init(fifo_pow2_##name##_TD *fifo, type *buffer, fifo_size_t size, bool clear_flag);
+
+/**
+* 	@brief	uint8_t power-of-two FIFO buffer type. Used for store uint8_t entries.
+*/
+FIFO_POW2_TEMPLATE_TYPE(uint8, uint8_t)
+
+/**
+* 	@brief	uint16_t power-of-two FIFO buffer type. Used for store uint16_t entries.
+*/
+FIFO_POW2_TEMPLATE_TYPE(uint16, uint16_t)
+
+/**
+* 	@brief	uint32_t power-of-two FIFO buffer type. Used for store uint32_t entries.
+*/
+FIFO_POW2_TEMPLATE_TYPE(uint32, uint32_t)
+
+/**
+* 	@brief	common power-of-two FIFO buffer type. Used for store entries with user defined size.
+*/
+typedef struct
+{
+	void *buffer;			/**< Pointer to buffer that stores values */
+	fifo_index_t head;		/**< Free-running read counter of common FIFO buffer */
+	fifo_index_t tail;		/**< Free-running write counter of common FIFO buffer */
+	fifo_index_t mask;		/**< Index mask of common FIFO buffer, equal to max_size - 1 */
+
+	uint16_t entry_size;	/**< Size of common FIFO buffer entry in Bytes */
+	fifo_size_t max_size;	/**< Size of common FIFO buffer, power of two */
+
+}fifo_pow2_common_TD;
+
+FIFO_POW2_TEMPLATE_PROTOTYPES(uint8, uint8_t)
+FIFO_POW2_TEMPLATE_VALUE_PROTOTYPES(uint8, uint8_t)
+
+FIFO_POW2_TEMPLATE_PROTOTYPES(uint16, uint16_t)
+FIFO_POW2_TEMPLATE_VALUE_PROTOTYPES(uint16, uint16_t)
+
+FIFO_POW2_TEMPLATE_PROTOTYPES(uint32, uint32_t)
+FIFO_POW2_TEMPLATE_VALUE_PROTOTYPES(uint32, uint32_t)
+
+FIFO_POW2_TEMPLATE_PROTOTYPES(common, void)
+int fifo_pow2_common_pop(fifo_pow2_common_TD *fifo, void *val_buffer);
+int fifo_pow2_common_push(fifo_pow2_common_TD *fifo, void *val_buffer);
+int fifo_pow2_common_init(fifo_pow2_common_TD *fifo, void *buffer, fifo_size_t size, uint16_t entry_size, bool clear_flag);
+
+#endif /* FIFO_POW2_H_ */
@@ -0,0 +1,271 @@
+/**
+ * 	@file fifo_shard.c
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Implementation of sharded FIFO buffers with work-stealing consumers.
+ *  Alert: pushes to a shard must come from a single producer context, shards array must be
+ *  FIFO_CACHE_LINE_SIZE aligned (static, aligned_alloc).
+ *
+ */
+
+#include "fifo_shard.h"
+
+/**
+*	@addtogroup Software_FIFO_buffer Software FIFO buffers
+* 	@{
+*/
+
+/**
+*	@addtogroup shard_FIFO_buffer Sharded FIFO buffer
+* 	@{
+*/
+
+/**
+ *	@brief Takes consumer side lock of shard without waiting, returns true on success.
+ */
+static inline bool fifo_shard_try_lock(fifo_shard_slot_TD *shard)
+{
+	return (atomic_flag_test_and_set_explicit(&shard->busy, memory_order_acquire) == false);
+}
+
+/**
+ *	@brief Releases consumer side lock of shard.
+ */
+static inline void fifo_shard_unlock(fifo_shard_slot_TD *shard)
+{
+	atomic_flag_clear_explicit(&shard->busy, memory_order_release);
+}
+
+/**
+ *	@brief Pops up to m entries from shard under its lock, nothing if a consumer already holds it.
+ *	steal limits the batch to half of the stored entries, so the owner keeps the rest.
+ */
+static fifo_size_t fifo_shard_take(fifo_shard_slot_TD *shard, void *pop_buffer, fifo_size_t m, bool steal)
+{
+	fifo_size_t stored = 0;
+	fifo_size_t n = 0;
+
+	if(fifo_shard_try_lock(shard) == false) return 0; /* another consumer pops from it */
+
+	if(steal == true)
+	{
+		stored = fifo_spsc_ring_count(&shard->fifo.ring);
+		stored = (fifo_size_t)((stored / 2) + (stored & 1));
+		if(m > stored) m = stored;
+	}
+
+	if(m != 0) n = fifo_spsc_ring_read_some(&shard->fifo.ring, shard->fifo.buffer, pop_buffer, m);
+
+	fifo_shard_unlock(shard);
+
+	return n;
+}
+
+/**
+ *	@brief Creates sharded FIFO buffer of count shards, buffer is split into count storages of size entries.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param shards - pointer to array of count shards, FIFO_CACHE_LINE_SIZE aligned
+ *	@param count - amount of shards, usually one per core
+ *	@param buffer - pointer to buffer of FIFO_SHARD_BUFFER_SIZE(count, size, entry_size) Bytes
+ *	@param size - size of every shard
+ *	@param entry_size - size of an entry
+ *	@param clear_flag - specifies whether the buffer need to be cleared, see FIFO_WIPE_MODE
+ *
+ *	@retval returns: 0 - sharded FIFO buffer created successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - shards or buffer pointer is NULL
+ *					-3 - count is 0, size of shard is 0 or larger than FIFO_SPSC_MAX_SIZE
+ *					-4 - size of entry is 0
+ *					-5 - shards array is not FIFO_CACHE_LINE_SIZE aligned
+ */
+int fifo_shard_init(fifo_shard_TD *fifo, fifo_shard_slot_TD *shards, uint16_t count, void *buffer, fifo_size_t size, uint16_t entry_size, bool clear_flag)
+{
+	uint16_t i = 0;
+	int ret = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if((shards == NULL) || (buffer == NULL)) return -2; /* shards or buffer pointer NULL */
+	if(count == 0) return -3; /* zero count */
+	if(entry_size == 0) return -4; /* zero entry size */
+	if(((uintptr_t)shards % FIFO_CACHE_LINE_SIZE) != 0) return -5; /* shards not aligned */
+
+	for(i = 0; i < count; i++)
+	{
+		ret = fifo_spsc_common_init(&shards[i].fifo, (((uint8_t *)buffer) + ((size_t)i * size * entry_size)), size, entry_size, clear_flag);
+		if(ret != 0) return ret; /* wrong size of shard */
+
+		atomic_flag_clear_explicit(&shards[i].busy, memory_order_relaxed);
+	}
+
+	fifo->shards = shards;
+	fifo->count = count;
+	fifo->entry_size = entry_size;
+
+	return 0;
+}
+
+/**
+ *	@brief Gives amount of entries in all shards, a snapshot while producers and consumers run.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *
+ *	@retval returns: amount of entries in FIFO buffer saturated to FIFO_SIZE_MAX, 0 if fifo pointer is NULL
+ */
+fifo_size_t fifo_shard_count(fifo_shard_TD *fifo)
+{
+	fifo_size_t count = 0;
+	fifo_size_t n = 0;
+	uint16_t i = 0;
+
+	if(fifo == NULL) return 0; /* fifo pointer NULL */
+
+	for(i = 0; i < fifo->count; i++)
+	{
+		n = fifo_spsc_ring_count(&fifo->shards[i].fifo.ring);
+		if(n > (FIFO_SIZE_MAX - count)) return FIFO_SIZE_MAX; /* sum does not fit fifo_size_t */
+
+		count = (fifo_size_t)(count + n);
+	}
+
+	return count;
+}
+
+/**
+ *	@brief Pushes value into shard of sharded FIFO buffer. Producer of the shard only.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param shard - index of the producer's shard
+ *	@param val_buffer - value buffer to push
+ *
+ *	@retval returns: 0 - tail pushed successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - value buffer pointer is NULL
+ *					-3 - shard full
+ *					-5 - shard index out of range
+ */
+int fifo_shard_push(fifo_shard_TD *fifo, uint16_t shard, const void *val_buffer)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
+	if(shard >= fifo->count) return -5; /* no such shard */
+	if(fifo_spsc_ring_push_mul(&fifo->shards[shard].fifo.ring, fifo->shards[shard].fifo.buffer, val_buffer, 1) != 0) return -3; /* shard FULL */
+
+	return 0;
+}
+
+/**
+ *	@brief Pushes m entries into shard of sharded FIFO buffer. Producer of the shard only.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param shard - index of the producer's shard
+ *	@param push_buffer - pointer to the buffer from which the values will be pushed
+ *	@param m - amount of entries to be pushed
+ *
+ *	@retval returns:	0 - all of the m entries was pushed
+ *					-1 - fifo pointer is NULL
+ *					-2 - push buffer pointer is NULL
+ *					-3 - amount of the entries to be pushed is zero
+ *					-4 - no place for m element in shard
+ *					-5 - shard index out of range
+ */
+int fifo_shard_push_mul(fifo_shard_TD *fifo, uint16_t shard, const void *push_buffer, fifo_size_t m)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(push_buffer == NULL) return -2; /* push buffer pointer NULL */
+	if(m == 0) return -3; /* zero m */
+	if(shard >= fifo->count) return -5; /* no such shard */
+
+	return fifo_spsc_ring_push_mul(&fifo->shards[shard].fifo.ring, fifo->shards[shard].fifo.buffer, push_buffer, m);
+}
+
+/**
+ *	@brief Pushes as many of m entries as fit into shard of sharded FIFO buffer. Producer of the shard only.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param shard - index of the producer's shard
+ *	@param push_buffer - pointer to the buffer from which the values will be pushed
+ *	@param m - maximal amount of entries to be pushed
+ *
+ *	@retval returns: amount of entries pushed, 0 if shard is full, a pointer is NULL or shard is out of range
+ */
+fifo_size_t fifo_shard_write_some(fifo_shard_TD *fifo, uint16_t shard, const void *push_buffer, fifo_size_t m)
+{
+	if((fifo == NULL) || (push_buffer == NULL)) return 0; /* pointer NULL */
+	if(shard >= fifo->count) return 0; /* no such shard */
+
+	return fifo_spsc_ring_write_some(&fifo->shards[shard].fifo.ring, fifo->shards[shard].fifo.buffer, push_buffer, m);
+}
+
+/**
+ *	@brief Pops up to m entries of one shard: the home shard first, otherwise half of the entries of the
+ *	first other non-empty shard after it that no other consumer holds. Entries come in push order of that shard.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param home - index of the consumer's home shard
+ *	@param pop_buffer - pointer to the buffer into which the values will be popped
+ *	@param m - maximal amount of entries to be popped
+ *	@param from - gives index of the shard the entries came from, may be NULL
+ *
+ *	@retval returns: amount of entries popped, 0 if all shards are empty or busy, a pointer is NULL or home is out of range
+ */
+fifo_size_t fifo_shard_read_some(fifo_shard_TD *fifo, uint16_t home, void *pop_buffer, fifo_size_t m, uint16_t *from)
+{
+	fifo_size_t n = 0;
+	uint16_t victim = home;
+	uint16_t i = 0;
+
+	if((fifo == NULL) || (pop_buffer == NULL)) return 0; /* pointer NULL */
+	if(home >= fifo->count) return 0; /* no such shard */
+	if(m == 0) return 0; /* nothing requested */
+
+	n = fifo_shard_take(&fifo->shards[home], pop_buffer, m, false);
+
+	for(i = 1; (n == 0) && (i < fifo->count); i++)
+	{
+		victim = (uint16_t)(home + i);
+		if(victim >= fifo->count) victim = (uint16_t)(victim - fifo->count);
+
+		if(fifo_spsc_ring_count(&fifo->shards[victim].fifo.ring) == 0) continue; /* empty, no need to lock it */
+
+		n = fifo_shard_take(&fifo->shards[victim], pop_buffer, m, true);
+	}
+
+	if((n != 0) && (from != NULL)) *from = victim;
+
+	return n;
+}
+
+/**
+ *	@brief Pops one value from the home shard, otherwise steals it from another shard.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param home - index of the consumer's home shard
+ *	@param val_buffer - pointer to value store buffer
+ *	@param from - gives index of the shard the value came from, may be NULL
+ *
+ *	@retval returns: 0 - value popped successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - value buffer pointer is NULL
+ *					-3 - all shards empty or busy
+ *					-5 - home index out of range
+ */
+int fifo_shard_pop(fifo_shard_TD *fifo, uint16_t home, void *val_buffer, uint16_t *from)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
+	if(home >= fifo->count) return -5; /* no such shard */
+	if(fifo_shard_read_some(fifo, home, val_buffer, 1, from) == 0) return -3; /* nothing to pop */
+
+	return 0;
+}
+
+/**
+* 	@}
+*/
+
+/**
+* 	@}
+*/
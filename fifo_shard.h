@@ -0,0 +1,70 @@
+/**
+ * 	@file fifo_shard.h
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Sharded FIFO buffers with work-stealing consumers.
+ *  A sharded FIFO is an array of common SPSC FIFO buffers, one per core. Each producer pushes only
+ *  to its own shard, lock-free and without touching the other shards, so producers share no cache line.
+ *  Each consumer has a home shard and pops from it first. When the home shard is empty it steals
+ *  half of the entries of the first other non-empty shard, at most the requested amount, with one
+ *  bulk read_some of that shard's SPSC buffer.
+ *
+ *  The consumer side of every shard is guarded by a try-lock. The home consumer takes it uncontended
+ *  unless a thief holds it, and a busy shard is skipped rather than waited on. One pop or read_some
+ *  takes its entries from one shard only and reports it in from, and the entries of a shard leave it
+ *  in push order (per-shard FIFO order). There is no order between shards. Requires C11 atomics.
+ *
+ *  Alert: push functions of a shard from a single producer context only, pop functions from any thread.
+ */
+
+#ifndef FIFO_SHARD_H_
+#define FIFO_SHARD_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "fifo_config.h"
+#include "fifo_spsc.h"
+
+/**
+* 	@brief	Size in Bytes of the buffer passed to fifo_shard_init() for count shards of size entries of entry_size Bytes.
+*/
+#define FIFO_SHARD_BUFFER_SIZE(count, size, entry_size)		((size_t)(count) * (size_t)(size) * (size_t)(entry_size))
+
+/**
+* 	@brief	One shard of sharded FIFO buffer, on its own cache lines.
+*/
+typedef struct
+{
+	_Alignas(FIFO_CACHE_LINE_SIZE) fifo_spsc_common_TD fifo;	/**< SPSC FIFO buffer of the shard */
+	atomic_flag busy;											/**< Consumer side lock, held while a consumer pops from the shard */
+
+}fifo_shard_slot_TD;
+
+/**
+* 	@brief	Sharded FIFO buffer type. Used for store entries with user defined size.
+*/
+typedef struct
+{
+	fifo_shard_slot_TD *shards;		/**< Pointer to array of shards, FIFO_CACHE_LINE_SIZE aligned */
+	uint16_t count;					/**< Amount of shards */
+	uint16_t entry_size;			/**< Size of FIFO buffer entry in Bytes */
+
+}fifo_shard_TD;
+
+int fifo_shard_init(fifo_shard_TD *fifo, fifo_shard_slot_TD *shards, uint16_t count, void *buffer, fifo_size_t size, uint16_t entry_size, bool clear_flag);
+fifo_size_t fifo_shard_count(fifo_shard_TD *fifo);
+
+int fifo_shard_push(fifo_shard_TD *fifo, uint16_t shard, const void *val_buffer);
+int fifo_shard_push_mul(fifo_shard_TD *fifo, uint16_t shard, const void *push_buffer, fifo_size_t m);
+fifo_size_t fifo_shard_write_some(fifo_shard_TD *fifo, uint16_t shard, const void *push_buffer, fifo_size_t m);
+
+int fifo_shard_pop(fifo_shard_TD *fifo, uint16_t home, void *val_buffer, uint16_t *from);
+fifo_size_t fifo_shard_read_some(fifo_shard_TD *fifo, uint16_t home, void *pop_buffer, fifo_size_t m, uint16_t *from);
+
+#endif /* FIFO_SHARD_H_ */
@@ -0,0 +1,567 @@
+/**
+ * 	@file fifo_shm.c
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Implementation of inter-process SPSC FIFO buffers in shared memory.
+ *  Alert: Linux only, push functions must be called from a single producer process
+ *  and pop functions from a single consumer process.
+ *
+ */
+
+#if defined(__linux__)
+
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "fifo_shm.h"
+
+/**
+*	@addtogroup Software_FIFO_buffer Software FIFO buffers
+* 	@{
+*/
+
+/**
+*	@addtogroup shm_FIFO_buffer shared memory FIFO buffer
+* 	@{
+*/
+
+/**
+ *	@brief Returns offset of the entries from the region start, the header rounded up to a cache line.
+ */
+static inline size_t fifo_shm_data_offset(void)
+{
+	return (((sizeof(fifo_shm_header_TD) + (FIFO_CACHE_LINE_SIZE - 1)) / FIFO_CACHE_LINE_SIZE) * FIFO_CACHE_LINE_SIZE);
+}
+
+/**
+ *	@brief Maps size Bytes of fd shared, returns NULL on failure.
+ */
+static inline void *fifo_shm_map(int fd, size_t size)
+{
+	void *area = mmap(NULL, size, (PROT_READ | PROT_WRITE), MAP_SHARED, fd, 0);
+
+	return ((area == MAP_FAILED) ? NULL : area);
+}
+
+/**
+ *	@brief Gives size in Bytes of a region holding shared FIFO buffer of size entries of entry_size Bytes.
+ *
+ *	@param size - size of FIFO buffer
+ *	@param entry_size - size of an entry of FIFO buffer
+ *
+ *	@retval returns: size of the region in Bytes, 0 if size or entry_size is 0
+ */
+size_t fifo_shm_region_size(fifo_size_t size, uint16_t entry_size)
+{
+	if((size == 0) || (entry_size == 0)) return 0; /* zero size */
+
+	return (fifo_shm_data_offset() + ((size_t)size * entry_size));
+}
+
+/**
+ *	@brief Formats a shared region as an empty FIFO buffer and attaches fifo to it. Producer or consumer side, once.
+ *	The region may come from shm_open, memfd_create or any other shared mapping.
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param region - pointer to the region, aligned to FIFO_CACHE_LINE_SIZE
+ *	@param region_size - size of the region, at least fifo_shm_region_size(size, entry_size)
+ *	@param size - size of FIFO buffer
+ *	@param entry_size - size of an entry of FIFO buffer
+ *
+ *	@retval returns: 0 - shared FIFO buffer created successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - region pointer is NULL
+ *					-3 - size of FIFO buffer is 0 or larger than FIFO_SPSC_MAX_SIZE
+ *					-4 - size of entry is 0
+ *					-5 - region too small or indices not lock-free, so not usable across processes
+ */
+int fifo_shm_init(fifo_shm_TD *fifo, void *region, size_t region_size, fifo_size_t size, uint16_t entry_size)
+{
+	fifo_shm_header_TD *header = region;
+	int result = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(region == NULL) return -2; /* region pointer NULL */
+	if(entry_size == 0) return -4; /* zero entry size */
+	if(size == 0) return -3; /* zero size */
+	if(region_size < fifo_shm_region_size(size, entry_size)) return -5; /* region too small */
+	if(!atomic_is_lock_free(&header->ring.tail)) return -5; /* indices need a lock */
+
+	atomic_store_explicit(&header->magic, 0, memory_order_relaxed);
+
+	result = fifo_spsc_ring_init(&header->ring, size, entry_size);
+	if(result != 0) return result;
+
+	header->version = FIFO_SHM_VERSION;
+	header->layout = FIFO_SHM_LAYOUT;
+	header->ring_size = (uint32_t)sizeof(fifo_spsc_ring_TD);
+	header->data_offset = fifo_shm_data_offset();
+	header->region_size = region_size;
+
+	atomic_store_explicit(&header->magic, FIFO_SHM_MAGIC, memory_order_release);
+
+	fifo->header = header;
+	fifo->buffer = ((uint8_t *)region + header->data_offset);
+	fifo->map_size = 0;
+
+	return 0;
+}
+
+/**
+ *	@brief Attaches fifo to a shared region formatted by fifo_shm_init() in this or another process.
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param region - pointer to the region as mapped in this process
+ *	@param region_size - size of the mapping
+ *
+ *	@retval returns: 0 - attached successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - region pointer is NULL
+ *					-5 - region not initialized yet, of another layout, larger than the mapping or with corrupted sizes or indices
+ */
+int fifo_shm_attach_region(fifo_shm_TD *fifo, void *region, size_t region_size)
+{
+	fifo_shm_header_TD *header = region;
+	fifo_index_t head = 0;
+	fifo_index_t tail = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(region == NULL) return -2; /* region pointer NULL */
+	if(region_size < fifo_shm_data_offset()) return -5; /* region too small */
+	if(atomic_load_explicit(&header->magic, memory_order_acquire) != FIFO_SHM_MAGIC) return -5; /* not initialized */
+	if((header->version != FIFO_SHM_VERSION) || (header->layout != FIFO_SHM_LAYOUT)) return -5; /* other layout */
+	if(header->ring_size != (uint32_t)sizeof(fifo_spsc_ring_TD)) return -5; /* other layout */
+	if(header->data_offset != fifo_shm_data_offset()) return -5; /* other layout */
+	if(header->region_size > region_size) return -5; /* mapping shorter than region */
+	if((header->ring.max_size == 0) || (header->ring.entry_size == 0)) return -5; /* corrupted sizes, region size would be 0 */
+	if(fifo_shm_region_size(header->ring.max_size, header->ring.entry_size) > header->region_size) return -5; /* corrupted sizes */
+
+	head = atomic_load_explicit(&header->ring.head, memory_order_acquire);
+	tail = atomic_load_explicit(&header->ring.tail, memory_order_acquire);
+
+	if(!fifo_spsc_ring_indices_valid(head, tail, header->ring.max_size)) return -5; /* corrupted indices or too large size */
+
+	fifo->header = header;
+	fifo->buffer = ((uint8_t *)region + header->data_offset);
+	fifo->map_size = 0;
+
+	return 0;
+}
+
+/**
+ *	@brief Sizes fd (e.g. from memfd_create or shm_open), maps it and formats it as an empty shared FIFO buffer.
+ *	fd may be closed afterwards or passed to the other process.
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param fd - file descriptor of the shared memory object
+ *	@param size - size of FIFO buffer
+ *	@param entry_size - size of an entry of FIFO buffer
+ *
+ *	@retval returns: 0 - shared FIFO buffer created successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - fd is negative
+ *					-3 - size of FIFO buffer is 0 or larger than FIFO_SPSC_MAX_SIZE
+ *					-4 - size of entry is 0
+ *					-5 - indices not lock-free
+ *					-6 - ftruncate or mmap failed, errno is left as set by them
+ */
+int fifo_shm_create_fd(fifo_shm_TD *fifo, int fd, fifo_size_t size, uint16_t entry_size)
+{
+	size_t bytes = fifo_shm_region_size(size, entry_size);
+	void *area = NULL;
+	int result = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(fd < 0) return -2; /* no file descriptor */
+	if(entry_size == 0) return -4; /* zero entry size */
+	if(size == 0) return -3; /* zero size */
+
+	if(ftruncate(fd, (off_t)bytes) != 0) return -6; /* no memory */
+
+	area = fifo_shm_map(fd, bytes);
+	if(area == NULL) return -6; /* mapping failed */
+
+	result = fifo_shm_init(fifo, area, bytes, size, entry_size);
+
+	if(result != 0)
+	{
+		munmap(area, bytes);
+		return result;
+	}
+
+	fifo->map_size = bytes;
+
+	return 0;
+}
+
+/**
+ *	@brief Maps fd of a shared FIFO buffer created by another process and attaches fifo to it.
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param fd - file descriptor of the shared memory object
+ *
+ *	@retval returns: 0 - attached successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - fd is negative
+ *					-5 - region not initialized yet or of another layout
+ *					-6 - fstat or mmap failed, errno is left as set by them
+ */
+int fifo_shm_attach_fd(fifo_shm_TD *fifo, int fd)
+{
+	struct stat st;
+	void *area = NULL;
+	int result = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(fd < 0) return -2; /* no file descriptor */
+
+	if(fstat(fd, &st) != 0) return -6; /* stat failed */
+	if((size_t)st.st_size < fifo_shm_data_offset()) return -5; /* not sized yet */
+
+	area = fifo_shm_map(fd, (size_t)st.st_size);
+	if(area == NULL) return -6; /* mapping failed */
+
+	result = fifo_shm_attach_region(fifo, area, (size_t)st.st_size);
+
+	if(result != 0)
+	{
+		munmap(area, (size_t)st.st_size);
+		return result;
+	}
+
+	fifo->map_size = (size_t)st.st_size;
+
+	return 0;
+}
+
+/**
+ *	@brief Creates the POSIX shared memory object name and formats it as an empty shared FIFO buffer.
+ *	Fails if name exists, stale objects are removed with fifo_shm_unlink().
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param name - name of the object, "/name" as for shm_open(3)
+ *	@param size - size of FIFO buffer
+ *	@param entry_size - size of an entry of FIFO buffer
+ *
+ *	@retval returns: 0 - shared FIFO buffer created successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - name pointer is NULL
+ *					-3 - size of FIFO buffer is 0 or larger than FIFO_SPSC_MAX_SIZE
+ *					-4 - size of entry is 0
+ *					-5 - indices not lock-free
+ *					-6 - shm_open, ftruncate or mmap failed, errno is left as set by them
+ */
+int fifo_shm_create(fifo_shm_TD *fifo, const char *name, fifo_size_t size, uint16_t entry_size)
+{
+	int fd = -1;
+	int result = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(name == NULL) return -2; /* name pointer NULL */
+	if(entry_size == 0) return -4; /* zero entry size */
+	if(size == 0) return -3; /* zero size */
+
+	fd = shm_open(name, (O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC), FIFO_SHM_MODE);
+	if(fd < 0) return -6; /* object not created */
+
+	result = fifo_shm_create_fd(fifo, fd, size, entry_size);
+	close(fd); /* mapping keeps the object alive */
+
+	if(result != 0) shm_unlink(name);
+
+	return result;
+}
+
+/**
+ *	@brief Opens the POSIX shared memory object name created by fifo_shm_create() and attaches fifo to it.
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param name - name of the object, "/name" as for shm_open(3)
+ *
+ *	@retval returns: 0 - attached successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - name pointer is NULL
+ *					-5 - region not initialized yet or of another layout, may be retried
+ *					-6 - shm_open, fstat or mmap failed, errno is left as set by them
+ */
+int fifo_shm_attach(fifo_shm_TD *fifo, const char *name)
+{
+	int fd = -1;
+	int result = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(name == NULL) return -2; /* name pointer NULL */
+
+	fd = shm_open(name, (O_RDWR | O_CLOEXEC), 0);
+	if(fd < 0) return -6; /* object not found */
+
+	result = fifo_shm_attach_fd(fifo, fd);
+	close(fd); /* mapping keeps the object alive */
+
+	return result;
+}
+
+/**
+ *	@brief Unmaps the region mapped by create/attach functions, the object and its entries stay for the other process.
+ *
+ *	@param fifo - pointer to the local handle
+ *
+ *	@retval returns: 0 - detached successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - fifo is not attached
+ */
+int fifo_shm_detach(fifo_shm_TD *fifo)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(fifo->header == NULL) return -2; /* not attached */
+
+	if(fifo->map_size != 0) munmap(fifo->header, fifo->map_size);
+
+	fifo->header = NULL;
+	fifo->buffer = NULL;
+	fifo->map_size = 0;
+
+	return 0;
+}
+
+/**
+ *	@brief Removes the name of a POSIX shared memory object, mappings made before stay valid.
+ *
+ *	@param name - name of the object, "/name" as for shm_open(3)
+ *
+ *	@retval returns: 0 - name removed successfully
+ *					-2 - name pointer is NULL
+ *					-6 - shm_unlink failed, errno is left as set by it
+ */
+int fifo_shm_unlink(const char *name)
+{
+	if(name == NULL) return -2; /* name pointer NULL */
+
+	return ((shm_unlink(name) == 0) ? 0 : -6);
+}
+
+/**
+ *	@brief Gives amount of entries stored in shared FIFO buffer, may be called from either side.
+ *
+ *	@param fifo - pointer to the local handle
+ *
+ *	@retval returns: amount of entries in FIFO buffer, 0 if fifo pointer is NULL or not attached
+ */
+fifo_size_t fifo_shm_count(fifo_shm_TD *fifo)
+{
+	if((fifo == NULL) || (fifo->header == NULL)) return 0; /* not attached */
+
+	return fifo_spsc_ring_count(&fifo->header->ring);
+}
+
+/**
+ *	@brief Pops value from shared FIFO buffer. Consumer side only.
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param val_buffer - pointer to value store buffer
+ *
+ *	@retval returns: 0 - head popped successfully
+ *					-1 - fifo pointer is NULL or not attached
+ *					-2 - value buffer pointer is NULL
+ *					-3 - FIFO buffer empty
+ */
+int fifo_shm_pop(fifo_shm_TD *fifo, void *val_buffer)
+{
+	if((fifo == NULL) || (fifo->header == NULL)) return -1; /* fifo pointer NULL */
+	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
+	if(fifo_spsc_ring_pop_mul(&fifo->header->ring, fifo->buffer, val_buffer, 1) != 0) return -3; /* fifo empty */
+
+	return 0;
+}
+
+/**
+ *	@brief Pops m entries from shared FIFO buffer. Consumer side only.
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param pop_buffer - pointer to the buffer into which the values will be popped
+ *	@param m - amount of entries to be popped
+ *
+ *	@retval returns:	0 - all of the m entries was popped
+ *					-1 - fifo pointer is NULL or not attached
+ *					-2 - pop buffer pointer is NULL
+ *					-3 - amount of the entries to be popped is zero
+ *					-4 - FIFO buffer current size lower than m
+ */
+int fifo_shm_pop_mul(fifo_shm_TD *fifo, void *pop_buffer, fifo_size_t m)
+{
+	if((fifo == NULL) || (fifo->header == NULL)) return -1; /* fifo pointer NULL */
+
+	return fifo_spsc_ring_pop_mul(&fifo->header->ring, fifo->buffer, pop_buffer, m);
+}
+
+/**
+ *	@brief Pops as many of m entries as shared FIFO buffer holds. Consumer side only.
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param pop_buffer - pointer to the buffer into which the values will be popped
+ *	@param m - maximal amount of entries to be popped
+ *
+ *	@retval returns: amount of entries popped, 0 if FIFO buffer is empty or any pointer is NULL
+ */
+fifo_size_t fifo_shm_read_some(fifo_shm_TD *fifo, void *pop_buffer, fifo_size_t m)
+{
+	if((fifo == NULL) || (fifo->header == NULL)) return 0; /* fifo pointer NULL */
+
+	return fifo_spsc_ring_read_some(&fifo->header->ring, fifo->buffer, pop_buffer, m);
+}
+
+/**
+ *	@brief Gives direct access to n entries at the head of shared FIFO buffer without copying them. Consumer side only.
+ *	Entries stay in FIFO buffer until fifo_shm_release() is called.
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param n - amount of entries to be peeked
+ *	@param region1 - pointer to the first contiguous span of entries
+ *	@param len1 - amount of entries in the first span
+ *	@param region2 - pointer to the second span after wraparound, NULL if there is no wraparound
+ *	@param len2 - amount of entries in the second span
+ *
+ *	@retval returns:	0 - n entries are available in region1 and region2
+ *					-1 - fifo pointer is NULL or not attached
+ *					-2 - region or length pointer is NULL
+ *					-3 - amount of the entries to be peeked is zero
+ *					-4 - FIFO buffer current size lower than n
+ */
+int fifo_shm_peek(fifo_shm_TD *fifo, fifo_size_t n, void **region1, fifo_size_t *len1, void **region2, fifo_size_t *len2)
+{
+	if((fifo == NULL) || (fifo->header == NULL)) return -1; /* fifo pointer NULL */
+
+	return fifo_spsc_ring_peek(&fifo->header->ring, fifo->buffer, n, region1, len1, region2, len2);
+}
+
+/**
+ *	@brief Releases n entries previously accessed with fifo_shm_peek(). Consumer side only.
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param n - amount of entries to be released
+ *
+ *	@retval returns:	0 - n entries released
+ *					-1 - fifo pointer is NULL or not attached
+ *					-3 - amount of the entries to be released is zero
+ *					-4 - FIFO buffer current size lower than n
+ */
+int fifo_shm_release(fifo_shm_TD *fifo, fifo_size_t n)
+{
+	if((fifo == NULL) || (fifo->header == NULL)) return -1; /* fifo pointer NULL */
+
+	return fifo_spsc_ring_release(&fifo->header->ring, n);
+}
+
+/**
+ *	@brief Pushes value into shared FIFO buffer. Producer side only.
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param val_buffer - value buffer to push
+ *
+ *	@retval returns: 0 - tail pushed successfully
+ *					-1 - fifo pointer is NULL or not attached
+ *					-2 - value buffer pointer is NULL
+ *					-3 - FIFO buffer full
+ */
+int fifo_shm_push(fifo_shm_TD *fifo, const void *val_buffer)
+{
+	if((fifo == NULL) || (fifo->header == NULL)) return -1; /* fifo pointer NULL */
+	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
+	if(fifo_spsc_ring_push_mul(&fifo->header->ring, fifo->buffer, val_buffer, 1) != 0) return -3; /* fifo FULL */
+
+	return 0;
+}
+
+/**
+ *	@brief Pushes m entries into shared FIFO buffer. Producer side only.
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param push_buffer - pointer to the buffer from which the values will be pushed
+ *	@param m - amount of entries to be pushed
+ *
+ *	@retval returns:	0 - all of the m entries was pushed
+ *					-1 - fifo pointer is NULL or not attached
+ *					-2 - push buffer pointer is NULL
+ *					-3 - amount of the entries to be pushed is zero
+ *					-4 - no place for m element in FIFO buffer
+ */
+int fifo_shm_push_mul(fifo_shm_TD *fifo, const void *push_buffer, fifo_size_t m)
+{
+	if((fifo == NULL) || (fifo->header == NULL)) return -1; /* fifo pointer NULL */
+
+	return fifo_spsc_ring_push_mul(&fifo->header->ring, fifo->buffer, push_buffer, m);
+}
+
+/**
+ *	@brief Pushes as many of m entries as fit into shared FIFO buffer. Producer side only.
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param push_buffer - pointer to the buffer from which the values will be pushed
+ *	@param m - maximal amount of entries to be pushed
+ *
+ *	@retval returns: amount of entries pushed, 0 if FIFO buffer is full or any pointer is NULL
+ */
+fifo_size_t fifo_shm_write_some(fifo_shm_TD *fifo, const void *push_buffer, fifo_size_t m)
+{
+	if((fifo == NULL) || (fifo->header == NULL)) return 0; /* fifo pointer NULL */
+
+	return fifo_spsc_ring_write_some(&fifo->header->ring, fifo->buffer, push_buffer, m);
+}
+
+/**
+ *	@brief Reserves place for n entries at the tail of shared FIFO buffer to be written in place. Producer side only.
+ *	Entries become visible to the consumer after fifo_shm_commit() is called.
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param n - amount of entries to be reserved
+ *	@param region1 - pointer to the first contiguous free span
+ *	@param len1 - amount of entries in the first span
+ *	@param region2 - pointer to the second span after wraparound, NULL if there is no wraparound
+ *	@param len2 - amount of entries in the second span
+ *
+ *	@retval returns:	0 - place for n entries is available in region1 and region2
+ *					-1 - fifo pointer is NULL or not attached
+ *					-2 - region or length pointer is NULL
+ *					-3 - amount of the entries to be reserved is zero
+ *					-4 - no place for n element in FIFO buffer
+ */
+int fifo_shm_reserve(fifo_shm_TD *fifo, fifo_size_t n, void **region1, fifo_size_t *len1, void **region2, fifo_size_t *len2)
+{
+	if((fifo == NULL) || (fifo->header == NULL)) return -1; /* fifo pointer NULL */
+
+	return fifo_spsc_ring_reserve(&fifo->header->ring, fifo->buffer, n, region1, len1, region2, len2);
+}
+
+/**
+ *	@brief Commits n entries written into the span given by fifo_shm_reserve(). Producer side only.
+ *
+ *	@param fifo - pointer to the local handle
+ *	@param n - amount of entries to be committed
+ *
+ *	@retval returns:	0 - n entries committed
+ *					-1 - fifo pointer is NULL or not attached
+ *					-3 - amount of the entries to be committed is zero
+ *					-4 - no place for n element in FIFO buffer
+ */
+int fifo_shm_commit(fifo_shm_TD *fifo, fifo_size_t n)
+{
+	if((fifo == NULL) || (fifo->header == NULL)) return -1; /* fifo pointer NULL */
+
+	return fifo_spsc_ring_commit(&fifo->header->ring, n);
+}
+
+/**
+* 	@}
+*/
+
+/**
+* 	@}
+*/
+
+#endif /* __linux__ */
@@ -0,0 +1,102 @@
+/**
+ * 	@file fifo_shm.h
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Inter-process SPSC FIFO buffers in shared memory (Linux).
+ *  The region starts with a self-describing header that holds the SPSC ring state
+ *  (indices only, no pointers) followed by the entries at data_offset, so two processes
+ *  may map it at different addresses. Each process keeps a local fifo_shm_TD handle
+ *  with its own mapping address; only the producer process pushes and only the consumer pops.
+ *
+ *  The creator formats the region and publishes FIFO_SHM_MAGIC last, attach functions return -5
+ *  until then, so the consumer may retry while the producer starts.
+ *  Both processes must be built with the same FIFO_SIZE_BITS, FIFO_SPSC_CACHE_ALIGNED and FIFO_STATS,
+ *  attach checks it through the layout word of the header.
+ */
+
+#ifndef FIFO_SHM_H_
+#define FIFO_SHM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "fifo_config.h"
+#include "fifo_spsc.h"
+
+/**
+* 	@brief	Value of the header magic word of an initialized region ("FIFS").
+*/
+#define FIFO_SHM_MAGIC				0x46494653u
+
+/**
+* 	@brief	Version of the region layout.
+*/
+#define FIFO_SHM_VERSION			1u
+
+/**
+* 	@brief	Build options the ring state layout depends on, checked by attach functions.
+*/
+#define FIFO_SHM_LAYOUT				((uint32_t)FIFO_SIZE_BITS | ((uint32_t)FIFO_SPSC_CACHE_ALIGNED << 8) | ((uint32_t)FIFO_STATS << 9))
+
+/**
+* 	@brief	Access mode of shared memory objects created by fifo_shm_create().
+*/
+#ifndef FIFO_SHM_MODE
+#define FIFO_SHM_MODE				0600
+#endif
+
+/**
+* 	@brief	Header at the start of a shared FIFO region, the same bytes in every process.
+*/
+typedef struct
+{
+	_Atomic uint32_t magic;			/**< FIFO_SHM_MAGIC once the region is initialized, 0 before */
+	uint32_t version;				/**< FIFO_SHM_VERSION of the creator */
+	uint32_t layout;				/**< FIFO_SHM_LAYOUT of the creator */
+	uint32_t ring_size;				/**< sizeof(fifo_spsc_ring_TD) of the creator */
+	uint64_t data_offset;			/**< Offset of the entries from the region start in Bytes */
+	uint64_t region_size;			/**< Size of the region in Bytes */
+
+	fifo_spsc_ring_TD ring;			/**< SPSC ring state: sizes and head/tail indices */
+
+}fifo_shm_header_TD;
+
+/**
+* 	@brief	Process-local handle of a shared FIFO buffer.
+*/
+typedef struct
+{
+	fifo_shm_header_TD *header;		/**< Local address of the region header */
+	uint8_t *buffer;				/**< Local address of the entries */
+	size_t map_size;				/**< Size of the mapping made by create/attach functions, 0 for user regions */
+
+}fifo_shm_TD;
+
+size_t fifo_shm_region_size(fifo_size_t size, uint16_t entry_size);
+int fifo_shm_init(fifo_shm_TD *fifo, void *region, size_t region_size, fifo_size_t size, uint16_t entry_size);
+int fifo_shm_attach_region(fifo_shm_TD *fifo, void *region, size_t region_size);
+int fifo_shm_create_fd(fifo_shm_TD *fifo, int fd, fifo_size_t size, uint16_t entry_size);
+int fifo_shm_attach_fd(fifo_shm_TD *fifo, int fd);
+int fifo_shm_create(fifo_shm_TD *fifo, const char *name, fifo_size_t size, uint16_t entry_size);
+int fifo_shm_attach(fifo_shm_TD *fifo, const char *name);
+int fifo_shm_detach(fifo_shm_TD *fifo);
+int fifo_shm_unlink(const char *name);
+
+fifo_size_t fifo_shm_count(fifo_shm_TD *fifo);
+int fifo_shm_pop(fifo_shm_TD *fifo, void *val_buffer);
+int fifo_shm_pop_mul(fifo_shm_TD *fifo, void *pop_buffer, fifo_size_t m);
+fifo_size_t fifo_shm_read_some(fifo_shm_TD *fifo, void *pop_buffer, fifo_size_t m);
+int fifo_shm_peek(fifo_shm_TD *fifo, fifo_size_t n, void **region1, fifo_size_t *len1, void **region2, fifo_size_t *len2);
+int fifo_shm_release(fifo_shm_TD *fifo, fifo_size_t n);
+int fifo_shm_push(fifo_shm_TD *fifo, const void *val_buffer);
+int fifo_shm_push_mul(fifo_shm_TD *fifo, const void *push_buffer, fifo_size_t m);
+fifo_size_t fifo_shm_write_some(fifo_shm_TD *fifo, const void *push_buffer, fifo_size_t m);
+int fifo_shm_reserve(fifo_shm_TD *fifo, fifo_size_t n, void **region1, fifo_size_t *len1, void **region2, fifo_size_t *len2);
+int fifo_shm_commit(fifo_shm_TD *fifo, fifo_size_t n);
+
+#endif /* FIFO_SHM_H_ */
@@ -0,0 +1,394 @@
+/**
+ * 	@file fifo_simd.h
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Vectorized copy and widening kernels of FIFO bulk functions.
+ *  Short copies (up to FIFO_SIMD_SHORT_COPY Bytes) are done inline with overlapping
+ *  unaligned loads/stores instead of a memcpy call, longer ones go to memcpy.
+ *  Widening kernels convert u8->u16, u16->i32 and u16->f32 while copying.
+ *  Reduction kernels sum and fold min/max of u16 samples in place, without copying them out.
+ *  Uses AVX2, SSE2 or NEON when the compiler targets them, portable C otherwise.
+ */
+
+#ifndef FIFO_SIMD_H_
+#define FIFO_SIMD_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "fifo_config.h"
+
+#if (FIFO_SIMD == 1) && defined(__AVX2__)
+#include <immintrin.h>
+#define FIFO_SIMD_AVX2			1
+#endif
+
+#if (FIFO_SIMD == 1) && defined(__SSE2__)
+#include <emmintrin.h>
+#define FIFO_SIMD_SSE2			1
+#elif (FIFO_SIMD == 1) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define FIFO_SIMD_NEON			1
+#endif
+
+/**
+* 	@brief	Longest copy in Bytes done inline by fifo_simd_copy().
+*/
+#define FIFO_SIMD_SHORT_COPY	64
+
+/**
+ *	@brief Copies bytes from src to dst, short runs inline with overlapping loads/stores. Zero bytes touch neither pointer.
+ */
+static inline void fifo_simd_copy(void *dst, const void *src, size_t bytes)
+{
+	uint8_t *d = dst;
+	const uint8_t *s = src;
+
+	if(bytes == 0) return; /* nothing to copy, dst or src may be NULL */
+
+#if defined(__GNUC__)
+	if(__builtin_constant_p(bytes))
+	{
+		memcpy(d, s, bytes); /* compiler already emits fixed-size moves */
+		return;
+	}
+#endif
+
+	if(bytes > FIFO_SIMD_SHORT_COPY)
+	{
+		memcpy(d, s, bytes);
+		return;
+	}
+
+#if defined(FIFO_SIMD_AVX2)
+	if(bytes >= 32)
+	{
+		__m256i a = _mm256_loadu_si256((const __m256i *)s);
+		__m256i b = _mm256_loadu_si256((const __m256i *)(s + bytes - 32));
+		_mm256_storeu_si256((__m256i *)d, a);
+		_mm256_storeu_si256((__m256i *)(d + bytes - 32), b);
+		return;
+	}
+#endif
+
+#if defined(FIFO_SIMD_SSE2)
+	if(bytes > 32)
+	{
+		__m128i a = _mm_loadu_si128((const __m128i *)s);
+		__m128i b = _mm_loadu_si128((const __m128i *)(s + 16));
+		__m128i e = _mm_loadu_si128((const __m128i *)(s + bytes - 32));
+		__m128i f = _mm_loadu_si128((const __m128i *)(s + bytes - 16));
+		_mm_storeu_si128((__m128i *)d, a);
+		_mm_storeu_si128((__m128i *)(d + 16), b);
+		_mm_storeu_si128((__m128i *)(d + bytes - 32), e);
+		_mm_storeu_si128((__m128i *)(d + bytes - 16), f);
+		return;
+	}
+
+	if(bytes >= 16)
+	{
+		__m128i a = _mm_loadu_si128((const __m128i *)s);
+		__m128i b = _mm_loadu_si128((const __m128i *)(s + bytes - 16));
+		_mm_storeu_si128((__m128i *)d, a);
+		_mm_storeu_si128((__m128i *)(d + bytes - 16), b);
+		return;
+	}
+#elif defined(FIFO_SIMD_NEON)
+	if(bytes >= 16)
+	{
+		size_t i = 0;
+
+		for(i = 0; (i + 16) < bytes; i += 16) vst1q_u8(d + i, vld1q_u8(s + i));
+		vst1q_u8(d + bytes - 16, vld1q_u8(s + bytes - 16));
+		return;
+	}
+#endif
+
+	if(bytes >= 8)
+	{
+		uint64_t a = 0;
+		uint64_t b = 0;
+		size_t i = 0;
+
+		for(i = 0; (i + 8) < bytes; i += 8)
+		{
+			memcpy(&a, s + i, 8);
+			memcpy(d + i, &a, 8);
+		}
+		memcpy(&b, s + bytes - 8, 8);
+		memcpy(d + bytes - 8, &b, 8);
+	}
+	else if(bytes >= 4)
+	{
+		uint32_t a = 0;
+		uint32_t b = 0;
+
+		memcpy(&a, s, 4);
+		memcpy(&b, s + bytes - 4, 4);
+		memcpy(d, &a, 4);
+		memcpy(d + bytes - 4, &b, 4);
+	}
+	else if(bytes >= 2)
+	{
+		uint16_t a = 0;
+		uint16_t b = 0;
+
+		memcpy(&a, s, 2);
+		memcpy(&b, s + bytes - 2, 2);
+		memcpy(d, &a, 2);
+		memcpy(d + bytes - 2, &b, 2);
+	}
+	else if(bytes == 1)
+	{
+		*d = *s;
+	}
+}
+
+/**
+ *	@brief Widens n uint8_t values of src into uint16_t values of dst.
+ */
+static inline void fifo_simd_u8_to_u16(uint16_t *dst, const uint8_t *src, size_t n)
+{
+	size_t i = 0;
+
+#if defined(FIFO_SIMD_AVX2)
+	for(; (i + 16) <= n; i += 16)
+	{
+		_mm256_storeu_si256((__m256i *)(dst + i), _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(src + i))));
+	}
+#elif defined(FIFO_SIMD_SSE2)
+	for(; (i + 16) <= n; i += 16)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+		_mm_storeu_si128((__m128i *)(dst + i), _mm_unpacklo_epi8(v, _mm_setzero_si128()));
+		_mm_storeu_si128((__m128i *)(dst + i + 8), _mm_unpackhi_epi8(v, _mm_setzero_si128()));
+	}
+#elif defined(FIFO_SIMD_NEON)
+	for(; (i + 16) <= n; i += 16)
+	{
+		uint8x16_t v = vld1q_u8(src + i);
+		vst1q_u16(dst + i, vmovl_u8(vget_low_u8(v)));
+		vst1q_u16(dst + i + 8, vmovl_u8(vget_high_u8(v)));
+	}
+#endif
+
+	for(; i < n; i++) dst[i] = src[i];
+}
+
+/**
+ *	@brief Widens n uint16_t values of src into int32_t values of dst.
+ */
+static inline void fifo_simd_u16_to_i32(int32_t *dst, const uint16_t *src, size_t n)
+{
+	size_t i = 0;
+
+#if defined(FIFO_SIMD_AVX2)
+	for(; (i + 8) <= n; i += 8)
+	{
+		_mm256_storeu_si256((__m256i *)(dst + i), _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(src + i))));
+	}
+#elif defined(FIFO_SIMD_SSE2)
+	for(; (i + 8) <= n; i += 8)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+		_mm_storeu_si128((__m128i *)(dst + i), _mm_unpacklo_epi16(v, _mm_setzero_si128()));
+		_mm_storeu_si128((__m128i *)(dst + i + 4), _mm_unpackhi_epi16(v, _mm_setzero_si128()));
+	}
+#elif defined(FIFO_SIMD_NEON)
+	for(; (i + 8) <= n; i += 8)
+	{
+		uint16x8_t v = vld1q_u16(src + i);
+		vst1q_s32(dst + i, vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(v))));
+		vst1q_s32(dst + i + 4, vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(v))));
+	}
+#endif
+
+	for(; i < n; i++) dst[i] = (int32_t)src[i];
+}
+
+/**
+ *	@brief Converts n uint16_t values of src into float values of dst.
+ */
+static inline void fifo_simd_u16_to_f32(float *dst, const uint16_t *src, size_t n)
+{
+	size_t i = 0;
+
+#if defined(FIFO_SIMD_AVX2)
+	for(; (i + 8) <= n; i += 8)
+	{
+		_mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(src + i)))));
+	}
+#elif defined(FIFO_SIMD_SSE2)
+	for(; (i + 8) <= n; i += 8)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+		_mm_storeu_ps(dst + i, _mm_cvtepi32_ps(_mm_unpacklo_epi16(v, _mm_setzero_si128())));
+		_mm_storeu_ps(dst + i + 4, _mm_cvtepi32_ps(_mm_unpackhi_epi16(v, _mm_setzero_si128())));
+	}
+#elif defined(FIFO_SIMD_NEON)
+	for(; (i + 8) <= n; i += 8)
+	{
+		uint16x8_t v = vld1q_u16(src + i);
+		vst1q_f32(dst + i, vcvtq_f32_u32(vmovl_u16(vget_low_u16(v))));
+		vst1q_f32(dst + i + 4, vcvtq_f32_u32(vmovl_u16(vget_high_u16(v))));
+	}
+#endif
+
+	for(; i < n; i++) dst[i] = (float)src[i];
+}
+
+/**
+ *	@brief Sums n uint16_t values of src, byte lanes are summed by SAD so no lane can overflow.
+ */
+static inline uint64_t fifo_simd_u16_sum(const uint16_t *src, size_t n)
+{
+	uint64_t sum = 0;
+	size_t i = 0;
+
+#if defined(FIFO_SIMD_AVX2)
+	__m256i mask = _mm256_set1_epi16(0x00FF);
+	__m256i lo = _mm256_setzero_si256();
+	__m256i hi = _mm256_setzero_si256();
+	uint64_t lanes[4];
+
+	for(; (i + 16) <= n; i += 16)
+	{
+		__m256i v = _mm256_loadu_si256((const __m256i *)(src + i));
+		lo = _mm256_add_epi64(lo, _mm256_sad_epu8(_mm256_and_si256(v, mask), _mm256_setzero_si256()));
+		hi = _mm256_add_epi64(hi, _mm256_sad_epu8(_mm256_srli_epi16(v, 8), _mm256_setzero_si256()));
+	}
+
+	_mm256_storeu_si256((__m256i *)lanes, _mm256_add_epi64(lo, _mm256_slli_epi64(hi, 8)));
+	sum = (lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+#elif defined(FIFO_SIMD_SSE2)
+	__m128i mask = _mm_set1_epi16(0x00FF);
+	__m128i lo = _mm_setzero_si128();
+	__m128i hi = _mm_setzero_si128();
+	uint64_t lanes[2];
+
+	for(; (i + 8) <= n; i += 8)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+		lo = _mm_add_epi64(lo, _mm_sad_epu8(_mm_and_si128(v, mask), _mm_setzero_si128()));
+		hi = _mm_add_epi64(hi, _mm_sad_epu8(_mm_srli_epi16(v, 8), _mm_setzero_si128()));
+	}
+
+	_mm_storeu_si128((__m128i *)lanes, _mm_add_epi64(lo, _mm_slli_epi64(hi, 8)));
+	sum = (lanes[0] + lanes[1]);
+#elif defined(FIFO_SIMD_NEON)
+	uint64x2_t acc = vdupq_n_u64(0);
+
+	for(; (i + 8) <= n; i += 8)
+	{
+		acc = vpadalq_u32(acc, vpaddlq_u16(vld1q_u16(src + i)));
+	}
+
+	sum = (vgetq_lane_u64(acc, 0) + vgetq_lane_u64(acc, 1));
+#endif
+
+	for(; i < n; i++) sum += src[i];
+
+	return sum;
+}
+
+/**
+ *	@brief Folds n uint16_t values of src into *min and *max, which hold the running result on entry.
+ */
+static inline void fifo_simd_u16_minmax(const uint16_t *src, size_t n, uint16_t *min, uint16_t *max)
+{
+	uint16_t lo = *min;
+	uint16_t hi = *max;
+	size_t i = 0;
+
+#if defined(FIFO_SIMD_AVX2)
+	if(n >= 16)
+	{
+		__m256i vmin = _mm256_set1_epi16((short)lo);
+		__m256i vmax = _mm256_set1_epi16((short)hi);
+		uint16_t lanes_min[16];
+		uint16_t lanes_max[16];
+		size_t j = 0;
+
+		for(; (i + 16) <= n; i += 16)
+		{
+			__m256i v = _mm256_loadu_si256((const __m256i *)(src + i));
+			vmin = _mm256_min_epu16(vmin, v);
+			vmax = _mm256_max_epu16(vmax, v);
+		}
+
+		_mm256_storeu_si256((__m256i *)lanes_min, vmin);
+		_mm256_storeu_si256((__m256i *)lanes_max, vmax);
+
+		for(j = 0; j < 16; j++)
+		{
+			if(lanes_min[j] < lo) lo = lanes_min[j];
+			if(lanes_max[j] > hi) hi = lanes_max[j];
+		}
+	}
+#elif defined(FIFO_SIMD_SSE2)
+	if(n >= 8)
+	{
+		__m128i bias = _mm_set1_epi16((short)0x8000); /* SSE2 has signed 16-bit min/max only */
+		__m128i vmin = _mm_xor_si128(_mm_set1_epi16((short)lo), bias);
+		__m128i vmax = _mm_xor_si128(_mm_set1_epi16((short)hi), bias);
+		uint16_t lanes_min[8];
+		uint16_t lanes_max[8];
+		size_t j = 0;
+
+		for(; (i + 8) <= n; i += 8)
+		{
+			__m128i v = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(src + i)), bias);
+			vmin = _mm_min_epi16(vmin, v);
+			vmax = _mm_max_epi16(vmax, v);
+		}
+
+		_mm_storeu_si128((__m128i *)lanes_min, _mm_xor_si128(vmin, bias));
+		_mm_storeu_si128((__m128i *)lanes_max, _mm_xor_si128(vmax, bias));
+
+		for(j = 0; j < 8; j++)
+		{
+			if(lanes_min[j] < lo) lo = lanes_min[j];
+			if(lanes_max[j] > hi) hi = lanes_max[j];
+		}
+	}
+#elif defined(FIFO_SIMD_NEON)
+	if(n >= 8)
+	{
+		uint16x8_t vmin = vdupq_n_u16(lo);
+		uint16x8_t vmax = vdupq_n_u16(hi);
+		uint16_t lanes_min[8];
+		uint16_t lanes_max[8];
+		size_t j = 0;
+
+		for(; (i + 8) <= n; i += 8)
+		{
+			uint16x8_t v = vld1q_u16(src + i);
+			vmin = vminq_u16(vmin, v);
+			vmax = vmaxq_u16(vmax, v);
+		}
+
+		vst1q_u16(lanes_min, vmin);
+		vst1q_u16(lanes_max, vmax);
+
+		for(j = 0; j < 8; j++)
+		{
+			if(lanes_min[j] < lo) lo = lanes_min[j];
+			if(lanes_max[j] > hi) hi = lanes_max[j];
+		}
+	}
+#endif
+
+	for(; i < n; i++)
+	{
+		if(src[i] < lo) lo = src[i];
+		if(src[i] > hi) hi = src[i];
+	}
+
+	*min = lo;
+	*max = hi;
+}
+
+#endif /* FIFO_SIMD_H_ */
@@ -0,0 +1,1152 @@
+/**
+ * 	@file fifo_spsc.c
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Implementation of lock-free single-producer/single-consumer FIFO buffers.
+ *  Alert: push functions must be called from a single producer context and
+ *  pop functions from a single consumer context.
+ *
+ */
+
+#include "fifo_spsc.h"
+#include "fifo_simd.h"
+
+/**
+*	@addtogroup Software_FIFO_buffer Software FIFO buffers
+* 	@{
+*/
+
+/**
+*	@addtogroup SPSC_FIFO_buffer SPSC FIFO buffer
+* 	@{
+*/
+
+/**
+ *	@brief Returns amount of entries stored between head and tail indices.
+ */
+static inline fifo_index_t fifo_spsc_count(fifo_index_t head, fifo_index_t tail, fifo_index_t max_size)
+{
+	return (tail >= head) ? (tail - head) : (((2 * max_size) - head) + tail);
+}
+
+/**
+ *	@brief Converts head/tail index into entry position inside the buffer.
+ */
+static inline fifo_index_t fifo_spsc_position(fifo_index_t index, fifo_index_t max_size)
+{
+	return (index < max_size) ? index : (index - max_size);
+}
+
+/**
+ *	@brief Moves head/tail index forward by n entries, wraps without overflow of index + n for any max_size up to FIFO_SPSC_MAX_SIZE.
+ */
+static inline fifo_index_t fifo_spsc_advance(fifo_index_t index, fifo_index_t n, fifo_index_t max_size)
+{
+	fifo_index_t left = (2 * max_size) - index; /* steps until the index wraps to 0 */
+
+	return (n >= left) ? (n - left) : (index + n);
+}
+
+/**
+ *	@brief Returns occupancy seen by the producer after publishing tail, an upper bound as the head copy may be stale.
+ */
+static inline fifo_index_t fifo_spsc_producer_used(const fifo_spsc_ring_TD *ring, fifo_index_t tail)
+{
+	return fifo_spsc_count(ring->head_cache, tail, ring->max_size);
+}
+
+/**
+ *	@brief Returns free place seen by the producer, re-reads head index only when cached copy shows less than m.
+ */
+static inline fifo_index_t fifo_spsc_producer_free(fifo_spsc_ring_TD *ring, fifo_index_t tail, fifo_index_t m)
+{
+	fifo_index_t free_size = ring->max_size - fifo_spsc_count(ring->head_cache, tail, ring->max_size);
+
+	if(free_size < m)
+	{
+		ring->head_cache = atomic_load_explicit(&ring->head, memory_order_acquire);
+		free_size = ring->max_size - fifo_spsc_count(ring->head_cache, tail, ring->max_size);
+	}
+
+	return free_size;
+}
+
+/**
+ *	@brief Returns amount of entries seen by the consumer, re-reads tail index only when cached copy shows less than m.
+ */
+static inline fifo_index_t fifo_spsc_consumer_count(fifo_spsc_ring_TD *ring, fifo_index_t head, fifo_index_t m)
+{
+	fifo_index_t count = fifo_spsc_count(head, ring->tail_cache, ring->max_size);
+
+	if(count < m)
+	{
+		ring->tail_cache = atomic_load_explicit(&ring->tail, memory_order_acquire);
+		count = fifo_spsc_count(head, ring->tail_cache, ring->max_size);
+	}
+
+	return count;
+}
+
+/**
+ *	@brief Copies m entries into the buffer starting at index, split once at the buffer end.
+ */
+static inline void fifo_spsc_copy_in(const fifo_spsc_ring_TD *ring, uint8_t *buffer, fifo_index_t index, const uint8_t *push_buffer, fifo_index_t m, size_t entry_size)
+{
+	fifo_index_t pos = fifo_spsc_position(index, ring->max_size);
+	fifo_index_t first = ring->max_size - pos;
+
+	if(m == 1)
+	{
+		memcpy(buffer + (pos * entry_size), push_buffer, entry_size); /* single entry, fixed-size copy */
+		return;
+	}
+
+	if(m <= first)
+	{
+		fifo_simd_copy(buffer + (pos * entry_size), push_buffer, (m * entry_size));
+	}
+	else
+	{
+		fifo_simd_copy(buffer + (pos * entry_size), push_buffer, (first * entry_size));
+		fifo_simd_copy(buffer, push_buffer + (first * entry_size), ((m - first) * entry_size));
+	}
+}
+
+/**
+ *	@brief Copies m entries out of the buffer starting at index, split once at the buffer end.
+ */
+static inline void fifo_spsc_copy_out(const fifo_spsc_ring_TD *ring, const uint8_t *buffer, fifo_index_t index, uint8_t *pop_buffer, fifo_index_t m, size_t entry_size)
+{
+	fifo_index_t pos = fifo_spsc_position(index, ring->max_size);
+	fifo_index_t first = ring->max_size - pos;
+
+	if(m == 1)
+	{
+		memcpy(pop_buffer, buffer + (pos * entry_size), entry_size); /* single entry, fixed-size copy */
+		return;
+	}
+
+	if(m <= first)
+	{
+		fifo_simd_copy(pop_buffer, buffer + (pos * entry_size), (m * entry_size));
+	}
+	else
+	{
+		fifo_simd_copy(pop_buffer, buffer + (pos * entry_size), (first * entry_size));
+		fifo_simd_copy(pop_buffer + (first * entry_size), buffer, ((m - first) * entry_size));
+	}
+}
+
+/**
+ *	@brief Pushes m entries of entry_size Bytes, returns -4 when there is no place for them.
+ */
+static inline int fifo_spsc_push_n(fifo_spsc_ring_TD *ring, uint8_t *buffer, const uint8_t *push_buffer, fifo_index_t m, size_t entry_size)
+{
+	uint64_t start = FIFO_STATS_START();
+	fifo_index_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+	if(m > fifo_spsc_producer_free(ring, tail, m)) return FIFO_STATS_PUSH_REJECT(&ring->stats, -4); /* no place for m elements in FIFO */
+
+	fifo_spsc_copy_in(ring, buffer, tail, push_buffer, m, entry_size);
+	tail = fifo_spsc_advance(tail, m, ring->max_size);
+	atomic_store_explicit(&ring->tail, tail, memory_order_release);
+	FIFO_STATS_PUSH(&ring->stats, m, fifo_spsc_producer_used(ring, tail), start);
+
+	return 0;
+}
+
+/**
+ *	@brief Pops m entries of entry_size Bytes, returns -4 when FIFO holds less than m entries.
+ */
+static inline int fifo_spsc_pop_n(fifo_spsc_ring_TD *ring, const uint8_t *buffer, uint8_t *pop_buffer, fifo_index_t m, size_t entry_size)
+{
+	uint64_t start = FIFO_STATS_START();
+	fifo_index_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+	if(m > fifo_spsc_consumer_count(ring, head, m)) return FIFO_STATS_POP_REJECT(&ring->stats, -4); /* current size lower than m */
+
+	fifo_spsc_copy_out(ring, buffer, head, pop_buffer, m, entry_size);
+	atomic_store_explicit(&ring->head, fifo_spsc_advance(head, m, ring->max_size), memory_order_release);
+	FIFO_STATS_POP(&ring->stats, m, start);
+
+	return 0;
+}
+
+/**
+ *	@brief Pushes up to m entries of entry_size Bytes, returns amount of entries pushed.
+ */
+static inline fifo_size_t fifo_spsc_write_n(fifo_spsc_ring_TD *ring, uint8_t *buffer, const uint8_t *push_buffer, fifo_index_t m, size_t entry_size)
+{
+	uint64_t start = FIFO_STATS_START();
+	fifo_index_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+	fifo_index_t free_size = fifo_spsc_producer_free(ring, tail, m);
+
+	if(m > free_size) m = free_size;
+	if(m == 0) return 0; /* fifo full */
+
+	fifo_spsc_copy_in(ring, buffer, tail, push_buffer, m, entry_size);
+	tail = fifo_spsc_advance(tail, m, ring->max_size);
+	atomic_store_explicit(&ring->tail, tail, memory_order_release);
+	FIFO_STATS_PUSH(&ring->stats, m, fifo_spsc_producer_used(ring, tail), start);
+
+	return (fifo_size_t)m;
+}
+
+/**
+ *	@brief Pops up to m entries of entry_size Bytes, returns amount of entries popped.
+ */
+static inline fifo_size_t fifo_spsc_read_n(fifo_spsc_ring_TD *ring, const uint8_t *buffer, uint8_t *pop_buffer, fifo_index_t m, size_t entry_size)
+{
+	uint64_t start = FIFO_STATS_START();
+	fifo_index_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+	fifo_index_t count = fifo_spsc_consumer_count(ring, head, m);
+
+	if(m > count) m = count;
+	if(m == 0) return 0; /* fifo empty */
+
+	fifo_spsc_copy_out(ring, buffer, head, pop_buffer, m, entry_size);
+	atomic_store_explicit(&ring->head, fifo_spsc_advance(head, m, ring->max_size), memory_order_release);
+	FIFO_STATS_POP(&ring->stats, m, start);
+
+	return (fifo_size_t)m;
+}
+
+/**
+ *	@brief Pops up to max entries of entry_size Bytes once min arrived or spin re-reads of tail ran out, one head store.
+ */
+static inline fifo_size_t fifo_spsc_drain_n(fifo_spsc_ring_TD *ring, const uint8_t *buffer, uint8_t *pop_buffer, fifo_index_t min, fifo_index_t max, uint32_t spin, size_t entry_size)
+{
+	uint64_t start = FIFO_STATS_START();
+	fifo_index_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+	fifo_index_t count = 0;
+
+	if(min > max) min = max;
+	if(min > ring->max_size) min = ring->max_size;
+
+	count = fifo_spsc_consumer_count(ring, head, max);
+
+	while((count < min) && (spin != 0))
+	{
+		FIFO_CPU_RELAX();
+		spin--;
+
+		ring->tail_cache = atomic_load_explicit(&ring->tail, memory_order_acquire);
+		count = fifo_spsc_count(head, ring->tail_cache, ring->max_size);
+	}
+
+	if(max > count) max = count;
+	if(max == 0) return 0; /* fifo empty */
+
+	fifo_spsc_copy_out(ring, buffer, head, pop_buffer, max, entry_size);
+	atomic_store_explicit(&ring->head, fifo_spsc_advance(head, max, ring->max_size), memory_order_release);
+	FIFO_STATS_POP(&ring->stats, max, start);
+
+	return (fifo_size_t)max;
+}
+
+/**
+ *	@brief Pushes the pieces of a gather list as one unit with a single tail store, returns -4 when there is no place for them.
+ */
+static inline int fifo_spsc_pushv_n(fifo_spsc_ring_TD *ring, uint8_t *buffer, const fifo_iovec_TD *iov, fifo_size_t iov_count, fifo_index_t total, size_t entry_size)
+{
+	uint64_t start = FIFO_STATS_START();
+	fifo_index_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+	fifo_size_t i = 0;
+
+	if(total > ring->max_size) return FIFO_STATS_PUSH_REJECT(&ring->stats, -4); /* no place for total length in FIFO */
+	if(total > fifo_spsc_producer_free(ring, tail, total)) return FIFO_STATS_PUSH_REJECT(&ring->stats, -4); /* no place for total length in FIFO */
+
+	for(i = 0; i < iov_count; i++)
+	{
+		if(iov[i].len == 0) continue;
+
+		fifo_spsc_copy_in(ring, buffer, tail, iov[i].base, iov[i].len, entry_size);
+		tail = fifo_spsc_advance(tail, iov[i].len, ring->max_size);
+	}
+
+	atomic_store_explicit(&ring->tail, tail, memory_order_release);
+	FIFO_STATS_PUSH(&ring->stats, total, fifo_spsc_producer_used(ring, tail), start);
+
+	return 0;
+}
+
+/**
+ *	@brief Pops into the pieces of a scatter list as one unit with a single head store, returns -4 when FIFO holds less than their total length.
+ */
+static inline int fifo_spsc_popv_n(fifo_spsc_ring_TD *ring, const uint8_t *buffer, const fifo_iovec_TD *iov, fifo_size_t iov_count, fifo_index_t total, size_t entry_size)
+{
+	uint64_t start = FIFO_STATS_START();
+	fifo_index_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+	fifo_size_t i = 0;
+
+	if(total > ring->max_size) return FIFO_STATS_POP_REJECT(&ring->stats, -4); /* current size lower than total length */
+	if(total > fifo_spsc_consumer_count(ring, head, total)) return FIFO_STATS_POP_REJECT(&ring->stats, -4); /* current size lower than total length */
+
+	for(i = 0; i < iov_count; i++)
+	{
+		if(iov[i].len == 0) continue;
+
+		fifo_spsc_copy_out(ring, buffer, head, iov[i].base, iov[i].len, entry_size);
+		head = fifo_spsc_advance(head, iov[i].len, ring->max_size);
+	}
+
+	atomic_store_explicit(&ring->head, head, memory_order_release);
+	FIFO_STATS_POP(&ring->stats, total, start);
+
+	return 0;
+}
+
+/**
+ *	@brief Splits n entries starting at index into spans before and after the buffer end.
+ */
+static inline void fifo_spsc_spans(const fifo_spsc_ring_TD *ring, void *buffer, fifo_index_t index, fifo_index_t n, void **region1, fifo_size_t *len1, void **region2, fifo_size_t *len2)
+{
+	fifo_index_t pos = fifo_spsc_position(index, ring->max_size);
+	fifo_index_t first = ring->max_size - pos;
+
+	*region1 = ((uint8_t *)buffer + ((size_t)pos * ring->entry_size));
+
+	if(n <= first)
+	{
+		*len1 = (fifo_size_t)n;
+		*region2 = NULL;
+		*len2 = 0;
+	}
+	else
+	{
+		*len1 = (fifo_size_t)first;
+		*region2 = buffer;
+		*len2 = (fifo_size_t)(n - first);
+	}
+}
+
+/**
+ *	@brief Rewinds indices, buffer contents are left as is. Not safe while producer or consumer is active.
+ */
+static inline void fifo_spsc_reset(fifo_spsc_ring_TD *ring)
+{
+	ring->head_cache = 0;
+	ring->tail_cache = 0;
+	atomic_store_explicit(&ring->head, 0, memory_order_relaxed);
+	atomic_store_explicit(&ring->tail, 0, memory_order_release);
+}
+
+/**
+ *	@brief Creates SPSC ring state.
+ *
+ *	@param ring - pointer to the SPSC ring state
+ *	@param size - size of FIFO buffer
+ *	@param entry_size - size of an entry of FIFO buffer
+ *
+ *	@retval returns: 0 - SPSC ring created successfully
+ *					-1 - ring pointer is NULL
+ *					-3 - size of FIFO buffer is 0 or larger than FIFO_SPSC_MAX_SIZE
+ *					-4 - size of entry is 0
+ */
+int fifo_spsc_ring_init(fifo_spsc_ring_TD *ring, fifo_size_t size, uint16_t entry_size)
+{
+	if(ring == NULL) return -1; /* ring pointer NULL */
+	if(size == 0) return -3; /* zero size */
+#if (FIFO_SIZE_BITS != 16)
+	if(size > FIFO_SPSC_MAX_SIZE) return -3; /* too large size */
+#endif
+	if(entry_size == 0) return -4; /* zero entry size */
+
+	ring->entry_size = entry_size;
+	ring->max_size = size;
+	ring->head_cache = 0;
+	ring->tail_cache = 0;
+	atomic_init(&ring->head, 0);
+	atomic_init(&ring->tail, 0);
+	FIFO_STATS_INIT(&ring->stats);
+
+	return 0;
+}
+
+/**
+ *	@brief Gives amount of entries stored in SPSC ring, may be called from either side.
+ *
+ *	@param ring - pointer to the SPSC ring state
+ *
+ *	@retval returns: amount of entries in FIFO buffer, 0 if ring pointer is NULL
+ */
+fifo_size_t fifo_spsc_ring_count(fifo_spsc_ring_TD *ring)
+{
+	fifo_index_t head = 0;
+	fifo_index_t tail = 0;
+
+	if(ring == NULL) return 0; /* ring pointer NULL */
+
+	head = atomic_load_explicit(&ring->head, memory_order_acquire);
+	tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+
+	return (fifo_size_t)fifo_spsc_count(head, tail, ring->max_size);
+}
+
+/**
+ *	@brief Gives amount of entries between two indices of SPSC ring of max_size entries, indices run in range [0, 2 * max_size).
+ *	For rings kept outside of this process or across restarts (shared memory, files).
+ *
+ *	@param from - index the distance is counted from, e.g. head
+ *	@param to - index the distance is counted to, e.g. tail
+ *	@param max_size - size of FIFO buffer
+ *
+ *	@retval returns: amount of entries from from to to
+ */
+fifo_index_t fifo_spsc_ring_distance(fifo_index_t from, fifo_index_t to, fifo_size_t max_size)
+{
+	return fifo_spsc_count(from, to, max_size);
+}
+
+/**
+ *	@brief Checks that a pair of indices could be left by SPSC functions on a ring of max_size entries.
+ *	For rings kept outside of this process or across restarts (shared memory, files).
+ *
+ *	@param head - read index
+ *	@param tail - write index
+ *	@param max_size - size of FIFO buffer
+ *
+ *	@retval returns: true - max_size is from 1 to FIFO_SPSC_MAX_SIZE, both indices below 2 * max_size and at most max_size entries apart
+ *					false - otherwise
+ */
+bool fifo_spsc_ring_indices_valid(fifo_index_t head, fifo_index_t tail, fifo_size_t max_size)
+{
+	if(max_size == 0) return false; /* zero size */
+#if (FIFO_SIZE_BITS != 16)
+	if(max_size > FIFO_SPSC_MAX_SIZE) return false; /* too large size */
+#endif
+	if((head >= (2 * (fifo_index_t)max_size)) || (tail >= (2 * (fifo_index_t)max_size))) return false; /* index out of range */
+
+	return (fifo_spsc_count(head, tail, max_size) <= max_size);
+}
+
+/**
+ *	@brief Pops m entries from SPSC ring. Consumer side only.
+ *
+ *	@param ring - pointer to the SPSC ring state
+ *	@param buffer - pointer to buffer that stores values
+ *	@param pop_buffer - pointer to the buffer into which the values will be popped
+ *	@param m - amount of entries to be popped
+ *
+ *	@retval returns:	0 - all of the m entries was popped
+ *					-1 - ring pointer is NULL
+ *					-2 - buffer or pop buffer pointer is NULL
+ *					-3 - amount of the entries to be popped is zero
+ *					-4 - FIFO buffer current size lower than m
+ */
+int fifo_spsc_ring_pop_mul(fifo_spsc_ring_TD *ring, const void *buffer, void *pop_buffer, fifo_size_t m)
+{
+	if(ring == NULL) return -1; /* ring pointer NULL */
+	if((buffer == NULL) || (pop_buffer == NULL)) return -2; /* buffer pointer NULL */
+	if(m == 0) return -3; /* zero m */
+
+	return fifo_spsc_pop_n(ring, buffer, pop_buffer, m, ring->entry_size);
+}
+
+/**
+ *	@brief Pops entries from SPSC ring into a scatter list as one unit, the head is stored once. Consumer side only.
+ *
+ *	@param ring - pointer to the SPSC ring state
+ *	@param buffer - pointer to buffer that stores values
+ *	@param iov - pointer to the list of pieces, lengths in entries
+ *	@param iov_count - amount of pieces in the list
+ *
+ *	@retval returns:	0 - all of the pieces was filled
+ *					-1 - ring pointer is NULL
+ *					-2 - buffer, iovec or a non-empty piece pointer is NULL
+ *					-3 - total length of the pieces is zero
+ *					-4 - FIFO buffer current size lower than total length
+ */
+int fifo_spsc_ring_popv(fifo_spsc_ring_TD *ring, const void *buffer, const fifo_iovec_TD *iov, fifo_size_t iov_count)
+{
+	fifo_index_t total = 0;
+
+	if(ring == NULL) return -1; /* ring pointer NULL */
+	if((buffer == NULL) || (iov == NULL)) return -2; /* buffer pointer NULL */
+
+	total = fifo_iov_total(iov, iov_count);
+
+	if(total == FIFO_INDEX_MAX) return -2; /* piece pointer NULL */
+	if(total == 0) return -3; /* zero total length */
+
+	return fifo_spsc_popv_n(ring, buffer, iov, iov_count, total, ring->entry_size);
+}
+
+/**
+ *	@brief Pushes m entries into SPSC ring. Producer side only.
+ *
+ *	@param ring - pointer to the SPSC ring state
+ *	@param buffer - pointer to buffer that stores values
+ *	@param push_buffer - pointer to the buffer from which the values will be pushed
+ *	@param m - amount of entries to be pushed
+ *
+ *	@retval returns:	0 - all of the m entries was pushed
+ *					-1 - ring pointer is NULL
+ *					-2 - buffer or push buffer pointer is NULL
+ *					-3 - amount of the entries to be pushed is zero
+ *					-4 - no place for m element in FIFO buffer
+ */
+int fifo_spsc_ring_push_mul(fifo_spsc_ring_TD *ring, void *buffer, const void *push_buffer, fifo_size_t m)
+{
+	if(ring == NULL) return -1; /* ring pointer NULL */
+	if((buffer == NULL) || (push_buffer == NULL)) return -2; /* buffer pointer NULL */
+	if(m == 0) return -3; /* zero m */
+
+	return fifo_spsc_push_n(ring, buffer, push_buffer, m, ring->entry_size);
+}
+
+/**
+ *	@brief Pushes the entries of a gather list into SPSC ring as one unit, the tail is stored once. Producer side only.
+ *
+ *	@param ring - pointer to the SPSC ring state
+ *	@param buffer - pointer to buffer that stores values
+ *	@param iov - pointer to the list of pieces, lengths in entries
+ *	@param iov_count - amount of pieces in the list
+ *
+ *	@retval returns:	0 - all of the pieces was pushed
+ *					-1 - ring pointer is NULL
+ *					-2 - buffer, iovec or a non-empty piece pointer is NULL
+ *					-3 - total length of the pieces is zero
+ *					-4 - no place for total length in FIFO buffer
+ */
+int fifo_spsc_ring_pushv(fifo_spsc_ring_TD *ring, void *buffer, const fifo_iovec_TD *iov, fifo_size_t iov_count)
+{
+	fifo_index_t total = 0;
+
+	if(ring == NULL) return -1; /* ring pointer NULL */
+	if((buffer == NULL) || (iov == NULL)) return -2; /* buffer pointer NULL */
+
+	total = fifo_iov_total(iov, iov_count);
+
+	if(total == FIFO_INDEX_MAX) return -2; /* piece pointer NULL */
+	if(total == 0) return -3; /* zero total length */
+
+	return fifo_spsc_pushv_n(ring, buffer, iov, iov_count, total, ring->entry_size);
+}
+
+/**
+ *	@brief Pops as many of m entries as SPSC ring holds. Consumer side only.
+ *
+ *	@param ring - pointer to the SPSC ring state
+ *	@param buffer - pointer to buffer that stores values
+ *	@param pop_buffer - pointer to the buffer into which the values will be popped
+ *	@param m - maximal amount of entries to be popped
+ *
+ *	@retval returns: amount of entries popped, 0 if FIFO buffer is empty or any pointer is NULL
+ */
+fifo_size_t fifo_spsc_ring_read_some(fifo_spsc_ring_TD *ring, const void *buffer, void *pop_buffer, fifo_size_t m)
+{
+	if((ring == NULL) || (buffer == NULL) || (pop_buffer == NULL)) return 0; /* pointer NULL */
+
+	return fifo_spsc_read_n(ring, buffer, pop_buffer, m, ring->entry_size);
+}
+
+/**
+ *	@brief Pops up to max entries in one operation with a single head store. Consumer side only.
+ *	Spins re-reading the tail at most spin times while less than min entries are stored, then takes
+ *	whatever arrived: min 1 gives low latency, min close to max gives full batches under load.
+ *
+ *	@param ring - pointer to the SPSC ring state
+ *	@param buffer - pointer to buffer that stores values
+ *	@param pop_buffer - pointer to the buffer into which the values will be popped
+ *	@param min - amount of entries worth returning without spinning, clamped to max and FIFO buffer size
+ *	@param max - maximal amount of entries to be popped
+ *	@param spin - spin budget, 0 - do not spin
+ *
+ *	@retval returns: amount of entries popped, 0 if FIFO buffer is empty or any pointer is NULL
+ */
+fifo_size_t fifo_spsc_ring_drain(fifo_spsc_ring_TD *ring, const void *buffer, void *pop_buffer, fifo_size_t min, fifo_size_t max, uint32_t spin)
+{
+	if((ring == NULL) || (buffer == NULL) || (pop_buffer == NULL)) return 0; /* pointer NULL */
+
+	return fifo_spsc_drain_n(ring, buffer, pop_buffer, min, max, spin, ring->entry_size);
+}
+
+/**
+ *	@brief Pushes as many of m entries as fit into SPSC ring. Producer side only.
+ *
+ *	@param ring - pointer to the SPSC ring state
+ *	@param buffer - pointer to buffer that stores values
+ *	@param push_buffer - pointer to the buffer from which the values will be pushed
+ *	@param m - maximal amount of entries to be pushed
+ *
+ *	@retval returns: amount of entries pushed, 0 if FIFO buffer is full or any pointer is NULL
+ */
+fifo_size_t fifo_spsc_ring_write_some(fifo_spsc_ring_TD *ring, void *buffer, const void *push_buffer, fifo_size_t m)
+{
+	if((ring == NULL) || (buffer == NULL) || (push_buffer == NULL)) return 0; /* pointer NULL */
+
+	return fifo_spsc_write_n(ring, buffer, push_buffer, m, ring->entry_size);
+}
+
+/**
+ *	@brief Gives direct access to n entries at the head of SPSC ring. Consumer side only.
+ *	Entries stay in FIFO buffer until fifo_spsc_ring_release() is called.
+ *
+ *	@param ring - pointer to the SPSC ring state
+ *	@param buffer - pointer to buffer that stores values
+ *	@param n - amount of entries to be peeked
+ *	@param region1 - pointer to the first contiguous span of entries
+ *	@param len1 - amount of entries in the first span
+ *	@param region2 - pointer to the second span after wraparound, NULL if there is no wraparound
+ *	@param len2 - amount of entries in the second span
+ *
+ *	@retval returns:	0 - n entries are available in region1 and region2
+ *					-1 - ring pointer is NULL
+ *					-2 - buffer, region or length pointer is NULL
+ *					-3 - amount of the entries to be peeked is zero
+ *					-4 - FIFO buffer current size lower than n
+ */
+int fifo_spsc_ring_peek(fifo_spsc_ring_TD *ring, void *buffer, fifo_size_t n, void **region1, fifo_size_t *len1, void **region2, fifo_size_t *len2)
+{
+	fifo_index_t head = 0;
+
+	if(ring == NULL) return -1; /* ring pointer NULL */
+	if((buffer == NULL) || (region1 == NULL) || (len1 == NULL) || (region2 == NULL) || (len2 == NULL)) return -2; /* region pointer NULL */
+	if(n == 0) return -3; /* zero n */
+
+	head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+	if(n > fifo_spsc_consumer_count(ring, head, n)) return FIFO_STATS_POP_REJECT(&ring->stats, -4); /* current size lower than n */
+
+	fifo_spsc_spans(ring, buffer, head, n, region1, len1, region2, len2);
+
+	return 0;
+}
+
+/**
+ *	@brief Releases n entries previously accessed with fifo_spsc_ring_peek(). Consumer side only.
+ *
+ *	@param ring - pointer to the SPSC ring state
+ *	@param n - amount of entries to be released
+ *
+ *	@retval returns:	0 - n entries released
+ *					-1 - ring pointer is NULL
+ *					-3 - amount of the entries to be released is zero
+ *					-4 - FIFO buffer current size lower than n
+ */
+int fifo_spsc_ring_release(fifo_spsc_ring_TD *ring, fifo_size_t n)
+{
+	fifo_index_t head = 0;
+
+	if(ring == NULL) return -1; /* ring pointer NULL */
+	if(n == 0) return -3; /* zero n */
+
+	head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+	if(n > fifo_spsc_consumer_count(ring, head, n)) return -4; /* current size lower than n */
+
+	atomic_store_explicit(&ring->head, fifo_spsc_advance(head, n, ring->max_size), memory_order_release);
+	FIFO_STATS_POP(&ring->stats, n, 0);
+
+	return 0;
+}
+
+/**
+ *	@brief Reserves place for n entries at the tail of SPSC ring to be written in place. Producer side only.
+ *	Entries become visible to the consumer after fifo_spsc_ring_commit() is called.
+ *
+ *	@param ring - pointer to the SPSC ring state
+ *	@param buffer - pointer to buffer that stores values
+ *	@param n - amount of entries to be reserved
+ *	@param region1 - pointer to the first contiguous free span
+ *	@param len1 - amount of entries in the first span
+ *	@param region2 - pointer to the second span after wraparound, NULL if there is no wraparound
+ *	@param len2 - amount of entries in the second span
+ *
+ *	@retval returns:	0 - place for n entries is available in region1 and region2
+ *					-1 - ring pointer is NULL
+ *					-2 - buffer, region or length pointer is NULL
+ *					-3 - amount of the entries to be reserved is zero
+ *					-4 - no place for n element in FIFO buffer
+ */
+int fifo_spsc_ring_reserve(fifo_spsc_ring_TD *ring, void *buffer, fifo_size_t n, void **region1, fifo_size_t *len1, void **region2, fifo_size_t *len2)
+{
+	fifo_index_t tail = 0;
+
+	if(ring == NULL) return -1; /* ring pointer NULL */
+	if((buffer == NULL) || (region1 == NULL) || (len1 == NULL) || (region2 == NULL) || (len2 == NULL)) return -2; /* region pointer NULL */
+	if(n == 0) return -3; /* zero n */
+
+	tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+	if(n > fifo_spsc_producer_free(ring, tail, n)) return FIFO_STATS_PUSH_REJECT(&ring->stats, -4); /* no place for n elements in FIFO */
+
+	fifo_spsc_spans(ring, buffer, tail, n, region1, len1, region2, len2);
+
+	return 0;
+}
+
+/**
+ *	@brief Commits n entries written into the span given by fifo_spsc_ring_reserve(). Producer side only.
+ *
+ *	@param ring - pointer to the SPSC ring state
+ *	@param n - amount of entries to be committed
+ *
+ *	@retval returns:	0 - n entries committed
+ *					-1 - ring pointer is NULL
+ *					-3 - amount of the entries to be committed is zero
+ *					-4 - no place for n element in FIFO buffer
+ */
+int fifo_spsc_ring_commit(fifo_spsc_ring_TD *ring, fifo_size_t n)
+{
+	fifo_index_t tail = 0;
+
+	if(ring == NULL) return -1; /* ring pointer NULL */
+	if(n == 0) return -3; /* zero n */
+
+	tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+	if(n > fifo_spsc_producer_free(ring, tail, n)) return -4; /* no place for n elements in FIFO */
+
+	tail = fifo_spsc_advance(tail, n, ring->max_size);
+	atomic_store_explicit(&ring->tail, tail, memory_order_release);
+	FIFO_STATS_PUSH(&ring->stats, n, fifo_spsc_producer_used(ring, tail), 0);
+
+	return 0;
+}
+
+/**
+* 	@brief	Defines fifo_spsc_<name>_* bulk and span functions of typed and common SPSC FIFO buffers, entry_bytes is entry size in Bytes.
+*/
+#define FIFO_SPSC_TEMPLATE_FUNCTIONS(name, type, entry_bytes)										\
+																									\
+int fifo_spsc_##name##_reset(fifo_spsc_##name##_TD *fifo)											\
+{																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+																									\
+	fifo_spsc_reset(&fifo->ring);																	\
+																									\
+	return 0;																						\
+}																									\
+																									\
+int fifo_spsc_##name##_clear(fifo_spsc_##name##_TD *fifo)											\
+{																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+																									\
+	fifo_wipe(fifo->buffer, ((size_t)fifo->ring.max_size * fifo->ring.entry_size));					\
+	fifo_spsc_reset(&fifo->ring);																	\
+																									\
+	return 0;																						\
+}																									\
+																									\
+int fifo_spsc_##name##_pop_mul(fifo_spsc_##name##_TD *fifo, type *pop_buffer, fifo_size_t m)		\
+{																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(pop_buffer == NULL) return -2; /* pop buffer pointer NULL */									\
+	if(m == 0) return -3; /* zero m */																\
+																									\
+	return fifo_spsc_pop_n(&fifo->ring, (const uint8_t *)fifo->buffer, (uint8_t *)pop_buffer, m, (entry_bytes)); \
+}																									\
+																									\
+fifo_size_t fifo_spsc_##name##_read_some(fifo_spsc_##name##_TD *fifo, type *pop_buffer, fifo_size_t m) \
+{																									\
+	if((fifo == NULL) || (pop_buffer == NULL)) return 0; /* pointer NULL */							\
+																									\
+	return fifo_spsc_read_n(&fifo->ring, (const uint8_t *)fifo->buffer, (uint8_t *)pop_buffer, m, (entry_bytes)); \
+}																									\
+																									\
+fifo_size_t fifo_spsc_##name##_drain(fifo_spsc_##name##_TD *fifo, type *pop_buffer, fifo_size_t min, fifo_size_t max, uint32_t spin) \
+{																									\
+	if((fifo == NULL) || (pop_buffer == NULL)) return 0; /* pointer NULL */							\
+																									\
+	return fifo_spsc_drain_n(&fifo->ring, (const uint8_t *)fifo->buffer, (uint8_t *)pop_buffer, min, max, spin, (entry_bytes)); \
+}																									\
+																									\
+int fifo_spsc_##name##_popv(fifo_spsc_##name##_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count) \
+{																									\
+	fifo_index_t total = 0;																			\
+																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(iov == NULL) return -2; /* iovec pointer NULL */												\
+																									\
+	total = fifo_iov_total(iov, iov_count);															\
+																									\
+	if(total == FIFO_INDEX_MAX) return -2; /* piece pointer NULL */									\
+	if(total == 0) return -3; /* zero total length */												\
+																									\
+	return fifo_spsc_popv_n(&fifo->ring, (const uint8_t *)fifo->buffer, iov, iov_count, total, (entry_bytes)); \
+}																									\
+																									\
+int fifo_spsc_##name##_peek(fifo_spsc_##name##_TD *fifo, fifo_size_t n, type **region1, fifo_size_t *len1, type **region2, fifo_size_t *len2) \
+{																									\
+	void *span1 = NULL;																				\
+	void *span2 = NULL;																				\
+	int ret = 0;																					\
+																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if((region1 == NULL) || (region2 == NULL)) return -2; /* region pointer NULL */					\
+																									\
+	ret = fifo_spsc_ring_peek(&fifo->ring, fifo->buffer, n, &span1, len1, &span2, len2);			\
+	if(ret != 0) return ret;																		\
+																									\
+	*region1 = span1;																				\
+	*region2 = span2;																				\
+																									\
+	return 0;																						\
+}																									\
+																									\
+int fifo_spsc_##name##_release(fifo_spsc_##name##_TD *fifo, fifo_size_t n)							\
+{																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+																									\
+	return fifo_spsc_ring_release(&fifo->ring, n);													\
+}																									\
+																									\
+int fifo_spsc_##name##_push_mul(fifo_spsc_##name##_TD *fifo, type *push_buffer, fifo_size_t m)		\
+{																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(push_buffer == NULL) return -2; /* push buffer pointer NULL */								\
+	if(m == 0) return -3; /* zero m */																\
+																									\
+	return fifo_spsc_push_n(&fifo->ring, (uint8_t *)fifo->buffer, (const uint8_t *)push_buffer, m, (entry_bytes)); \
+}																									\
+																									\
+int fifo_spsc_##name##_pushv(fifo_spsc_##name##_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count) \
+{																									\
+	fifo_index_t total = 0;																			\
+																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(iov == NULL) return -2; /* iovec pointer NULL */												\
+																									\
+	total = fifo_iov_total(iov, iov_count);															\
+																									\
+	if(total == FIFO_INDEX_MAX) return -2; /* piece pointer NULL */									\
+	if(total == 0) return -3; /* zero total length */												\
+																									\
+	return fifo_spsc_pushv_n(&fifo->ring, (uint8_t *)fifo->buffer, iov, iov_count, total, (entry_bytes)); \
+}																									\
+																									\
+fifo_size_t fifo_spsc_##name##_write_some(fifo_spsc_##name##_TD *fifo, type *push_buffer, fifo_size_t m) \
+{																									\
+	if((fifo == NULL) || (push_buffer == NULL)) return 0; /* pointer NULL */						\
+																									\
+	return fifo_spsc_write_n(&fifo->ring, (uint8_t *)fifo->buffer, (const uint8_t *)push_buffer, m, (entry_bytes)); \
+}																									\
+																									\
+int fifo_spsc_##name##_reserve(fifo_spsc_##name##_TD *fifo, fifo_size_t n, type **region1, fifo_size_t *len1, type **region2, fifo_size_t *len2) \
+{																									\
+	void *span1 = NULL;																				\
+	void *span2 = NULL;																				\
+	int ret = 0;																					\
+																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if((region1 == NULL) || (region2 == NULL)) return -2; /* region pointer NULL */					\
+																									\
+	ret = fifo_spsc_ring_reserve(&fifo->ring, fifo->buffer, n, &span1, len1, &span2, len2);			\
+	if(ret != 0) return ret;																		\
+																									\
+	*region1 = span1;																				\
+	*region2 = span2;																				\
+																									\
+	return 0;																						\
+}																									\
+																									\
+int fifo_spsc_##name##_commit(fifo_spsc_##name##_TD *fifo, fifo_size_t n)							\
+{																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+																									\
+	return fifo_spsc_ring_commit(&fifo->ring, n);													\
+}
+
+/**
+* 	@brief	Defines fifo_spsc_<name>_pop, fifo_spsc_<name>_push and fifo_spsc_<name>_init of typed SPSC FIFO buffer storing entries of type.
+*/
+#define FIFO_SPSC_TEMPLATE_VALUE_FUNCTIONS(name, type)												\
+																									\
+int fifo_spsc_##name##_pop(fifo_spsc_##name##_TD *fifo, type *val)									\
+{																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(val == NULL) return -2;  /* val pointer NULL */												\
+	if(fifo_spsc_pop_n(&fifo->ring, (const uint8_t *)fifo->buffer, (uint8_t *)val, 1, sizeof(type)) != 0) return -3; /* fifo empty */ \
+																									\
+	return 0;																						\
+}																									\
+																									\
+int fifo_spsc_##name##_push(fifo_spsc_##name##_TD *fifo, type val)									\
+{																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(fifo_spsc_push_n(&fifo->ring, (uint8_t *)fifo->buffer, (const uint8_t *)&val, 1, sizeof(type)) != 0) return -2; /* fifo full */ \
+																									\
+	return 0;																						\
+}																									\
+																									\
+int fifo_spsc_##name##_init(fifo_spsc_##name##_TD *fifo, type *buffer, fifo_size_t size, bool clear_flag) \
+{																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(buffer == NULL) return -2; /* buffer pointer NULL */											\
+	if(fifo_spsc_ring_init(&fifo->ring, size, sizeof(type)) != 0) return -3; /* zero or too large size */ \
+																									\
+	fifo->buffer = buffer;																			\
+																									\
+	if(clear_flag == true) fifo_wipe(buffer, ((size_t)size * sizeof(type)));						\
+																									\
+	return 0;																						\
+}
+
+/**
+* 	@}
+*/
+
+/**
+*	@addtogroup uint8_t_SPSC_FIFO_buffer uint8_t SPSC FIFO buffer
+* 	@{
+*/
+
+FIFO_SPSC_TEMPLATE_FUNCTIONS(uint8, uint8_t, sizeof(uint8_t))
+FIFO_SPSC_TEMPLATE_VALUE_FUNCTIONS(uint8, uint8_t)
+
+/**
+ *	@brief Pops m uint8_t entries from SPSC FIFO buffer and widens them to uint16_t while copying. Consumer side only.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param pop_buffer - pointer to the uint16_t buffer into which the values will be popped
+ *	@param m - amount of entries to be popped
+ *
+ *	@retval returns:	0 - all of the m entries was popped
+ *					-1 - fifo pointer is NULL
+ *					-2 - pop buffer pointer is NULL
+ *					-3 - amount of the entries to be popped is zero
+ *					-4 - FIFO buffer current size lower than m
+ */
+int fifo_spsc_uint8_pop_mul_convert_u16(fifo_spsc_uint8_TD *fifo, uint16_t *pop_buffer, fifo_size_t m)
+{
+	uint64_t start = FIFO_STATS_START();
+	fifo_index_t head = 0;
+	fifo_index_t pos = 0;
+	fifo_index_t first = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(pop_buffer == NULL) return -2; /* pop buffer pointer NULL */
+	if(m == 0) return -3; /* zero m */
+
+	head = atomic_load_explicit(&fifo->ring.head, memory_order_relaxed);
+
+	if(m > fifo_spsc_consumer_count(&fifo->ring, head, m)) return FIFO_STATS_POP_REJECT(&fifo->ring.stats, -4); /* current size lower than m */
+
+	pos = fifo_spsc_position(head, fifo->ring.max_size);
+	first = fifo->ring.max_size - pos;
+
+	if(m <= first)
+	{
+		fifo_simd_u8_to_u16(pop_buffer, &fifo->buffer[pos], m);
+	}
+	else
+	{
+		fifo_simd_u8_to_u16(pop_buffer, &fifo->buffer[pos], first);
+		fifo_simd_u8_to_u16(pop_buffer + first, fifo->buffer, (m - first));
+	}
+
+	atomic_store_explicit(&fifo->ring.head, fifo_spsc_advance(head, m, fifo->ring.max_size), memory_order_release);
+	FIFO_STATS_POP(&fifo->ring.stats, m, start);
+
+	return 0;
+}
+
+/**
+* 	@}
+*/
+
+/**
+*	@addtogroup uint16_t_SPSC_FIFO_buffer uint16_t SPSC FIFO buffer
+* 	@{
+*/
+
+FIFO_SPSC_TEMPLATE_FUNCTIONS(uint16, uint16_t, sizeof(uint16_t))
+FIFO_SPSC_TEMPLATE_VALUE_FUNCTIONS(uint16, uint16_t)
+
+/**
+ *	@brief Pops m uint16_t entries from SPSC FIFO buffer and widens them to int32_t while copying. Consumer side only.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param pop_buffer - pointer to the int32_t buffer into which the values will be popped
+ *	@param m - amount of entries to be popped
+ *
+ *	@retval returns:	0 - all of the m entries was popped
+ *					-1 - fifo pointer is NULL
+ *					-2 - pop buffer pointer is NULL
+ *					-3 - amount of the entries to be popped is zero
+ *					-4 - FIFO buffer current size lower than m
+ */
+int fifo_spsc_uint16_pop_mul_convert_i32(fifo_spsc_uint16_TD *fifo, int32_t *pop_buffer, fifo_size_t m)
+{
+	uint64_t start = FIFO_STATS_START();
+	fifo_index_t head = 0;
+	fifo_index_t pos = 0;
+	fifo_index_t first = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(pop_buffer == NULL) return -2; /* pop buffer pointer NULL */
+	if(m == 0) return -3; /* zero m */
+
+	head = atomic_load_explicit(&fifo->ring.head, memory_order_relaxed);
+
+	if(m > fifo_spsc_consumer_count(&fifo->ring, head, m)) return FIFO_STATS_POP_REJECT(&fifo->ring.stats, -4); /* current size lower than m */
+
+	pos = fifo_spsc_position(head, fifo->ring.max_size);
+	first = fifo->ring.max_size - pos;
+
+	if(m <= first)
+	{
+		fifo_simd_u16_to_i32(pop_buffer, &fifo->buffer[pos], m);
+	}
+	else
+	{
+		fifo_simd_u16_to_i32(pop_buffer, &fifo->buffer[pos], first);
+		fifo_simd_u16_to_i32(pop_buffer + first, fifo->buffer, (m - first));
+	}
+
+	atomic_store_explicit(&fifo->ring.head, fifo_spsc_advance(head, m, fifo->ring.max_size), memory_order_release);
+	FIFO_STATS_POP(&fifo->ring.stats, m, start);
+
+	return 0;
+}
+
+/**
+ *	@brief Pops m uint16_t entries from SPSC FIFO buffer and converts them to float while copying. Consumer side only.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param pop_buffer - pointer to the float buffer into which the values will be popped
+ *	@param m - amount of entries to be popped
+ *
+ *	@retval returns:	0 - all of the m entries was popped
+ *					-1 - fifo pointer is NULL
+ *					-2 - pop buffer pointer is NULL
+ *					-3 - amount of the entries to be popped is zero
+ *					-4 - FIFO buffer current size lower than m
+ */
+int fifo_spsc_uint16_pop_mul_convert_f32(fifo_spsc_uint16_TD *fifo, float *pop_buffer, fifo_size_t m)
+{
+	uint64_t start = FIFO_STATS_START();
+	fifo_index_t head = 0;
+	fifo_index_t pos = 0;
+	fifo_index_t first = 0;
+
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(pop_buffer == NULL) return -2; /* pop buffer pointer NULL */
+	if(m == 0) return -3; /* zero m */
+
+	head = atomic_load_explicit(&fifo->ring.head, memory_order_relaxed);
+
+	if(m > fifo_spsc_consumer_count(&fifo->ring, head, m)) return FIFO_STATS_POP_REJECT(&fifo->ring.stats, -4); /* current size lower than m */
+
+	pos = fifo_spsc_position(head, fifo->ring.max_size);
+	first = fifo->ring.max_size - pos;
+
+	if(m <= first)
+	{
+		fifo_simd_u16_to_f32(pop_buffer, &fifo->buffer[pos], m);
+	}
+	else
+	{
+		fifo_simd_u16_to_f32(pop_buffer, &fifo->buffer[pos], first);
+		fifo_simd_u16_to_f32(pop_buffer + first, fifo->buffer, (m - first));
+	}
+
+	atomic_store_explicit(&fifo->ring.head, fifo_spsc_advance(head, m, fifo->ring.max_size), memory_order_release);
+	FIFO_STATS_POP(&fifo->ring.stats, m, start);
+
+	return 0;
+}
+
+/**
+* 	@}
+*/
+
+/**
+*	@addtogroup uint32_t_SPSC_FIFO_buffer uint32_t SPSC FIFO buffer
+* 	@{
+*/
+
+FIFO_SPSC_TEMPLATE_FUNCTIONS(uint32, uint32_t, sizeof(uint32_t))
+FIFO_SPSC_TEMPLATE_VALUE_FUNCTIONS(uint32, uint32_t)
+
+/**
+* 	@}
+*/
+
+/**
+*	@addtogroup common_SPSC_FIFO_buffer common SPSC FIFO buffer
+* 	@{
+*/
+
+FIFO_SPSC_TEMPLATE_FUNCTIONS(common, void, fifo->ring.entry_size)
+
+/**
+ *	@brief Pops value from common SPSC FIFO buffer. Consumer side only.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param val_buffer - pointer to value store buffer
+ *
+ *	@retval returns: 0 - head popped successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - value buffer pointer is NULL
+ *					-3 - FIFO buffer empty
+ */
+int fifo_spsc_common_pop(fifo_spsc_common_TD *fifo, void *val_buffer)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
+	if(fifo_spsc_pop_n(&fifo->ring, (const uint8_t *)fifo->buffer, (uint8_t *)val_buffer, 1, fifo->ring.entry_size) != 0) return -3; /* fifo empty */
+
+	return 0;
+}
+
+/**
+ *	@brief Pushes value into common SPSC FIFO buffer. Producer side only.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param val_buffer - value buffer to push
+ *
+ *	@retval returns: 0 - tail pushed successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - value buffer pointer is NULL
+ *					-3 - FIFO buffer full
+ */
+int fifo_spsc_common_push(fifo_spsc_common_TD *fifo, void *val_buffer)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(val_buffer == NULL) return -2; /* value buffer pointer NULL */
+	if(fifo_spsc_push_n(&fifo->ring, (uint8_t *)fifo->buffer, (const uint8_t *)val_buffer, 1, fifo->ring.entry_size) != 0) return -3; /* fifo FULL */
+
+	return 0;
+}
+
+/**
+ *	@brief Creates common SPSC FIFO buffer.
+ *
+ *	@param fifo - pointer to the FIFO buffer
+ *	@param buffer - pointer to buffer that stores values
+ *	@param size - size of FIFO buffer
+ *	@param entry_size - size of an entry of common FIFO buffer
+ *	@param clear_flag - specifies whether the buffer need to be cleared, see FIFO_WIPE_MODE
+ *
+ *	@retval returns: 0 - common SPSC FIFO buffer created successfully
+ *					-1 - fifo pointer is NULL
+ *					-2 - buffer pointer is NULL
+ *					-3 - size of FIFO buffer is 0 or larger than FIFO_SPSC_MAX_SIZE
+ *					-4 - size of entry is 0
+ */
+int fifo_spsc_common_init(fifo_spsc_common_TD *fifo, void *buffer, fifo_size_t size, uint16_t entry_size, bool clear_flag)
+{
+	if(fifo == NULL) return -1; /* fifo pointer NULL */
+	if(buffer == NULL) return -2; /* buffer pointer NULL */
+	if(entry_size == 0) return -4; /* zero entry size */
+	if(fifo_spsc_ring_init(&fifo->ring, size, entry_size) != 0) return -3; /* zero or too large size */
+
+	fifo->buffer = buffer;
+
+	if(clear_flag == true) fifo_wipe(buffer, ((size_t)size * entry_size));
+
+	return 0;
+}
+
+/**
+* 	@}
+*/
+
+/**
+* 	@}
+*/
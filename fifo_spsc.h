@@ -0,0 +1,162 @@
+/**
+ * 	@file fifo_spsc.h
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Lock-free single-producer/single-consumer FIFO buffers.
+ *  The producer writes only the tail index and the consumer writes only the head index,
+ *  so one push side and one pop side may run concurrently (different cores, ISR vs. thread)
+ *  without critical sections. Requires C11 atomics.
+ *
+ *  The uint8_t, uint16_t, uint32_t and common buffers wrap the fifo_spsc_ring_* functions, their
+ *  fifo_spsc_<name>_* functions are generated by FIFO_SPSC_TEMPLATE_* macros and return:
+ *  	reset, clear: 0 or -1 (fifo pointer NULL)
+ *  	pop_mul, push_mul, popv, pushv, peek, reserve, release, commit: 0, -1 (fifo pointer NULL),
+ *  		-2 (buffer, iovec, piece or region pointer NULL), -3 (zero amount), -4 (not enough entries or place)
+ *  	read_some, write_some, drain: amount of entries moved, 0 if a pointer is NULL
+ *  	pop: 0, -1, -2 (val pointer NULL), -3 (empty); push: 0, -1, -2 (full for typed, value buffer NULL for common), -3 (full for common)
+ *  	init: 0, -1, -2 (buffer pointer NULL), -3 (size 0 or larger than FIFO_SPSC_MAX_SIZE), -4 (entry size 0, common only)
+ *  Push functions from the producer context only, pop, peek, release, read_some and drain from the consumer context only.
+ */
+
+#ifndef FIFO_SPSC_H_
+#define FIFO_SPSC_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "fifo_config.h"
+#include "fifo_stats.h"
+
+/**
+* 	@brief	Largest size of SPSC FIFO buffer, head/tail indices must hold 2 * size.
+*/
+#if (FIFO_SIZE_BITS == 16)
+#define FIFO_SPSC_MAX_SIZE		FIFO_SIZE_MAX
+#else
+#define FIFO_SPSC_MAX_SIZE		(FIFO_INDEX_MAX / 2)
+#endif
+
+/**
+* 	@brief	SPSC ring state shared by all of the SPSC FIFO buffer types.
+*
+* 	Indices run in range [0, 2 * max_size) so a full ring can be told apart from an empty one
+* 	without a shared fill counter. Each side keeps a private copy of the other side index and
+* 	re-reads the shared one only when the copy shows not enough entries or free place.
+* 	With FIFO_SPSC_CACHE_ALIGNED the read-only, producer and consumer fields are on separate cache lines.
+*/
+typedef struct
+{
+	uint16_t entry_size;						/**< Size of SPSC FIFO buffer entry in Bytes */
+	fifo_size_t max_size;							/**< Size of SPSC FIFO buffer */
+
+	FIFO_SPSC_ALIGN _Atomic fifo_index_t tail;		/**< Write index, written by the producer only */
+	fifo_index_t head_cache;						/**< Producer copy of head index */
+
+	FIFO_SPSC_ALIGN _Atomic fifo_index_t head;		/**< Read index, written by the consumer only */
+	fifo_index_t tail_cache;						/**< Consumer copy of tail index */
+
+	FIFO_STATS_FIELD								/**< Statistics of SPSC FIFO buffer, only with FIFO_STATS */
+
+}fifo_spsc_ring_TD;
+
+/**
+* 	@brief	Declares SPSC FIFO buffer type fifo_spsc_<name>_TD that stores entries of type.
+*/
+#define FIFO_SPSC_TEMPLATE_TYPE(name, type)															\
+typedef struct																						\
+{																									\
+	type *buffer;			/**< Pointer to buffer that stores values */							\
+	fifo_spsc_ring_TD ring;	/**< Head/tail indices of SPSC FIFO buffer */							\
+																									\
+}fifo_spsc_##name##_TD;
+
+/**
+* 	@brief	Declares prototypes of fifo_spsc_<name>_* bulk and span functions of typed and common SPSC FIFO buffers.
+*/
+#define FIFO_SPSC_TEMPLATE_PROTOTYPES(name, type)													\
+int fifo_spsc_##name##_reset(fifo_spsc_##name##_TD *fifo);											\
+int fifo_spsc_##name##_clear(fifo_spsc_##name##_TD *fifo);											\
+int fifo_spsc_##name##_pop_mul(fifo_spsc_##name##_TD *fifo, type *pop_buffer, fifo_size_t m);		\
+fifo_size_t fifo_spsc_##name##_read_some(fifo_spsc_##name##_TD *fifo, type *pop_buffer, fifo_size_t m); \
+fifo_size_t fifo_spsc_##name##_drain(fifo_spsc_##name##_TD *fifo, type *pop_buffer, fifo_size_t min, fifo_size_t max, uint32_t spin); \
+int fifo_spsc_##name##_popv(fifo_spsc_##name##_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count); \
+int fifo_spsc_##name##_peek(fifo_spsc_##name##_TD *fifo, fifo_size_t n, type **region1, fifo_size_t *len1, type **region2, fifo_size_t *len2); \
+int fifo_spsc_##name##_release(fifo_spsc_##name##_TD *fifo, fifo_size_t n);							\
+int fifo_spsc_##name##_push_mul(fifo_spsc_##name##_TD *fifo, type *push_buffer, fifo_size_t m);		\
+int fifo_spsc_##name##_pushv(fifo_spsc_##name##_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count); \
+fifo_size_t fifo_spsc_##name##_write_some(fifo_spsc_##name##_TD *fifo, type *push_buffer, fifo_size_t m); \
+int fifo_spsc_##name##_reserve(fifo_spsc_##name##_TD *fifo, fifo_size_t n, type **region1, fifo_size_t *len1, type **region2, fifo_size_t *len2); \
+int fifo_spsc_##name##_commit(fifo_spsc_##name##_TD *fifo, fifo_size_t n);
+
+/**
+* 	@brief	Declares prototypes of fifo_spsc_<name>_pop, fifo_spsc_<name>_push and fifo_spsc_<name>_init of typed SPSC FIFO buffer.
+*/
+#define FIFO_SPSC_TEMPLATE_VALUE_PROTOTYPES(name, type)												\
+int fifo_spsc_##name##_pop(fifo_spsc_##name##_TD *fifo, type *val);									\
+int fifo_spsc_##name##_push(fifo_spsc_##name##_TD *fifo, type val);									\
+int fifo_spsc_##name##_init(fifo_spsc_##name##_TD *fifo, type *buffer, fifo_size_t size, bool clear_flag);
+
+/**
+* 	@brief  uint8_t SPSC FIFO buffer type. Used for store uint8_t entries.
+*/
+FIFO_SPSC_TEMPLATE_TYPE(uint8, uint8_t)
+
+/**
+* 	@brief  uint16_t SPSC FIFO buffer type. Used for store uint16_t entries.
+*/
+FIFO_SPSC_TEMPLATE_TYPE(uint16, uint16_t)
+
+/**
+* 	@brief  uint32_t SPSC FIFO buffer type. Used for store uint32_t entries.
+*/
+FIFO_SPSC_TEMPLATE_TYPE(uint32, uint32_t)
+
+/**
+* 	@brief  common SPSC FIFO buffer type. Used for store entries with user defined size.
+*/
+typedef struct
+{
+	void *buffer;			/**< Pointer to buffer that stores values */
+	fifo_spsc_ring_TD ring;	/**< Head/tail indices and entry size of common SPSC FIFO buffer */
+
+}fifo_spsc_common_TD;
+
+int fifo_spsc_ring_init(fifo_spsc_ring_TD *ring, fifo_size_t size, uint16_t entry_size);
+fifo_size_t fifo_spsc_ring_count(fifo_spsc_ring_TD *ring);
+fifo_index_t fifo_spsc_ring_distance(fifo_index_t from, fifo_index_t to, fifo_size_t max_size);
+bool fifo_spsc_ring_indices_valid(fifo_index_t head, fifo_index_t tail, fifo_size_t max_size);
+int fifo_spsc_ring_peek(fifo_spsc_ring_TD *ring, void *buffer, fifo_size_t n, void **region1, fifo_size_t *len1, void **region2, fifo_size_t *len2);
+int fifo_spsc_ring_release(fifo_spsc_ring_TD *ring, fifo_size_t n);
+int fifo_spsc_ring_reserve(fifo_spsc_ring_TD *ring, void *buffer, fifo_size_t n, void **region1, fifo_size_t *len1, void **region2, fifo_size_t *len2);
+int fifo_spsc_ring_commit(fifo_spsc_ring_TD *ring, fifo_size_t n);
+fifo_size_t fifo_spsc_ring_read_some(fifo_spsc_ring_TD *ring, const void *buffer, void *pop_buffer, fifo_size_t m);
+fifo_size_t fifo_spsc_ring_drain(fifo_spsc_ring_TD *ring, const void *buffer, void *pop_buffer, fifo_size_t min, fifo_size_t max, uint32_t spin);
+fifo_size_t fifo_spsc_ring_write_some(fifo_spsc_ring_TD *ring, void *buffer, const void *push_buffer, fifo_size_t m);
+int fifo_spsc_ring_pop_mul(fifo_spsc_ring_TD *ring, const void *buffer, void *pop_buffer, fifo_size_t m);
+int fifo_spsc_ring_popv(fifo_spsc_ring_TD *ring, const void *buffer, const fifo_iovec_TD *iov, fifo_size_t iov_count);
+int fifo_spsc_ring_push_mul(fifo_spsc_ring_TD *ring, void *buffer, const void *push_buffer, fifo_size_t m);
+int fifo_spsc_ring_pushv(fifo_spsc_ring_TD *ring, void *buffer, const fifo_iovec_TD *iov, fifo_size_t iov_count);
+
+FIFO_SPSC_TEMPLATE_PROTOTYPES(uint8, uint8_t)
+FIFO_SPSC_TEMPLATE_VALUE_PROTOTYPES(uint8, uint8_t)
+int fifo_spsc_uint8_pop_mul_convert_u16(fifo_spsc_uint8_TD *fifo, uint16_t *pop_buffer, fifo_size_t m);
+
+FIFO_SPSC_TEMPLATE_PROTOTYPES(uint16, uint16_t)
+FIFO_SPSC_TEMPLATE_VALUE_PROTOTYPES(uint16, uint16_t)
+int fifo_spsc_uint16_pop_mul_convert_i32(fifo_spsc_uint16_TD *fifo, int32_t *pop_buffer, fifo_size_t m);
+int fifo_spsc_uint16_pop_mul_convert_f32(fifo_spsc_uint16_TD *fifo, float *pop_buffer, fifo_size_t m);
+
+FIFO_SPSC_TEMPLATE_PROTOTYPES(uint32, uint32_t)
+FIFO_SPSC_TEMPLATE_VALUE_PROTOTYPES(uint32, uint32_t)
+
+FIFO_SPSC_TEMPLATE_PROTOTYPES(common, void)
+int fifo_spsc_common_pop(fifo_spsc_common_TD *fifo, void *val_buffer);
+int fifo_spsc_common_push(fifo_spsc_common_TD *fifo, void *val_buffer);
+int fifo_spsc_common_init(fifo_spsc_common_TD *fifo, void *buffer, fifo_size_t size, uint16_t entry_size, bool clear_flag);
+
+#endif /* FIFO_SPSC_H_ */
@@ -0,0 +1,228 @@
+/**
+ * 	@file fifo_stats.h
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Opt-in statistics of FIFO buffers, enabled with FIFO_STATS.
+ *  Template (fifo_uint8/16/32, FIFO_DEFINE), common and SPSC FIFO buffers then carry a fifo_stats_TD
+ *  member named stats (ring.stats for SPSC) that counts pushed/popped entries, full/empty rejections
+ *  (-2/-3/-4 returns of push/pop/reserve/peek functions), high-water occupancy and, with
+ *  FIFO_STATS_TIMING, cycles spent in push/pop functions.
+ *
+ *  Producer counters and consumer counters sit on separate cache lines and each is written
+ *  by its own side only, with relaxed atomic stores and no read-modify-write, so counting adds
+ *  no sharing and no locked instructions. fifo_stats_snapshot() may run from any context
+ *  while traffic flows, each counter is read atomically.
+ *
+ *  With FIFO_STATS == 0 (default) the member and every hook compile to nothing.
+ */
+
+#ifndef FIFO_STATS_H_
+#define FIFO_STATS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "fifo_config.h"
+
+/**
+* 	@brief	Snapshot of FIFO buffer statistics.
+*/
+typedef struct
+{
+	uint64_t pushed;			/**< Entries pushed or committed */
+	uint64_t push_rejects;		/**< Push/reserve calls rejected because of lack of place */
+	uint64_t push_cycles;		/**< Cycles spent in push functions, 0 without FIFO_STATS_TIMING */
+	fifo_size_t high_water;		/**< Highest occupancy seen by the producer */
+
+	uint64_t popped;			/**< Entries popped or released */
+	uint64_t pop_rejects;		/**< Pop/peek calls rejected because of lack of entries */
+	uint64_t pop_cycles;		/**< Cycles spent in pop functions, 0 without FIFO_STATS_TIMING */
+
+}fifo_stats_snapshot_TD;
+
+#if (FIFO_STATS == 1)
+
+#include <stdatomic.h>
+
+#if (FIFO_STATS_TIMING == 1) && !defined(FIFO_STATS_CYCLES)
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define FIFO_STATS_CYCLES()		((uint64_t)__rdtsc())
+#elif defined(__aarch64__)
+static inline uint64_t fifo_stats_cntvct(void)
+{
+	uint64_t cycles = 0;
+
+	__asm__ volatile("mrs %0, cntvct_el0" : "=r"(cycles));
+
+	return cycles;
+}
+#define FIFO_STATS_CYCLES()		fifo_stats_cntvct()
+#else
+#error "FIFO_STATS_TIMING needs FIFO_STATS_CYCLES() defined for this target, e.g. to DWT->CYCCNT"
+#endif
+#endif
+
+/**
+* 	@brief	Counter type of FIFO buffer statistics.
+*/
+typedef uint64_t fifo_stats_count_t;
+
+/**
+* 	@brief	Statistics block of FIFO buffer, producer and consumer counters on separate cache lines.
+*/
+typedef struct
+{
+	_Alignas(FIFO_CACHE_LINE_SIZE) _Atomic fifo_stats_count_t pushed;	/**< Entries pushed, producer side */
+	_Atomic fifo_stats_count_t push_rejects;							/**< Rejected push calls, producer side */
+	_Atomic fifo_stats_count_t push_cycles;								/**< Cycles in push functions, producer side */
+	_Atomic fifo_size_t high_water;										/**< Highest occupancy, producer side */
+
+	_Alignas(FIFO_CACHE_LINE_SIZE) _Atomic fifo_stats_count_t popped;	/**< Entries popped, consumer side */
+	_Atomic fifo_stats_count_t pop_rejects;								/**< Rejected pop calls, consumer side */
+	_Atomic fifo_stats_count_t pop_cycles;								/**< Cycles in pop functions, consumer side */
+
+}fifo_stats_TD;
+
+/**
+ *	@brief Reads cycle counter when FIFO_STATS_TIMING is enabled, returns 0 otherwise.
+ */
+static inline uint64_t fifo_stats_cycles(void)
+{
+#if (FIFO_STATS_TIMING == 1)
+	return FIFO_STATS_CYCLES();
+#else
+	return 0;
+#endif
+}
+
+/**
+ *	@brief Adds n to a counter written by one side only, plain load and store without read-modify-write.
+ */
+static inline void fifo_stats_add(_Atomic fifo_stats_count_t *counter, fifo_stats_count_t n)
+{
+	atomic_store_explicit(counter, (atomic_load_explicit(counter, memory_order_relaxed) + n), memory_order_relaxed);
+}
+
+/**
+ *	@brief Counts n pushed entries and occupancy used after the push. Producer side only.
+ */
+static inline void fifo_stats_on_push(fifo_stats_TD *stats, fifo_size_t n, fifo_size_t used, uint64_t start)
+{
+	fifo_stats_add(&stats->pushed, n);
+	if(used > atomic_load_explicit(&stats->high_water, memory_order_relaxed)) atomic_store_explicit(&stats->high_water, used, memory_order_relaxed);
+#if (FIFO_STATS_TIMING == 1)
+	if(start != 0) fifo_stats_add(&stats->push_cycles, (fifo_stats_cycles() - start));
+#else
+	(void)start;
+#endif
+}
+
+/**
+ *	@brief Counts rejected push call. Producer side only.
+ */
+static inline void fifo_stats_on_push_reject(fifo_stats_TD *stats)
+{
+	fifo_stats_add(&stats->push_rejects, 1);
+}
+
+/**
+ *	@brief Counts n popped entries. Consumer side only.
+ */
+static inline void fifo_stats_on_pop(fifo_stats_TD *stats, fifo_size_t n, uint64_t start)
+{
+	fifo_stats_add(&stats->popped, n);
+#if (FIFO_STATS_TIMING == 1)
+	if(start != 0) fifo_stats_add(&stats->pop_cycles, (fifo_stats_cycles() - start));
+#else
+	(void)start;
+#endif
+}
+
+/**
+ *	@brief Counts rejected pop call. Consumer side only.
+ */
+static inline void fifo_stats_on_pop_reject(fifo_stats_TD *stats)
+{
+	fifo_stats_add(&stats->pop_rejects, 1);
+}
+
+/**
+ *	@brief Zeroes statistics. Must not run concurrently with push/pop.
+ *
+ *	@param stats - pointer to the statistics block, e.g. &fifo->stats
+ *
+ *	@retval returns: 0 - statistics zeroed successfully
+ *					-1 - stats pointer is NULL
+ */
+static inline int fifo_stats_reset(fifo_stats_TD *stats)
+{
+	if(stats == NULL) return -1; /* stats pointer NULL */
+
+	atomic_init(&stats->pushed, 0);
+	atomic_init(&stats->push_rejects, 0);
+	atomic_init(&stats->push_cycles, 0);
+	atomic_init(&stats->high_water, 0);
+	atomic_init(&stats->popped, 0);
+	atomic_init(&stats->pop_rejects, 0);
+	atomic_init(&stats->pop_cycles, 0);
+
+	return 0;
+}
+
+/**
+ *	@brief Takes snapshot of statistics without stopping push/pop, every counter is read atomically.
+ *
+ *	@param stats - pointer to the statistics block, e.g. &fifo->stats
+ *	@param snapshot - pointer to the snapshot to fill
+ *
+ *	@retval returns: 0 - snapshot taken successfully
+ *					-1 - stats pointer is NULL
+ *					-2 - snapshot pointer is NULL
+ */
+static inline int fifo_stats_snapshot(fifo_stats_TD *stats, fifo_stats_snapshot_TD *snapshot)
+{
+	if(stats == NULL) return -1; /* stats pointer NULL */
+	if(snapshot == NULL) return -2; /* snapshot pointer NULL */
+
+	snapshot->pushed = atomic_load_explicit(&stats->pushed, memory_order_relaxed);
+	snapshot->push_rejects = atomic_load_explicit(&stats->push_rejects, memory_order_relaxed);
+	snapshot->push_cycles = atomic_load_explicit(&stats->push_cycles, memory_order_relaxed);
+	snapshot->high_water = atomic_load_explicit(&stats->high_water, memory_order_relaxed);
+	snapshot->popped = atomic_load_explicit(&stats->popped, memory_order_relaxed);
+	snapshot->pop_rejects = atomic_load_explicit(&stats->pop_rejects, memory_order_relaxed);
+	snapshot->pop_cycles = atomic_load_explicit(&stats->pop_cycles, memory_order_relaxed);
+
+	return 0;
+}
+
+#endif
+
+/**
+* 	@brief	Hooks used by FIFO buffer functions, every one compiles to nothing without FIFO_STATS.
+*
+* 	FIFO_STATS_START() reads the cycle counter at function entry, FIFO_STATS_PUSH/POP count
+* 	n entries moved (start 0 skips timing), FIFO_STATS_*_REJECT count a rejection and yield its return code.
+*/
+#if (FIFO_STATS == 1)
+#define FIFO_STATS_FIELD								fifo_stats_TD stats;
+#define FIFO_STATS_START()								fifo_stats_cycles()
+#define FIFO_STATS_INIT(stats)							((void)fifo_stats_reset(stats))
+#define FIFO_STATS_PUSH(stats, n, used, start)			fifo_stats_on_push((stats), (fifo_size_t)(n), (fifo_size_t)(used), (start))
+#define FIFO_STATS_PUSH_REJECT(stats, code)				(fifo_stats_on_push_reject(stats), (code))
+#define FIFO_STATS_POP(stats, n, start)					fifo_stats_on_pop((stats), (fifo_size_t)(n), (start))
+#define FIFO_STATS_POP_REJECT(stats, code)				(fifo_stats_on_pop_reject(stats), (code))
+#else
+#define FIFO_STATS_FIELD
+#define FIFO_STATS_START()								((uint64_t)0)
+#define FIFO_STATS_INIT(stats)							((void)0)
+#define FIFO_STATS_PUSH(stats, n, used, start)			((void)(n), (void)(used), (void)(start))
+#define FIFO_STATS_PUSH_REJECT(stats, code)				(code)
+#define FIFO_STATS_POP(stats, n, start)					((void)(n), (void)(start))
+#define FIFO_STATS_POP_REJECT(stats, code)				(code)
+#endif
+
+#endif /* FIFO_STATS_H_ */
@@ -0,0 +1,667 @@
+/**
+ * 	@file fifo_template.h
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Macro generator of typed FIFO buffers.
+ *  Element type is known at compile time, so entry copies become fixed-size stores
+ *  instead of variable-length memcpy with runtime entry size.
+ *
+ *  FIFO_DEFINE(name, type) creates type fifo_<name>_TD and static inline functions:
+ *  	fifo_<name>_reset, fifo_<name>_clear, fifo_<name>_pop, fifo_<name>_pop_mul, fifo_<name>_read_some,
+ *  	fifo_<name>_popv, fifo_<name>_peek, fifo_<name>_release, fifo_<name>_push, fifo_<name>_push_mul,
+ *  	fifo_<name>_pushv, fifo_<name>_write_some, fifo_<name>_reserve, fifo_<name>_commit, fifo_<name>_init
+ *  with the same arguments and return codes as fifo_uint8_* functions.
+ *
+ *  FIFO_TEMPLATE_FAST(name, type) defines unchecked static inline fast-path functions:
+ *  	fifo_<name>_count_fast, fifo_<name>_free_fast, fifo_<name>_pop_fast, fifo_<name>_pop_mul_fast,
+ *  	fifo_<name>_push_fast, fifo_<name>_push_mul_fast
+ *  Preconditions (valid pointers, enough entries or free place) are only checked with FIFO_ASSERT,
+ *  the caller checks count/free once and then moves entries without any error path.
+ *  FIFO_DEFINE includes them, fifo.h provides them for the uint8_t, uint16_t and uint32_t FIFO buffers.
+ *
+ *  With FIFO_STATS enabled fifo_<name>_TD carries a stats member counted by these functions, see fifo_stats.h.
+ *
+ *  FIFO_DEFINE_STATIC(name, type, capacity) creates type fifo_<name>_TD with embedded storage
+ *  of compile-time capacity and static inline functions:
+ *  	fifo_<name>_init, fifo_<name>_count, fifo_<name>_pop, fifo_<name>_pop_mul,
+ *  	fifo_<name>_push, fifo_<name>_push_mul
+ *
+ *  Example:
+ *  	typedef struct { uint32_t id; uint8_t dlc; uint8_t data[8]; } can_frame_TD;
+ *  	FIFO_DEFINE(can, can_frame_TD)
+ *  	FIFO_DEFINE_STATIC(can64, can_frame_TD, 64)
+ */
+
+#ifndef FIFO_TEMPLATE_H_
+#define FIFO_TEMPLATE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "fifo_config.h"
+#include "fifo_simd.h"
+#include "fifo_stats.h"
+
+/**
+* 	@brief	Declares FIFO buffer type fifo_<name>_TD that stores entries of type.
+*/
+#define FIFO_TEMPLATE_TYPE(name, type)																\
+typedef struct																						\
+{																									\
+	type *buffer;			/**< Pointer to buffer that stores values */							\
+	type *head_ptr;			/**< Pointer to a head of FIFO buffer */								\
+	type *tail_ptr;			/**< Pointer to a tail of FIFO buffer */								\
+	type *limit_ptr;		/**< Pointer to a limit of FIFO buffer */								\
+																									\
+	fifo_size_t max_size;		/**< Size of FIFO buffer */											\
+	fifo_size_t free_size;		/**< Free size of FIFO buffer */									\
+	FIFO_STATS_FIELD			/**< Statistics of FIFO buffer, only with FIFO_STATS */				\
+																									\
+}fifo_##name##_TD;
+
+/**
+* 	@brief	Declares prototypes of fifo_<name>_* functions.
+*/
+#define FIFO_TEMPLATE_PROTOTYPES(name, type)														\
+int fifo_##name##_reset(fifo_##name##_TD *fifo);													\
+int fifo_##name##_clear(fifo_##name##_TD *fifo);													\
+int fifo_##name##_pop(fifo_##name##_TD *fifo, type *val);											\
+int fifo_##name##_pop_mul(fifo_##name##_TD *fifo, type *pop_buffer, fifo_size_t m);					\
+fifo_size_t fifo_##name##_read_some(fifo_##name##_TD *fifo, type *pop_buffer, fifo_size_t m);		\
+int fifo_##name##_popv(fifo_##name##_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count);	\
+int fifo_##name##_peek(fifo_##name##_TD *fifo, fifo_size_t n, type **region1, fifo_size_t *len1, type **region2, fifo_size_t *len2); \
+int fifo_##name##_release(fifo_##name##_TD *fifo, fifo_size_t n);									\
+int fifo_##name##_push(fifo_##name##_TD *fifo, type val);											\
+int fifo_##name##_push_mul(fifo_##name##_TD *fifo, type *push_buffer, fifo_size_t m);				\
+int fifo_##name##_pushv(fifo_##name##_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count);	\
+fifo_size_t fifo_##name##_write_some(fifo_##name##_TD *fifo, type *push_buffer, fifo_size_t m);		\
+int fifo_##name##_reserve(fifo_##name##_TD *fifo, fifo_size_t n, type **region1, fifo_size_t *len1, type **region2, fifo_size_t *len2); \
+int fifo_##name##_commit(fifo_##name##_TD *fifo, fifo_size_t n);									\
+int fifo_##name##_init(fifo_##name##_TD *fifo, type *buffer, fifo_size_t size, bool clear_flag);
+
+/**
+* 	@brief	Defines fifo_<name>_* functions, scope is prepended to every definition (empty or static inline).
+*/
+#define FIFO_TEMPLATE_FUNCTIONS(name, type, scope)													\
+																									\
+scope int fifo_##name##_reset(fifo_##name##_TD *fifo)												\
+{																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+																									\
+	fifo->head_ptr = fifo->buffer;																	\
+	fifo->tail_ptr = fifo->buffer;																	\
+	fifo->free_size = fifo->max_size;																\
+																									\
+	return 0;																						\
+}																									\
+																									\
+scope int fifo_##name##_clear(fifo_##name##_TD *fifo)												\
+{																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+																									\
+	fifo_wipe(fifo->buffer, ((size_t)fifo->max_size * sizeof(type)));								\
+																									\
+	return fifo_##name##_reset(fifo);																\
+}																									\
+																									\
+scope int fifo_##name##_pop(fifo_##name##_TD *fifo, type *val)										\
+{																									\
+	uint64_t start = FIFO_STATS_START();															\
+																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(val == NULL) return -2;  /* val pointer NULL */												\
+	if(fifo->free_size == fifo->max_size) return FIFO_STATS_POP_REJECT(&fifo->stats, -3); /* fifo empty */ \
+																									\
+	*val = *fifo->head_ptr;																			\
+	fifo->head_ptr++;																				\
+	fifo->free_size++;																				\
+																									\
+	if(fifo->head_ptr >= fifo->limit_ptr) fifo->head_ptr = fifo->buffer;							\
+																									\
+	FIFO_STATS_POP(&fifo->stats, 1, start);															\
+																									\
+	return 0;																						\
+}																									\
+																									\
+scope int fifo_##name##_pop_mul(fifo_##name##_TD *fifo, type *pop_buffer, fifo_size_t m)			\
+{																									\
+	uint64_t start = FIFO_STATS_START();															\
+	fifo_size_t first = 0;																			\
+	fifo_size_t n = m;																				\
+																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(pop_buffer == NULL) return -2; /* pop buffer pointer NULL */									\
+	if(m == 0) return -3; /* zero m */																\
+	if(m > (fifo->max_size - fifo->free_size)) return FIFO_STATS_POP_REJECT(&fifo->stats, -4); /* current size lower than m */ \
+																									\
+	fifo->free_size += m;																			\
+																									\
+	first = (fifo_size_t)(fifo->limit_ptr - fifo->head_ptr);										\
+																									\
+	if(m >= first)																					\
+	{																								\
+		fifo_simd_copy(pop_buffer, fifo->head_ptr, ((size_t)first * sizeof(type)));					\
+		pop_buffer += first;																		\
+		m -= first;																					\
+		fifo->head_ptr = fifo->buffer;																\
+	}																								\
+																									\
+	fifo_simd_copy(pop_buffer, fifo->head_ptr, ((size_t)m * sizeof(type)));							\
+	fifo->head_ptr += m;																			\
+																									\
+	FIFO_STATS_POP(&fifo->stats, n, start);															\
+																									\
+	return 0;																						\
+}																									\
+																									\
+scope fifo_size_t fifo_##name##_read_some(fifo_##name##_TD *fifo, type *pop_buffer, fifo_size_t m)	\
+{																									\
+	if((fifo == NULL) || (pop_buffer == NULL)) return 0; /* pointer NULL */							\
+																									\
+	if(m > (fifo->max_size - fifo->free_size)) m = (fifo->max_size - fifo->free_size);				\
+	if(m == 0) return 0; /* fifo empty */															\
+																									\
+	fifo_##name##_pop_mul(fifo, pop_buffer, m);														\
+																									\
+	return m;																						\
+}																									\
+																									\
+scope int fifo_##name##_popv(fifo_##name##_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count) \
+{																									\
+	fifo_index_t total = 0;																			\
+	fifo_size_t i = 0;																				\
+	fifo_size_t m = 0;																				\
+	fifo_size_t first = 0;																			\
+	type *head = NULL;																				\
+	type *dst = NULL;																				\
+	uint64_t start = FIFO_STATS_START();															\
+																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(iov == NULL) return -2; /* iovec pointer NULL */												\
+																									\
+	total = fifo_iov_total(iov, iov_count);															\
+																									\
+	if(total == FIFO_INDEX_MAX) return -2; /* piece pointer NULL */									\
+	if(total == 0) return -3; /* zero total length */												\
+	if(total > (fifo_index_t)(fifo->max_size - fifo->free_size)) return FIFO_STATS_POP_REJECT(&fifo->stats, -4); /* current size lower than total length */ \
+																									\
+	head = fifo->head_ptr;																			\
+																									\
+	for(i = 0; i < iov_count; i++)																	\
+	{																								\
+		dst = iov[i].base;																			\
+		m = iov[i].len;																				\
+		first = (fifo_size_t)(fifo->limit_ptr - head);												\
+																									\
+		if(m >= first)																				\
+		{																							\
+			fifo_simd_copy(dst, head, ((size_t)first * sizeof(type)));								\
+			dst += first;																			\
+			m -= first;																				\
+			head = fifo->buffer;																	\
+		}																							\
+																									\
+		fifo_simd_copy(dst, head, ((size_t)m * sizeof(type)));										\
+		head += m;																					\
+	}																								\
+																									\
+	fifo->head_ptr = head;																			\
+	fifo->free_size += (fifo_size_t)total;															\
+																									\
+	FIFO_STATS_POP(&fifo->stats, total, start);														\
+																									\
+	return 0;																						\
+}																									\
+																									\
+scope int fifo_##name##_peek(fifo_##name##_TD *fifo, fifo_size_t n, type **region1, fifo_size_t *len1, type **region2, fifo_size_t *len2) \
+{																									\
+	fifo_size_t first = 0;																			\
+																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if((region1 == NULL) || (len1 == NULL) || (region2 == NULL) || (len2 == NULL)) return -2; /* region pointer NULL */ \
+	if(n == 0) return -3; /* zero n */																\
+	if(n > (fifo->max_size - fifo->free_size)) return FIFO_STATS_POP_REJECT(&fifo->stats, -4); /* current size lower than n */ \
+																									\
+	first = (fifo_size_t)(fifo->limit_ptr - fifo->head_ptr);										\
+																									\
+	*region1 = fifo->head_ptr;																		\
+																									\
+	if(n <= first)																					\
+	{																								\
+		*len1 = n;																					\
+		*region2 = NULL;																			\
+		*len2 = 0;																					\
+	}																								\
+	else																							\
+	{																								\
+		*len1 = first;																				\
+		*region2 = fifo->buffer;																	\
+		*len2 = (n - first);																		\
+	}																								\
+																									\
+	return 0;																						\
+}																									\
+																									\
+scope int fifo_##name##_release(fifo_##name##_TD *fifo, fifo_size_t n)								\
+{																									\
+	fifo_size_t first = 0;																			\
+																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(n == 0) return -3; /* zero n */																\
+	if(n > (fifo->max_size - fifo->free_size)) return -4; /* current size lower than n */			\
+																									\
+	fifo->free_size += n;																			\
+																									\
+	first = (fifo_size_t)(fifo->limit_ptr - fifo->head_ptr);										\
+																									\
+	if(n >= first) fifo->head_ptr = (fifo->buffer + (n - first));									\
+	else fifo->head_ptr += n;																		\
+																									\
+	FIFO_STATS_POP(&fifo->stats, n, 0);																\
+																									\
+	return 0;																						\
+}																									\
+																									\
+scope int fifo_##name##_push(fifo_##name##_TD *fifo, type val)										\
+{																									\
+	uint64_t start = FIFO_STATS_START();															\
+																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(fifo->free_size == 0) return FIFO_STATS_PUSH_REJECT(&fifo->stats, -2); /* fifo full */		\
+																									\
+	*fifo->tail_ptr = val;																			\
+	fifo->tail_ptr++;																				\
+	fifo->free_size--;																				\
+																									\
+	if(fifo->tail_ptr >= fifo->limit_ptr) fifo->tail_ptr = fifo->buffer;							\
+																									\
+	FIFO_STATS_PUSH(&fifo->stats, 1, (fifo->max_size - fifo->free_size), start);					\
+																									\
+	return 0;																						\
+}																									\
+																									\
+scope int fifo_##name##_push_mul(fifo_##name##_TD *fifo, type *push_buffer, fifo_size_t m)			\
+{																									\
+	uint64_t start = FIFO_STATS_START();															\
+	fifo_size_t first = 0;																			\
+	fifo_size_t n = m;																				\
+																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(push_buffer == NULL) return -2; /* push buffer pointer NULL */								\
+	if(m == 0) return -3; /* zero m */																\
+	if(m > fifo->free_size) return FIFO_STATS_PUSH_REJECT(&fifo->stats, -4); /* no place for m elements in FIFO */ \
+																									\
+	fifo->free_size -= m;																			\
+																									\
+	first = (fifo_size_t)(fifo->limit_ptr - fifo->tail_ptr);										\
+																									\
+	if(m >= first)																					\
+	{																								\
+		fifo_simd_copy(fifo->tail_ptr, push_buffer, ((size_t)first * sizeof(type)));				\
+		push_buffer += first;																		\
+		m -= first;																					\
+		fifo->tail_ptr = fifo->buffer;																\
+	}																								\
+																									\
+	fifo_simd_copy(fifo->tail_ptr, push_buffer, ((size_t)m * sizeof(type)));						\
+	fifo->tail_ptr += m;																			\
+																									\
+	FIFO_STATS_PUSH(&fifo->stats, n, (fifo->max_size - fifo->free_size), start);					\
+																									\
+	return 0;																						\
+}																									\
+																									\
+scope int fifo_##name##_pushv(fifo_##name##_TD *fifo, const fifo_iovec_TD *iov, fifo_size_t iov_count) \
+{																									\
+	fifo_index_t total = 0;																			\
+	fifo_size_t i = 0;																				\
+	fifo_size_t m = 0;																				\
+	fifo_size_t first = 0;																			\
+	type *tail = NULL;																				\
+	const type *src = NULL;																			\
+	uint64_t start = FIFO_STATS_START();															\
+																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(iov == NULL) return -2; /* iovec pointer NULL */												\
+																									\
+	total = fifo_iov_total(iov, iov_count);															\
+																									\
+	if(total == FIFO_INDEX_MAX) return -2; /* piece pointer NULL */									\
+	if(total == 0) return -3; /* zero total length */												\
+	if(total > fifo->free_size) return FIFO_STATS_PUSH_REJECT(&fifo->stats, -4); /* no place for total length in FIFO */ \
+																									\
+	tail = fifo->tail_ptr;																			\
+																									\
+	for(i = 0; i < iov_count; i++)																	\
+	{																								\
+		src = iov[i].base;																			\
+		m = iov[i].len;																				\
+		first = (fifo_size_t)(fifo->limit_ptr - tail);												\
+																									\
+		if(m >= first)																				\
+		{																							\
+			fifo_simd_copy(tail, src, ((size_t)first * sizeof(type)));								\
+			src += first;																			\
+			m -= first;																				\
+			tail = fifo->buffer;																	\
+		}																							\
+																									\
+		fifo_simd_copy(tail, src, ((size_t)m * sizeof(type)));										\
+		tail += m;																					\
+	}																								\
+																									\
+	fifo->tail_ptr = tail;																			\
+	fifo->free_size -= (fifo_size_t)total;															\
+																									\
+	FIFO_STATS_PUSH(&fifo->stats, total, (fifo->max_size - fifo->free_size), start);				\
+																									\
+	return 0;																						\
+}																									\
+																									\
+scope fifo_size_t fifo_##name##_write_some(fifo_##name##_TD *fifo, type *push_buffer, fifo_size_t m) \
+{																									\
+	if((fifo == NULL) || (push_buffer == NULL)) return 0; /* pointer NULL */						\
+																									\
+	if(m > fifo->free_size) m = fifo->free_size;													\
+	if(m == 0) return 0; /* fifo full */															\
+																									\
+	fifo_##name##_push_mul(fifo, push_buffer, m);													\
+																									\
+	return m;																						\
+}																									\
+																									\
+scope int fifo_##name##_reserve(fifo_##name##_TD *fifo, fifo_size_t n, type **region1, fifo_size_t *len1, type **region2, fifo_size_t *len2) \
+{																									\
+	fifo_size_t first = 0;																			\
+																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if((region1 == NULL) || (len1 == NULL) || (region2 == NULL) || (len2 == NULL)) return -2; /* region pointer NULL */ \
+	if(n == 0) return -3; /* zero n */																\
+	if(n > fifo->free_size) return FIFO_STATS_PUSH_REJECT(&fifo->stats, -4); /* no place for n elements in FIFO */ \
+																									\
+	first = (fifo_size_t)(fifo->limit_ptr - fifo->tail_ptr);										\
+																									\
+	*region1 = fifo->tail_ptr;																		\
+																									\
+	if(n <= first)																					\
+	{																								\
+		*len1 = n;																					\
+		*region2 = NULL;																			\
+		*len2 = 0;																					\
+	}																								\
+	else																							\
+	{																								\
+		*len1 = first;																				\
+		*region2 = fifo->buffer;																	\
+		*len2 = (n - first);																		\
+	}																								\
+																									\
+	return 0;																						\
+}																									\
+																									\
+scope int fifo_##name##_commit(fifo_##name##_TD *fifo, fifo_size_t n)								\
+{																									\
+	fifo_size_t first = 0;																			\
+																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(n == 0) return -3; /* zero n */																\
+	if(n > fifo->free_size) return -4; /* no place for n elements in FIFO */						\
+																									\
+	fifo->free_size -= n;																			\
+																									\
+	first = (fifo_size_t)(fifo->limit_ptr - fifo->tail_ptr);										\
+																									\
+	if(n >= first) fifo->tail_ptr = (fifo->buffer + (n - first));									\
+	else fifo->tail_ptr += n;																		\
+																									\
+	FIFO_STATS_PUSH(&fifo->stats, n, (fifo->max_size - fifo->free_size), 0);						\
+																									\
+	return 0;																						\
+}																									\
+																									\
+scope int fifo_##name##_init(fifo_##name##_TD *fifo, type *buffer, fifo_size_t size, bool clear_flag) \
+{																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(buffer == NULL) return -2; /* buffer pointer NULL */											\
+	if(size == 0) return -3; /* zero size */														\
+																									\
+	fifo->buffer = buffer;																			\
+	fifo->head_ptr = buffer;																		\
+	fifo->tail_ptr = buffer;																		\
+	fifo->limit_ptr = (buffer + size);																\
+	fifo->max_size = size;																			\
+	fifo->free_size = size;																			\
+	FIFO_STATS_INIT(&fifo->stats);																	\
+																									\
+	if(clear_flag == true) fifo_wipe(buffer, ((size_t)size * sizeof(type)));						\
+																									\
+	return 0;																						\
+}
+
+/**
+* 	@brief	Defines unchecked static inline fifo_<name>_*_fast functions, preconditions are checked with FIFO_ASSERT only.
+*/
+#define FIFO_TEMPLATE_FAST(name, type)																\
+static inline fifo_size_t fifo_##name##_count_fast(const fifo_##name##_TD *fifo)					\
+{																									\
+	FIFO_ASSERT(fifo != NULL);																		\
+																									\
+	return (fifo_size_t)(fifo->max_size - fifo->free_size);											\
+}																									\
+																									\
+static inline fifo_size_t fifo_##name##_free_fast(const fifo_##name##_TD *fifo)						\
+{																									\
+	FIFO_ASSERT(fifo != NULL);																		\
+																									\
+	return fifo->free_size;																			\
+}																									\
+																									\
+static inline type fifo_##name##_pop_fast(fifo_##name##_TD *fifo)									\
+{																									\
+	type *head = NULL;																				\
+	type val;																						\
+																									\
+	FIFO_ASSERT(fifo != NULL);																		\
+	FIFO_ASSERT(fifo->free_size != fifo->max_size); /* fifo empty */								\
+																									\
+	head = fifo->head_ptr;																			\
+	val = *head++;																					\
+	if(head == fifo->limit_ptr) head = fifo->buffer;												\
+																									\
+	fifo->head_ptr = head;																			\
+	fifo->free_size++;																				\
+	FIFO_STATS_POP(&fifo->stats, 1, 0);																\
+																									\
+	return val;																						\
+}																									\
+																									\
+static inline void fifo_##name##_pop_mul_fast(fifo_##name##_TD *fifo, type *pop_buffer, fifo_size_t m) \
+{																									\
+	fifo_size_t first = 0;																			\
+																									\
+	FIFO_ASSERT((fifo != NULL) && ((pop_buffer != NULL) || (m == 0)));								\
+	FIFO_ASSERT(m <= (fifo->max_size - fifo->free_size)); /* current size lower than m */			\
+																									\
+	first = (fifo_size_t)(fifo->limit_ptr - fifo->head_ptr);										\
+	fifo->free_size += m;																			\
+	FIFO_STATS_POP(&fifo->stats, m, 0);																\
+																									\
+	if(m >= first)																					\
+	{																								\
+		fifo_simd_copy(pop_buffer, fifo->head_ptr, ((size_t)first * sizeof(type)));					\
+		pop_buffer += first;																		\
+		m -= first;																					\
+		fifo->head_ptr = fifo->buffer;																\
+	}																								\
+																									\
+	fifo_simd_copy(pop_buffer, fifo->head_ptr, ((size_t)m * sizeof(type)));							\
+	fifo->head_ptr += m;																			\
+}																									\
+																									\
+static inline void fifo_##name##_push_fast(fifo_##name##_TD *fifo, type val)						\
+{																									\
+	type *tail = NULL;																				\
+																									\
+	FIFO_ASSERT(fifo != NULL);																		\
+	FIFO_ASSERT(fifo->free_size != 0); /* fifo full */												\
+																									\
+	tail = fifo->tail_ptr;																			\
+	*tail++ = val;																					\
+	if(tail == fifo->limit_ptr) tail = fifo->buffer;												\
+																									\
+	fifo->tail_ptr = tail;																			\
+	fifo->free_size--;																				\
+	FIFO_STATS_PUSH(&fifo->stats, 1, (fifo->max_size - fifo->free_size), 0);						\
+}																									\
+																									\
+static inline void fifo_##name##_push_mul_fast(fifo_##name##_TD *fifo, const type *push_buffer, fifo_size_t m) \
+{																									\
+	fifo_size_t first = 0;																			\
+																									\
+	FIFO_ASSERT((fifo != NULL) && ((push_buffer != NULL) || (m == 0)));								\
+	FIFO_ASSERT(m <= fifo->free_size); /* no place for m elements in FIFO */						\
+																									\
+	first = (fifo_size_t)(fifo->limit_ptr - fifo->tail_ptr);										\
+	fifo->free_size -= m;																			\
+	FIFO_STATS_PUSH(&fifo->stats, m, (fifo->max_size - fifo->free_size), 0);						\
+																									\
+	if(m >= first)																					\
+	{																								\
+		fifo_simd_copy(fifo->tail_ptr, push_buffer, ((size_t)first * sizeof(type)));				\
+		push_buffer += first;																		\
+		m -= first;																					\
+		fifo->tail_ptr = fifo->buffer;																\
+	}																								\
+																									\
+	fifo_simd_copy(fifo->tail_ptr, push_buffer, ((size_t)m * sizeof(type)));						\
+	fifo->tail_ptr += m;																			\
+}
+
+/**
+* 	@brief	Creates FIFO buffer type fifo_<name>_TD and its static inline functions for user defined entry type.
+*/
+#define FIFO_DEFINE(name, type)																		\
+	FIFO_TEMPLATE_TYPE(name, type)																	\
+	FIFO_TEMPLATE_FUNCTIONS(name, type, static inline)												\
+	FIFO_TEMPLATE_FAST(name, type)
+
+/**
+* 	@brief	Creates FIFO buffer type fifo_<name>_TD with embedded storage of compile-time capacity.
+*
+* 	Capacity is a constant, so index wrap compares against an immediate value and
+* 	a power-of-two capacity needs no division at all. It must be 1..FIFO_SIZE_MAX, checked at compile time.
+*/
+#define FIFO_DEFINE_STATIC(name, type, capacity)													\
+typedef struct																						\
+{																									\
+	type buffer[(capacity)];	/**< Storage of FIFO buffer */										\
+	fifo_size_t head;			/**< Read index of FIFO buffer */									\
+	fifo_size_t tail;			/**< Write index of FIFO buffer */									\
+	fifo_size_t count;			/**< Amount of entries stored in FIFO buffer */						\
+																									\
+}fifo_##name##_TD;																					\
+																									\
+_Static_assert((((capacity) > 0) && ((capacity) <= FIFO_SIZE_MAX)), "capacity of " #name " must be 1..FIFO_SIZE_MAX"); \
+																									\
+static inline int fifo_##name##_init(fifo_##name##_TD *fifo)										\
+{																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+																									\
+	fifo->head = 0;																					\
+	fifo->tail = 0;																					\
+	fifo->count = 0;																				\
+																									\
+	return 0;																						\
+}																									\
+																									\
+static inline fifo_size_t fifo_##name##_count(const fifo_##name##_TD *fifo)							\
+{																									\
+	return fifo->count;																				\
+}																									\
+																									\
+static inline int fifo_##name##_pop(fifo_##name##_TD *fifo, type *val)								\
+{																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(val == NULL) return -2;  /* val pointer NULL */												\
+	if(fifo->count == 0) return -3; /* fifo empty */												\
+																									\
+	*val = fifo->buffer[fifo->head];																\
+	if(++fifo->head == (capacity)) fifo->head = 0;													\
+	fifo->count--;																					\
+																									\
+	return 0;																						\
+}																									\
+																									\
+static inline int fifo_##name##_pop_mul(fifo_##name##_TD *fifo, type *pop_buffer, fifo_size_t m)	\
+{																									\
+	fifo_size_t first = 0;																			\
+																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(pop_buffer == NULL) return -2; /* pop buffer pointer NULL */									\
+	if(m == 0) return -3; /* zero m */																\
+	if(m > fifo->count) return -4; /* current size lower than m */									\
+																									\
+	first = (capacity) - fifo->head;																\
+																									\
+	if(m < first)																					\
+	{																								\
+		fifo_simd_copy(pop_buffer, &fifo->buffer[fifo->head], ((size_t)m * sizeof(type)));			\
+		fifo->head += m;																			\
+	}																								\
+	else																							\
+	{																								\
+		fifo_simd_copy(pop_buffer, &fifo->buffer[fifo->head], ((size_t)first * sizeof(type)));		\
+		fifo_simd_copy(pop_buffer + first, fifo->buffer, ((size_t)(m - first) * sizeof(type)));		\
+		fifo->head = (m - first);																	\
+	}																								\
+																									\
+	fifo->count -= m;																				\
+																									\
+	return 0;																						\
+}																									\
+																									\
+static inline int fifo_##name##_push(fifo_##name##_TD *fifo, type val)								\
+{																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(fifo->count == (capacity)) return -2; /* fifo full */										\
+																									\
+	fifo->buffer[fifo->tail] = val;																	\
+	if(++fifo->tail == (capacity)) fifo->tail = 0;													\
+	fifo->count++;																					\
+																									\
+	return 0;																						\
+}																									\
+																									\
+static inline int fifo_##name##_push_mul(fifo_##name##_TD *fifo, const type *push_buffer, fifo_size_t m) \
+{																									\
+	fifo_size_t first = 0;																			\
+																									\
+	if(fifo == NULL) return -1; /* fifo pointer NULL */												\
+	if(push_buffer == NULL) return -2; /* push buffer pointer NULL */								\
+	if(m == 0) return -3; /* zero m */																\
+	if(m > ((capacity) - fifo->count)) return -4; /* no place for m elements in FIFO */				\
+																									\
+	first = (capacity) - fifo->tail;																\
+																									\
+	if(m < first)																					\
+	{																								\
+		fifo_simd_copy(&fifo->buffer[fifo->tail], push_buffer, ((size_t)m * sizeof(type)));			\
+		fifo->tail += m;																			\
+	}																								\
+	else																							\
+	{																								\
+		fifo_simd_copy(&fifo->buffer[fifo->tail], push_buffer, ((size_t)first * sizeof(type)));		\
+		fifo_simd_copy(fifo->buffer, push_buffer + first, ((size_t)(m - first) * sizeof(type)));	\
+		fifo->tail = (m - first);																	\
+	}																								\
+																									\
+	fifo->count += m;																				\
+																									\
+	return 0;																						\
+}
+
+#endif /* FIFO_TEMPLATE_H_ */
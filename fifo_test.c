@@ -0,0 +1,770 @@
+/**
+ * 	@file fifo_test.c
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Built-in self-test of uint8_t, uint16_t and common FIFO buffers, of the SIMD kernels, of FIFO groups and pools
+ *  and, on Linux, of mirrored and shared memory FIFO buffers and of direct file/socket I/O.
+ *  Kept apart from fifo.c so the FIFO functions are called through their public entry points.
+ *  Vectorized kernels, reductions and converting pops are checked against plain scalar loops.
+ *
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include <string.h>
+
+#include "fifo.h"
+#include "fifo_spsc.h"
+#include "fifo_simd.h"
+#include "fifo_stats.h"
+#include "fifo_group.h"
+#include "fifo_pool.h"
+
+#if defined(__linux__)
+#include "fifo_mirror.h"
+#include "fifo_shm.h"
+#include "fifo_io.h"
+#endif
+
+/**
+*	@addtogroup Software_FIFO_buffer Software FIFO buffers
+* 	@{
+*/
+
+/**
+ *	@brief Gives test sample seq: 0, 0xFFFF, a scrambled value and a value with the top bit flipped, in turn.
+ */
+static inline uint16_t fifo_test_value(uint16_t seq)
+{
+	switch(seq & 3)
+	{
+		case 0: return 0;
+		case 1: return 0xFFFF;
+		case 2: return (uint16_t)(seq * 40503u);
+		default: return (uint16_t)(seq ^ 0x8000u);
+	}
+}
+
+/**
+ *	@brief Fills n entries of buffer with the next test samples.
+ */
+static void fifo_test_fill(uint16_t *buffer, fifo_size_t n, uint16_t *seq)
+{
+	fifo_size_t i = 0;
+
+	for(i = 0; i < n; i++) buffer[i] = fifo_test_value((*seq)++);
+}
+
+/**
+ *	@brief Checks copy, widening and reduction kernels of fifo_simd.h against scalar loops, for every
+ *	length up to past the vector widths and the inline copy limit, without writing past the length.
+ */
+static int fifo_test_simd(void)
+{
+	uint8_t src8[FIFO_SIMD_SHORT_COPY + 16];
+	uint8_t dst8[FIFO_SIMD_SHORT_COPY + 16];
+	uint16_t src16[40];
+	uint16_t dst16[40];
+	int32_t dst32[40];
+	float dstf[40];
+	uint64_t sum = 0;
+	uint16_t seq = 0;
+	uint16_t min = 0;
+	uint16_t max = 0;
+	uint16_t ref_min = 0;
+	uint16_t ref_max = 0;
+	size_t n = 0;
+	size_t i = 0;
+
+	for(i = 0; i < sizeof(src8); i++) src8[i] = (uint8_t)fifo_test_value((uint16_t)i);
+	fifo_test_fill(src16, 40, &seq);
+
+	for(n = 0; n < (sizeof(src8) - 3); n++)
+	{
+		memset(dst8, 0xA5, sizeof(dst8));
+		fifo_simd_copy(&dst8[1], &src8[n & 3], n); /* unaligned source and destination */
+
+		if(memcmp(&dst8[1], &src8[n & 3], n) != 0) return -4; /* wrong copy */
+		if((dst8[0] != 0xA5) || (dst8[n + 1] != 0xA5)) return -4; /* wrote outside of the copy */
+	}
+
+	fifo_simd_copy(NULL, NULL, 0); /* empty span of a wrap split, touches neither pointer */
+
+	for(n = 0; n < 39; n++)
+	{
+		for(i = 0; i < 40; i++)
+		{
+			dst16[i] = 0x5A5A;
+			dst32[i] = -1;
+			dstf[i] = -1.0f;
+		}
+
+		fifo_simd_u8_to_u16(dst16, src8, n);
+		fifo_simd_u16_to_i32(dst32, src16, n);
+		fifo_simd_u16_to_f32(dstf, src16, n);
+
+		for(i = 0; i < n; i++)
+		{
+			if(dst16[i] != src8[i]) return -4; /* wrong u8 to u16 */
+			if(dst32[i] != (int32_t)src16[i]) return -4; /* wrong u16 to i32 */
+			if(dstf[i] != (float)src16[i]) return -4; /* wrong u16 to f32 */
+		}
+
+		if((dst16[n] != 0x5A5A) || (dst32[n] != -1) || (dstf[n] != -1.0f)) return -4; /* wrote past n */
+
+		sum = 0;
+		ref_min = 0xFFFF;
+		ref_max = 0;
+
+		for(i = 0; i < n; i++)
+		{
+			sum += src16[i];
+			if(src16[i] < ref_min) ref_min = src16[i];
+			if(src16[i] > ref_max) ref_max = src16[i];
+		}
+
+		min = 0xFFFF;
+		max = 0;
+		fifo_simd_u16_minmax(src16, n, &min, &max);
+
+		if(fifo_simd_u16_sum(src16, n) != sum) return -4; /* wrong sum */
+		if((min != ref_min) || (max != ref_max)) return -4; /* wrong min/max */
+	}
+
+	return 0;
+}
+
+/**
+ *	@brief Checks sum, min/max, decimation, moving-average and converting pops of uint16_t and uint8_t FIFO buffers
+ *	against scalar results, for every length of an odd sized buffer at moving wrap positions.
+ */
+static int fifo_test_uint16(void)
+{
+	uint16_t storage[13];
+	uint8_t storage8[13];
+	uint16_t in[13];
+	uint16_t out[13];
+	uint8_t in8[13];
+	uint16_t out8[13];
+	int32_t out32[13];
+	float outf[13];
+	fifo_uint16_TD fifo;
+	fifo_uint8_TD fifo8;
+	uint64_t ref_sum = 0;
+	uint64_t sum = 0;
+	uint16_t seq = 0;
+	uint16_t min = 0;
+	uint16_t max = 0;
+	uint16_t ref_min = 0;
+	uint16_t ref_max = 0;
+	fifo_size_t offset = 0;
+	fifo_size_t m = 0;
+	fifo_size_t k = 0;
+	fifo_size_t n = 0;
+	fifo_size_t i = 0;
+	fifo_size_t j = 0;
+
+	fifo_uint16_init(&fifo, storage, 13, true);
+	fifo_uint8_init(&fifo8, storage8, 13, true);
+
+	for(offset = 0; offset < 13; offset++)
+	{
+		for(m = 1; m <= 13; m++)
+		{
+			fifo_test_fill(in, m, &seq);
+
+			ref_sum = 0;
+			ref_min = 0xFFFF;
+			ref_max = 0;
+
+			for(i = 0; i < m; i++)
+			{
+				ref_sum += in[i];
+				if(in[i] < ref_min) ref_min = in[i];
+				if(in[i] > ref_max) ref_max = in[i];
+				in8[i] = (uint8_t)in[i];
+			}
+
+			if(fifo_uint16_push_mul(&fifo, in, m) != 0) return -5;
+			if((fifo_uint16_pop_sum(&fifo, m, &sum) != 0) || (sum != ref_sum)) return -5; /* wrong sum */
+
+			if(fifo_uint16_push_mul(&fifo, in, m) != 0) return -5;
+			if(fifo_uint16_pop_minmax(&fifo, m, &min, &max) != 0) return -5;
+			if((min != ref_min) || (max != ref_max)) return -5; /* wrong min/max */
+
+			for(k = 1; k <= m; k++)
+			{
+				n = (m / k);
+
+				if(fifo_uint16_push_mul(&fifo, in, (n * k)) != 0) return -5;
+				if(fifo_uint16_pop_decimate(&fifo, out, n, k) != 0) return -5;
+
+				for(i = 0; i < n; i++)
+				{
+					for(sum = 0, j = 0; j < k; j++) sum += in[(i * k) + j];
+					if(out[i] != (uint16_t)((sum + (k / 2)) / k)) return -5; /* wrong mean */
+				}
+			}
+
+			for(k = 1; k <= m; k++)
+			{
+				n = (m - k + 1);
+
+				if(fifo_uint16_push_mul(&fifo, in, m) != 0) return -5;
+				if(fifo_uint16_pop_mavg(&fifo, out, n, k) != 0) return -5;
+
+				for(i = 0; i < n; i++)
+				{
+					for(sum = 0, j = 0; j < k; j++) sum += in[i + j];
+					if(out[i] != (uint16_t)((sum + (k / 2)) / k)) return -5; /* wrong average */
+				}
+
+				if(k > 1)
+				{
+					if(fifo_uint16_pop_mul(&fifo, out, (k - 1)) != 0) return -5; /* window tail not kept */
+					if(memcmp(out, &in[n], ((size_t)(k - 1) * sizeof(uint16_t))) != 0) return -5; /* wrong window tail */
+				}
+			}
+
+			if(fifo_uint16_push_mul(&fifo, in, m) != 0) return -6;
+			if(fifo_uint16_pop_mul_convert_i32(&fifo, out32, m) != 0) return -6;
+			if(fifo_uint16_push_mul(&fifo, in, m) != 0) return -6;
+			if(fifo_uint16_pop_mul_convert_f32(&fifo, outf, m) != 0) return -6;
+			if(fifo_uint8_push_mul(&fifo8, in8, m) != 0) return -6;
+			if(fifo_uint8_pop_mul_convert_u16(&fifo8, out8, m) != 0) return -6;
+
+			for(i = 0; i < m; i++)
+			{
+				if(out32[i] != (int32_t)in[i]) return -6; /* wrong i32 */
+				if(outf[i] != (float)in[i]) return -6; /* wrong f32 */
+				if(out8[i] != in8[i]) return -6; /* wrong u16 */
+			}
+		}
+
+		if(fifo.free_size != fifo.max_size) return -5; /* FIFO not empty */
+
+		if(fifo_uint16_push(&fifo, 0) != 0) return -5; /* move wrap position by one more */
+		if(fifo_uint16_pop(&fifo, &out[0]) != 0) return -5;
+		if(fifo_uint8_push(&fifo8, 0) != 0) return -6;
+		if(fifo_uint8_pop(&fifo8, &in8[0]) != 0) return -6;
+	}
+
+	return 0;
+}
+
+#if defined(__linux__)
+
+/**
+ *	@brief Checks that reserve, peek and pop_mul of a mirrored FIFO buffer of one page give one contiguous span
+ *	at every position, also across the end of the first mapping, for two laps of 24 entry runs.
+ */
+static int fifo_test_mirror(void)
+{
+	uint8_t in[24];
+	uint8_t out[24];
+	fifo_mirror_TD fifo;
+	size_t size = fifo_mirror_granularity(1);
+	uint8_t *region = NULL;
+	uint8_t seq = 0;
+	size_t wraps = 0;
+	size_t n = 0;
+	size_t i = 0;
+	int ret = 0;
+
+	if((fifo_size_t)size != size) return 0; /* page larger than any FIFO buffer, nothing to check */
+	if(fifo_mirror_init(&fifo, (fifo_size_t)size, 1) != 0) return -8;
+
+	for(n = 0; (n < ((2 * size) / sizeof(in))) && (ret == 0); n++)
+	{
+		for(i = 0; i < sizeof(in); i++) in[i] = seq++;
+
+		if(fifo_mirror_reserve(&fifo, sizeof(in), (void **)&region) != 0) ret = -8;
+		if(ret != 0) break;
+
+		memcpy(region, in, sizeof(in)); /* one span, also past the end of the first mapping */
+		if(fifo_mirror_commit(&fifo, sizeof(in)) != 0) ret = -8;
+
+		if(fifo_mirror_peek(&fifo, sizeof(in), (void **)&region) != 0) ret = -8;
+		if(ret != 0) break;
+
+		if((region + sizeof(in)) > fifo.limit_ptr) wraps++;
+		if(memcmp(region, in, sizeof(in)) != 0) ret = -8; /* span not contiguous */
+
+		if(fifo_mirror_pop_mul(&fifo, out, sizeof(in)) != 0) ret = -8;
+		if(memcmp(out, in, sizeof(in)) != 0) ret = -8; /* wrong data */
+	}
+
+	if(wraps == 0) ret = -8; /* no span crossed the end of the first mapping */
+	if(fifo_mirror_deinit(&fifo) != 0) ret = -8;
+
+	return ret;
+}
+
+/**
+ *	@brief Checks that a shared FIFO buffer formatted in a stack region is attached and moves entries between
+ *	two handles, and that attach rejects it with -5 after each corruption of magic, version, layout, ring size,
+ *	data offset, region size, entry sizes and indices of the header.
+ */
+static int fifo_test_shm(void)
+{
+	_Alignas(FIFO_CACHE_LINE_SIZE) uint8_t region[1024];
+	fifo_shm_TD producer;
+	fifo_shm_TD consumer;
+	fifo_shm_header_TD *header = (fifo_shm_header_TD *)(void *)region;
+	uint32_t in[3] = {0x01020304u, 0xFFFFFFFFu, 0};
+	uint32_t out[3];
+	fifo_size_t max_size = 0;
+	size_t region_size = fifo_shm_region_size(8, sizeof(uint32_t));
+
+	if(region_size > sizeof(region)) return -9; /* header larger than expected */
+	if(fifo_shm_init(&producer, region, region_size, 8, sizeof(uint32_t)) != 0) return -9;
+	if(fifo_shm_attach_region(&consumer, region, region_size) != 0) return -9;
+	if(fifo_shm_push_mul(&producer, in, 3) != 0) return -9;
+
+	atomic_store(&header->magic, 0);
+	if(fifo_shm_attach_region(&consumer, region, region_size) != -5) return -9; /* not initialized */
+	atomic_store(&header->magic, FIFO_SHM_MAGIC);
+
+	header->version++;
+	if(fifo_shm_attach_region(&consumer, region, region_size) != -5) return -9; /* other version */
+	header->version--;
+
+	header->layout ^= (1u << 8);
+	if(fifo_shm_attach_region(&consumer, region, region_size) != -5) return -9; /* other cache alignment */
+	header->layout ^= (1u << 8);
+
+	header->ring_size += FIFO_CACHE_LINE_SIZE;
+	if(fifo_shm_attach_region(&consumer, region, region_size) != -5) return -9; /* other ring layout */
+	header->ring_size -= FIFO_CACHE_LINE_SIZE;
+
+	header->data_offset += FIFO_CACHE_LINE_SIZE;
+	if(fifo_shm_attach_region(&consumer, region, region_size) != -5) return -9; /* other data offset */
+	header->data_offset -= FIFO_CACHE_LINE_SIZE;
+
+	if(fifo_shm_attach_region(&consumer, region, (region_size - 1)) != -5) return -9; /* mapping shorter than region */
+	if(fifo_shm_attach_region(&consumer, region, sizeof(fifo_shm_header_TD) - 1) != -5) return -9; /* mapping shorter than header */
+
+	max_size = header->ring.max_size;
+	header->ring.max_size = 0;
+	if(fifo_shm_attach_region(&consumer, region, region_size) != -5) return -9; /* zero size */
+	header->ring.max_size = (fifo_size_t)(max_size * 2);
+	if(fifo_shm_attach_region(&consumer, region, region_size) != -5) return -9; /* entries past the region */
+	header->ring.max_size = max_size;
+
+	header->ring.entry_size = 0;
+	if(fifo_shm_attach_region(&consumer, region, region_size) != -5) return -9; /* zero entry size */
+	header->ring.entry_size = sizeof(uint32_t);
+
+	atomic_store(&header->ring.tail, (fifo_index_t)(2 * max_size));
+	if(fifo_shm_attach_region(&consumer, region, region_size) != -5) return -9; /* tail out of range */
+	atomic_store(&header->ring.tail, 3);
+
+	if(fifo_shm_attach_region(&consumer, region, region_size) != 0) return -9; /* restored header rejected */
+	if(fifo_shm_pop_mul(&consumer, out, 3) != 0) return -9;
+	if(memcmp(in, out, sizeof(in)) != 0) return -9; /* wrong data */
+	if(fifo_shm_pop(&consumer, out) != -3) return -9; /* not empty */
+
+	return 0;
+}
+
+/**
+ *	@brief Moves 10 Bytes through uint8_t and SPSC FIFO buffers of 13 entries and a socket pair with write_fd and read_fd
+ *	at every wrap position, so the stored and free spans are split in two iovec at some of them.
+ */
+static int fifo_test_io_run(const int *sv)
+{
+	uint8_t storage[13];
+	uint8_t spsc_storage[13];
+	uint8_t in[10];
+	uint8_t out[10];
+	fifo_uint8_TD fifo;
+	fifo_spsc_uint8_TD spsc;
+	uint8_t seq = 0;
+	fifo_size_t offset = 0;
+	fifo_size_t i = 0;
+
+	fifo_uint8_init(&fifo, storage, 13, true);
+	fifo_spsc_uint8_init(&spsc, spsc_storage, 13, true);
+
+	for(offset = 0; offset < 13; offset++)
+	{
+		for(i = 0; i < sizeof(in); i++) in[i] = seq++;
+
+		if(fifo_uint8_push_mul(&fifo, in, sizeof(in)) != 0) return -12;
+		if(fifo_uint8_write_fd(&fifo, sv[0], 13) != (ssize_t)sizeof(in)) return -12; /* spans not written */
+		if(read(sv[1], out, sizeof(out)) != (ssize_t)sizeof(out)) return -12;
+		if(memcmp(in, out, sizeof(in)) != 0) return -12; /* wrong data */
+
+		if(write(sv[1], in, sizeof(in)) != (ssize_t)sizeof(in)) return -12;
+		if(fifo_uint8_read_fd(&fifo, sv[0], 13) != (ssize_t)sizeof(in)) return -12; /* spans not read */
+		if(fifo_uint8_pop_mul(&fifo, out, sizeof(out)) != 0) return -12;
+		if(memcmp(in, out, sizeof(in)) != 0) return -12; /* wrong data */
+
+		if(fifo_spsc_uint8_push_mul(&spsc, in, sizeof(in)) != 0) return -12;
+		if(fifo_spsc_uint8_write_fd(&spsc, sv[0], 13) != (ssize_t)sizeof(in)) return -12; /* spans not written */
+		if(read(sv[1], out, sizeof(out)) != (ssize_t)sizeof(out)) return -12;
+		if(memcmp(in, out, sizeof(in)) != 0) return -12; /* wrong data */
+
+		if(write(sv[1], in, sizeof(in)) != (ssize_t)sizeof(in)) return -12;
+		if(fifo_spsc_uint8_read_fd(&spsc, sv[0], 13) != (ssize_t)sizeof(in)) return -12; /* spans not read */
+		if(fifo_spsc_uint8_pop_mul(&spsc, out, sizeof(out)) != 0) return -12;
+		if(memcmp(in, out, sizeof(in)) != 0) return -12; /* wrong data */
+
+		if(fifo_uint8_write_fd(&fifo, sv[0], 13) != -4) return -12; /* wrote from empty */
+		if(fifo_uint8_push(&fifo, 0) != 0) return -12; /* move wrap position */
+		if(fifo_uint8_pop(&fifo, &out[0]) != 0) return -12;
+		if(fifo_spsc_uint8_push(&spsc, 0) != 0) return -12;
+		if(fifo_spsc_uint8_pop(&spsc, &out[0]) != 0) return -12;
+	}
+
+	return 0;
+}
+
+/**
+ *	@brief Runs fifo_test_io_run over a local stream socket pair.
+ */
+static int fifo_test_io(void)
+{
+	int sv[2];
+	int ret = 0;
+
+	if(socketpair(AF_UNIX, SOCK_STREAM, 0, sv) != 0) return -12;
+
+	ret = fifo_test_io_run(sv);
+
+	close(sv[0]);
+	close(sv[1]);
+
+	return ret;
+}
+
+#endif
+
+/**
+ *	@brief Checks the ready mask of a FIFO group kept by group push and pop, refreshed after a direct push,
+ *	the pop order of weighted round-robin members of weights 2 and 1, the credit limit of pop_mul
+ *	and the priority order of strict mode.
+ */
+static int fifo_test_group(void)
+{
+	static const uint8_t order[8] = {0, 0, 3, 0, 0, 3, 3, 3};
+	static const uint8_t values[8] = {0, 1, 10, 2, 3, 11, 12, 13};
+	uint8_t storage0[8];
+	uint8_t storage3[8];
+	uint8_t in[8] = {0, 1, 2, 3, 10, 11, 12, 13};
+	uint8_t out[8];
+	fifo_common_TD fifo0;
+	fifo_common_TD fifo3;
+	fifo_group_TD group;
+	uint8_t index = 0;
+	fifo_size_t i = 0;
+
+	fifo_common_init(&fifo0, storage0, 8, 1, true);
+	fifo_common_init(&fifo3, storage3, 8, 1, true);
+
+	if(fifo_group_init(&group, FIFO_GROUP_WRR) != 0) return -10;
+	if(fifo_group_add(&group, 0, &fifo0, 2) != 0) return -10;
+	if(fifo_group_add(&group, 3, &fifo3, 1) != 0) return -10;
+	if(group.ready != 0) return -10; /* empty members marked ready */
+
+	if(fifo_group_push(&group, 3, &in[4]) != 0) return -10;
+	if(group.ready != (1u << 3)) return -10; /* push did not mark member ready */
+	if((fifo_group_pop(&group, out, &index) != 0) || (index != 3) || (out[0] != 10)) return -10;
+	if(group.ready != 0) return -10; /* drained member still ready */
+
+	if(fifo_common_push(&fifo3, &in[4]) != 0) return -10;
+	if(fifo_group_pop(&group, out, &index) != -3) return -10; /* direct push visible before refresh */
+	if(fifo_group_refresh(&group) != 0) return -10;
+	if(group.ready != (1u << 3)) return -10; /* refresh missed the member */
+	if(fifo_group_pop(&group, out, &index) != 0) return -10;
+
+	if(fifo_group_init(&group, FIFO_GROUP_WRR) != 0) return -10; /* full credits for the order check */
+	if(fifo_group_add(&group, 0, &fifo0, 2) != 0) return -10;
+	if(fifo_group_add(&group, 3, &fifo3, 1) != 0) return -10;
+	if(fifo_group_push_mul(&group, 0, in, 4) != 0) return -10;
+	if(fifo_group_push_mul(&group, 3, &in[4], 4) != 0) return -10;
+
+	for(i = 0; i < 8; i++)
+	{
+		if(fifo_group_pop(&group, out, &index) != 0) return -10;
+		if((index != order[i]) || (out[0] != values[i])) return -10; /* wrong round-robin order */
+	}
+
+	if(fifo_group_pop(&group, out, &index) != -3) return -10; /* not empty */
+
+	if(fifo_group_push_mul(&group, 0, in, 4) != 0) return -10;
+	if((fifo_group_pop_mul(&group, out, 8, &index) != 2) || (index != 0)) return -10; /* popped past the weight */
+	if(fifo_group_pop_mul(&group, out, 8, &index) != 2) return -10;
+
+	if(fifo_group_init(&group, FIFO_GROUP_STRICT) != 0) return -10;
+	if(fifo_group_add(&group, 0, &fifo0, 0) != 0) return -10;
+	if(fifo_group_add(&group, 3, &fifo3, 0) != 0) return -10;
+	if(fifo_group_push_mul(&group, 3, &in[4], 4) != 0) return -10;
+	if(fifo_group_push_mul(&group, 0, in, 2) != 0) return -10;
+	if((fifo_group_pop_mul(&group, out, 8, &index) != 2) || (index != 0)) return -10; /* lower priority first */
+	if((fifo_group_pop_mul(&group, out, 8, &index) != 4) || (index != 3)) return -10;
+	if(memcmp(out, &in[4], 4) != 0) return -10; /* wrong data */
+
+	return 0;
+}
+
+/**
+ *	@brief Checks a FIFO pool of three slots in a stack arena: exhaustion, reuse of released slots by common
+ *	and SPSC FIFO buffers, and the rejection of foreign pointers, double releases and overwritten slot states.
+ */
+static int fifo_test_pool(void)
+{
+	_Alignas(FIFO_CACHE_LINE_SIZE) uint8_t arena[2048];
+	fifo_pool_TD pool;
+	fifo_common_TD *fifo[3];
+	fifo_spsc_common_TD *spsc = NULL;
+	fifo_pool_desc_TD *desc = NULL;
+	uint8_t val = 0x5A;
+	size_t arena_size = fifo_pool_arena_size(3, 4, 1);
+	uint32_t i = 0;
+
+	if((arena_size == 0) || (arena_size > sizeof(arena))) return -11; /* slots larger than expected */
+	if(fifo_pool_init(&pool, arena, arena_size, 4, 1) != 0) return -11;
+
+	for(i = 0; i < 3; i++)
+	{
+		fifo[i] = fifo_pool_acquire_common(&pool, true);
+		if(fifo[i] == NULL) return -11;
+		if(fifo_common_push(fifo[i], &val) != 0) return -11; /* storage not usable */
+	}
+
+	if(fifo_pool_acquire_common(&pool, true) != NULL) return -11; /* more slots than the arena holds */
+	if(fifo_pool_release(&pool, &val) != -3) return -11; /* foreign pointer */
+	if(fifo_pool_release(&pool, ((uint8_t *)fifo[1] + 1)) != -3) return -11; /* not a slot */
+
+	if(fifo_pool_release(&pool, fifo[1]) != 0) return -11;
+	if(fifo_pool_release(&pool, fifo[1]) != -5) return -11; /* double release */
+	if(pool.free_count != 1) return -11; /* double release changed the free list */
+
+	spsc = fifo_pool_acquire_spsc(&pool, true);
+	if((void *)spsc != (void *)fifo[1]) return -11; /* released slot not reused */
+	if(fifo_spsc_common_push(spsc, &val) != 0) return -11;
+
+	desc = (fifo_pool_desc_TD *)(void *)fifo[2];
+	desc->state = 0;
+	if(fifo_pool_release(&pool, fifo[2]) != -6) return -11; /* overwritten state */
+	desc->state = FIFO_POOL_USED;
+
+	if(fifo_pool_release(&pool, spsc) != 0) return -11;
+	if(fifo_pool_release(&pool, fifo[2]) != 0) return -11;
+	if(fifo_pool_release(&pool, fifo[0]) != 0) return -11;
+	if(pool.free_count != 3) return -11;
+	if(fifo_pool_release(&pool, fifo[0]) != -5) return -11; /* double release */
+
+	return 0;
+}
+
+#if (FIFO_STATS == 1)
+
+/**
+ *	@brief Returns true when a snapshot of stats holds the expected counters, the cycle counters are not checked.
+ */
+static bool fifo_test_stats_expect(fifo_stats_TD *stats, uint64_t pushed, uint64_t push_rejects, fifo_size_t high_water, uint64_t popped, uint64_t pop_rejects)
+{
+	fifo_stats_snapshot_TD snapshot;
+
+	if(fifo_stats_snapshot(stats, &snapshot) != 0) return false;
+
+	return ((snapshot.pushed == pushed) && (snapshot.push_rejects == push_rejects) && (snapshot.high_water == high_water) &&
+			(snapshot.popped == popped) && (snapshot.pop_rejects == pop_rejects));
+}
+
+/**
+ *	@brief Checks statistics of template, common and SPSC FIFO buffers of 5 entries: push_mul/pop_mul, write_some/read_some
+ *	and rejected calls with full and empty buffers, then fifo_stats_reset and the NULL checks of the stats functions.
+ */
+static int fifo_test_stats(void)
+{
+	uint8_t storage8[5];
+	uint8_t storage[5 * 3];
+	uint8_t spsc_storage[5];
+	uint8_t in[6 * 3];
+	uint8_t out[6 * 3];
+	fifo_uint8_TD fifo8;
+	fifo_common_TD fifo;
+	fifo_spsc_uint8_TD spsc;
+	fifo_stats_snapshot_TD snapshot;
+
+	memset(in, 0x3C, sizeof(in));
+
+	fifo_uint8_init(&fifo8, storage8, 5, true);
+
+	if(fifo_uint8_push_mul(&fifo8, in, 3) != 0) return -7;
+	if(fifo_uint8_push_mul(&fifo8, in, 3) != -4) return -7; /* reject, 2 free */
+	if(fifo_uint8_write_some(&fifo8, in, 5) != 2) return -7;
+	if(fifo_uint8_push(&fifo8, 0) != -2) return -7; /* reject, full */
+	if(fifo_uint8_pop_mul(&fifo8, out, 6) != -4) return -7; /* reject, 5 stored */
+	if(fifo_uint8_read_some(&fifo8, out, 4) != 4) return -7;
+	if(fifo_uint8_pop_mul(&fifo8, out, 1) != 0) return -7;
+	if(fifo_uint8_pop(&fifo8, out) != -3) return -7; /* reject, empty */
+	if(!fifo_test_stats_expect(&fifo8.stats, 5, 2, 5, 5, 2)) return -7; /* wrong template counters */
+
+	if(fifo_stats_reset(&fifo8.stats) != 0) return -7;
+	if(!fifo_test_stats_expect(&fifo8.stats, 0, 0, 0, 0, 0)) return -7; /* not reset */
+	if(fifo_uint8_push_mul(&fifo8, in, 2) != 0) return -7;
+	if(!fifo_test_stats_expect(&fifo8.stats, 2, 0, 2, 0, 0)) return -7; /* high water not restarted */
+
+	fifo_common_init(&fifo, storage, 5, 3, true);
+
+	if(fifo_common_push_mul(&fifo, in, 3) != 0) return -7;
+	if(fifo_common_push_mul(&fifo, in, 3) != -4) return -7; /* reject, 2 free */
+	if(fifo_common_write_some(&fifo, in, 5) != 2) return -7;
+	if(fifo_common_push(&fifo, in) != -3) return -7; /* reject, full */
+	if(fifo_common_pop_mul(&fifo, out, 6) != -4) return -7; /* reject, 5 stored */
+	if(fifo_common_read_some(&fifo, out, 4) != 4) return -7;
+	if(fifo_common_pop_mul(&fifo, out, 1) != 0) return -7;
+	if(fifo_common_pop(&fifo, out) != -3) return -7; /* reject, empty */
+	if(!fifo_test_stats_expect(&fifo.stats, 5, 2, 5, 5, 2)) return -7; /* wrong common counters */
+
+	if(fifo_stats_reset(&fifo.stats) != 0) return -7;
+	if(!fifo_test_stats_expect(&fifo.stats, 0, 0, 0, 0, 0)) return -7; /* not reset */
+
+	fifo_spsc_uint8_init(&spsc, spsc_storage, 5, true);
+
+	if(fifo_spsc_uint8_push_mul(&spsc, in, 3) != 0) return -7;
+	if(fifo_spsc_uint8_push_mul(&spsc, in, 3) != -4) return -7; /* reject, 2 free */
+	if(fifo_spsc_uint8_write_some(&spsc, in, 5) != 2) return -7;
+	if(fifo_spsc_uint8_push(&spsc, 0) != -2) return -7; /* reject, full */
+	if(fifo_spsc_uint8_pop_mul(&spsc, out, 6) != -4) return -7; /* reject, 5 stored */
+	if(fifo_spsc_uint8_read_some(&spsc, out, 4) != 4) return -7;
+	if(fifo_spsc_uint8_pop_mul(&spsc, out, 1) != 0) return -7;
+	if(fifo_spsc_uint8_pop(&spsc, out) != -3) return -7; /* reject, empty */
+	if(!fifo_test_stats_expect(&spsc.ring.stats, 5, 2, 5, 5, 2)) return -7; /* wrong SPSC counters */
+
+	if(fifo_stats_reset(&spsc.ring.stats) != 0) return -7;
+	if(!fifo_test_stats_expect(&spsc.ring.stats, 0, 0, 0, 0, 0)) return -7; /* not reset */
+
+	if(fifo_stats_reset(NULL) != -1) return -7;
+	if(fifo_stats_snapshot(NULL, &snapshot) != -1) return -7;
+	if(fifo_stats_snapshot(&spsc.ring.stats, NULL) != -2) return -7;
+
+	return 0;
+}
+
+#endif
+
+/**
+ *	@brief Self-test of FIFO buffers: single and multiple push/pop with sequence-checked payloads across every
+ *	wrap position of small buffers, the full/empty rejections of the mul functions, and the SIMD kernels,
+ *	uint16_t reductions and converting pops against scalar results for 0, 0xFFFF and mixed samples.
+ *	Also the ready mask and the scheduling order of a FIFO group and the release checks of a FIFO pool.
+ *	With FIFO_STATS also the statistics counters of template, common and SPSC FIFO buffers.
+ *	On Linux also the contiguous spans of a mirrored FIFO buffer, which maps one page, the attach checks of a shared FIFO buffer
+ *	and the read_fd/write_fd functions of uint8_t and SPSC FIFO buffers over a socket pair.
+ *	Takes no arguments and uses only stack storage, apart from the mapping and the sockets on Linux, may be called from a target at boot.
+ *
+ *	@retval returns: 0 - all checks passed
+ *					-1 - uint8_t FIFO buffer returned wrong data or state
+ *					-2 - common FIFO buffer returned wrong data or state
+ *					-3 - a mul function accepted more entries than stored or free
+ *					-4 - a SIMD kernel differs from the scalar result
+ *					-5 - a uint16_t sum, min/max, decimation or moving-average pop differs from the scalar result
+ *					-6 - a converting pop differs from the scalar result
+ *					-7 - statistics counters are wrong, only with FIFO_STATS
+ *					-8 - a mirrored FIFO buffer span is not contiguous across the wrap, only on Linux
+ *					-9 - a shared FIFO buffer attached to a corrupted header or moved wrong data, only on Linux
+ *					-10 - a FIFO group kept a wrong ready mask or popped members out of order
+ *					-11 - a FIFO pool gave out a wrong slot or accepted a foreign or double release
+ *					-12 - read_fd or write_fd moved wrong data across the wrap, only on Linux
+ */
+int fifo_test(void)
+{
+	uint8_t storage8[7];
+	uint8_t storage[7 * 3];
+	uint8_t in[7 * 3];
+	uint8_t out[7 * 3];
+	fifo_uint8_TD fifo8;
+	fifo_common_TD fifo;
+	uint8_t seq_in = 0;
+	fifo_size_t offset = 0;
+	fifo_size_t m = 0;
+	fifo_size_t i = 0;
+	int ret = 0;
+
+	fifo_uint8_init(&fifo8, storage8, 7, true);
+	fifo_common_init(&fifo, storage, 7, 3, true);
+
+	for(offset = 0; offset < 7; offset++)
+	{
+		for(m = 1; m <= 7; m++)
+		{
+			for(i = 0; i < m; i++) in[i] = seq_in++;
+
+			if(fifo_uint8_push_mul(&fifo8, in, m) != 0) return -1; /* push rejected */
+			if(fifo_uint8_pop_mul(&fifo8, out, m) != 0) return -1; /* pop rejected */
+			if(memcmp(in, out, m) != 0) return -1; /* wrong data */
+		}
+
+		if(fifo_uint8_push(&fifo8, seq_in) != 0) return -1; /* move wrap position */
+		if((fifo_uint8_pop(&fifo8, &out[0]) != 0) || (out[0] != seq_in++)) return -1; /* wrong data */
+	}
+
+	for(offset = 0; offset < 7; offset++)
+	{
+		for(m = 1; m <= 7; m++)
+		{
+			for(i = 0; i < (m * 3); i++) in[i] = seq_in++;
+
+			if(fifo_common_push_mul(&fifo, in, m) != 0) return -2; /* push rejected */
+			if(fifo_common_pop_mul(&fifo, out, m) != 0) return -2; /* pop rejected */
+
+			if(memcmp(in, out, ((size_t)m * 3)) != 0) return -2; /* wrong data */
+		}
+
+		if(fifo_common_push(&fifo, in) != 0) return -2; /* move wrap position */
+		if(fifo_common_pop(&fifo, out) != 0) return -2;
+		if(memcmp(in, out, 3) != 0) return -2; /* wrong data */
+		if(fifo.free_size != fifo.max_size) return -2; /* FIFO not empty */
+	}
+
+	if(fifo_common_push_mul(&fifo, in, 4) != 0) return -2;
+	if(fifo_common_pop_mul(&fifo, out, 5) != -4) return -3; /* popped more than stored */
+	if(fifo_common_push_mul(&fifo, in, 4) != -4) return -3; /* pushed more than free */
+	if(fifo_common_read_some(&fifo, out, 7) != 4) return -2; /* wrong amount */
+	if(fifo_uint8_pop_mul(&fifo8, out, 1) != -4) return -3; /* popped from empty */
+
+	ret = fifo_test_simd();
+	if(ret != 0) return ret;
+
+	ret = fifo_test_uint16();
+	if(ret != 0) return ret;
+
+	ret = fifo_test_group();
+	if(ret != 0) return ret;
+
+	ret = fifo_test_pool();
+	if(ret != 0) return ret;
+
+#if (FIFO_STATS == 1)
+	ret = fifo_test_stats();
+	if(ret != 0) return ret;
+#endif
+
+#if defined(__linux__)
+	ret = fifo_test_mirror();
+	if(ret != 0) return ret;
+
+	ret = fifo_test_shm();
+	if(ret != 0) return ret;
+
+	ret = fifo_test_io();
+	if(ret != 0) return ret;
+#endif
+
+	return 0;
+}
+
+/**
+* 	@}
+*/
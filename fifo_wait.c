@@ -0,0 +1,376 @@
+/**
+ * 	@file fifo_wait.c
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Implementation of blocking layer on top of SPSC FIFO buffers.
+ *  Alert: fifo_wait_data/fifo_wait_pop must be called from the consumer context only and
+ *  fifo_wait_space/fifo_wait_push from the producer context only.
+ *
+ */
+
+#if (defined(__linux__) && !defined(_GNU_SOURCE))
+#define _GNU_SOURCE
+#endif
+
+#include "fifo_wait.h"
+
+#if (FIFO_WAIT_FUTEX == 1)
+#include <time.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
+
+/**
+*	@addtogroup Software_FIFO_buffer Software FIFO buffers
+* 	@{
+*/
+
+/**
+*	@addtogroup wait_FIFO_buffer blocking FIFO buffer layer
+* 	@{
+*/
+
+#if (FIFO_WAIT_FUTEX == 1)
+
+/**
+ *	@brief Returns monotonic time in milliseconds.
+ */
+static inline uint32_t fifo_wait_time_ms(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint32_t)(((uint64_t)ts.tv_sec * 1000u) + ((uint64_t)ts.tv_nsec / 1000000u));
+}
+
+/**
+ *	@brief Sleeps on futex word while it holds expected. Not private, so rings in shared memory work too.
+ */
+static inline int fifo_wait_sleep(_Atomic uint32_t *word, uint32_t expected, uint32_t timeout_ms)
+{
+	struct timespec ts;
+	struct timespec *tsp = NULL;
+
+	if(timeout_ms != FIFO_WAIT_FOREVER)
+	{
+		ts.tv_sec = (time_t)(timeout_ms / 1000u);
+		ts.tv_nsec = (long)((timeout_ms % 1000u) * 1000000u);
+		tsp = &ts;
+	}
+
+	if((syscall(SYS_futex, (uint32_t *)word, FUTEX_WAIT, expected, tsp, NULL, 0) != 0) && (errno == ETIMEDOUT)) return -5; /* timeout */
+
+	return 0;
+}
+
+/**
+ *	@brief Wakes the context sleeping on futex word.
+ */
+static inline void fifo_wait_wake(_Atomic uint32_t *word)
+{
+	syscall(SYS_futex, (uint32_t *)word, FUTEX_WAKE, 1, NULL, NULL, 0);
+}
+
+#else
+
+#define fifo_wait_time_ms()						fifo_wait_port_time_ms()
+#define fifo_wait_sleep(word, expected, timeout)	fifo_wait_port_sleep((word), (expected), (timeout))
+#define fifo_wait_wake(word)						fifo_wait_port_wake(word)
+
+#endif
+
+/**
+ *	@brief Returns time left until deadline, FIFO_WAIT_FOREVER passes through.
+ */
+static inline uint32_t fifo_wait_remaining(uint32_t timeout_ms, uint32_t start_ms)
+{
+	uint32_t passed = 0;
+
+	if(timeout_ms == FIFO_WAIT_FOREVER) return FIFO_WAIT_FOREVER;
+
+	passed = fifo_wait_time_ms() - start_ms;
+
+	return (passed >= timeout_ms) ? 0 : (timeout_ms - passed);
+}
+
+/**
+ *	@brief Sleeps on seq until level() reaches n. Shared by data and space waits.
+ *
+ *	The waiter publishes need and re-checks the level after a full fence, the notifier
+ *	publishes its index and checks need after a full fence, so a wakeup can not be lost.
+ */
+static int fifo_wait_level(_Atomic uint32_t *seq, _Atomic fifo_size_t *need, fifo_spsc_ring_TD *ring, fifo_size_t n, uint32_t timeout_ms, bool space)
+{
+	uint32_t start_ms = 0;
+	uint32_t left = timeout_ms;
+	uint32_t expected = 0;
+	fifo_size_t level = 0;
+
+	if((timeout_ms != 0) && (timeout_ms != FIFO_WAIT_FOREVER)) start_ms = fifo_wait_time_ms();
+
+	for(;;)
+	{
+		level = fifo_spsc_ring_count(ring);
+		if(space) level = ring->max_size - level;
+		if(level >= n) return 0;
+		if(left == 0) return -5; /* timeout */
+
+		expected = atomic_load_explicit(seq, memory_order_relaxed);
+		atomic_store_explicit(need, n, memory_order_relaxed);
+		atomic_thread_fence(memory_order_seq_cst);
+
+		level = fifo_spsc_ring_count(ring);
+		if(space) level = ring->max_size - level;
+
+		if(level < n) (void)fifo_wait_sleep(seq, expected, left);
+
+		atomic_store_explicit(need, 0, memory_order_relaxed);
+		left = fifo_wait_remaining(timeout_ms, start_ms);
+	}
+}
+
+/**
+ *	@brief Wakes the waiter of seq when its need is reached. Shared by data and space notifies.
+ */
+static inline void fifo_wait_wake_level(_Atomic uint32_t *seq, _Atomic fifo_size_t *need, fifo_spsc_ring_TD *ring, bool space)
+{
+	fifo_size_t n = 0;
+	fifo_size_t level = 0;
+
+	atomic_thread_fence(memory_order_seq_cst);
+
+	n = atomic_load_explicit(need, memory_order_relaxed);
+	if(n == 0) return; /* nobody waits */
+
+	level = fifo_spsc_ring_count(ring);
+	if(space) level = ring->max_size - level;
+	if(level < n) return; /* threshold not reached */
+
+	if(!atomic_compare_exchange_strong_explicit(need, &n, 0, memory_order_relaxed, memory_order_relaxed)) return; /* already woken */
+
+	atomic_fetch_add_explicit(seq, 1, memory_order_release);
+	fifo_wait_wake(seq);
+}
+
+/**
+ *	@brief Creates wait state of SPSC FIFO buffer.
+ *
+ *	@param wait - pointer to the wait state
+ *
+ *	@retval returns: 0 - wait state created successfully
+ *					-1 - wait pointer is NULL
+ */
+int fifo_wait_init(fifo_wait_TD *wait)
+{
+	if(wait == NULL) return -1; /* wait pointer NULL */
+
+	atomic_init(&wait->data_seq, 0);
+	atomic_init(&wait->data_need, 0);
+	atomic_init(&wait->space_seq, 0);
+	atomic_init(&wait->space_need, 0);
+
+	return 0;
+}
+
+/**
+ *	@brief Waits until SPSC FIFO buffer holds at least n entries. Consumer side only.
+ *
+ *	@param wait - pointer to the wait state
+ *	@param ring - pointer to the SPSC ring state
+ *	@param n - amount of entries to wait for
+ *	@param timeout_ms - timeout in milliseconds, 0 - do not sleep, FIFO_WAIT_FOREVER - no timeout
+ *
+ *	@retval returns:	0 - FIFO buffer holds n entries
+ *					-1 - wait or ring pointer is NULL
+ *					-3 - amount of the entries is zero
+ *					-4 - FIFO buffer max size lower than n
+ *					-5 - timeout
+ */
+int fifo_wait_data(fifo_wait_TD *wait, fifo_spsc_ring_TD *ring, fifo_size_t n, uint32_t timeout_ms)
+{
+	if((wait == NULL) || (ring == NULL)) return -1; /* pointer NULL */
+	if(n == 0) return -3; /* zero n */
+	if(n > ring->max_size) return -4; /* max size lower than n */
+
+	return fifo_wait_level(&wait->data_seq, &wait->data_need, ring, n, timeout_ms, false);
+}
+
+/**
+ *	@brief Waits until SPSC FIFO buffer has place for at least n entries. Producer side only.
+ *
+ *	@param wait - pointer to the wait state
+ *	@param ring - pointer to the SPSC ring state
+ *	@param n - amount of free entries to wait for
+ *	@param timeout_ms - timeout in milliseconds, 0 - do not sleep, FIFO_WAIT_FOREVER - no timeout
+ *
+ *	@retval returns:	0 - FIFO buffer has place for n entries
+ *					-1 - wait or ring pointer is NULL
+ *					-3 - amount of the entries is zero
+ *					-4 - FIFO buffer max size lower than n
+ *					-5 - timeout
+ */
+int fifo_wait_space(fifo_wait_TD *wait, fifo_spsc_ring_TD *ring, fifo_size_t n, uint32_t timeout_ms)
+{
+	if((wait == NULL) || (ring == NULL)) return -1; /* pointer NULL */
+	if(n == 0) return -3; /* zero n */
+	if(n > ring->max_size) return -4; /* max size lower than n */
+
+	return fifo_wait_level(&wait->space_seq, &wait->space_need, ring, n, timeout_ms, true);
+}
+
+/**
+ *	@brief Wakes the consumer if it waits for the amount of entries now stored. Producer side only.
+ *	Must be called after every push/commit done with non-waiting SPSC functions.
+ *
+ *	@param wait - pointer to the wait state
+ *	@param ring - pointer to the SPSC ring state
+ */
+void fifo_wait_notify_data(fifo_wait_TD *wait, fifo_spsc_ring_TD *ring)
+{
+	if((wait == NULL) || (ring == NULL)) return; /* pointer NULL */
+
+	fifo_wait_wake_level(&wait->data_seq, &wait->data_need, ring, false);
+}
+
+/**
+ *	@brief Wakes the producer if it waits for the amount of free entries now available. Consumer side only.
+ *	Must be called after every pop/release done with non-waiting SPSC functions.
+ *
+ *	@param wait - pointer to the wait state
+ *	@param ring - pointer to the SPSC ring state
+ */
+void fifo_wait_notify_space(fifo_wait_TD *wait, fifo_spsc_ring_TD *ring)
+{
+	if((wait == NULL) || (ring == NULL)) return; /* pointer NULL */
+
+	fifo_wait_wake_level(&wait->space_seq, &wait->space_need, ring, true);
+}
+
+/**
+ *	@brief Pops m entries from SPSC FIFO buffer, sleeps while it holds less than m. Consumer side only.
+ *
+ *	@param wait - pointer to the wait state
+ *	@param ring - pointer to the SPSC ring state
+ *	@param buffer - pointer to buffer that stores values
+ *	@param pop_buffer - pointer to the buffer into which the values will be popped
+ *	@param m - amount of entries to be popped
+ *	@param timeout_ms - timeout in milliseconds, 0 - do not sleep, FIFO_WAIT_FOREVER - no timeout
+ *
+ *	@retval returns:	0 - all of the m entries was popped
+ *					-1 - wait or ring pointer is NULL
+ *					-2 - buffer or pop buffer pointer is NULL
+ *					-3 - amount of the entries to be popped is zero
+ *					-4 - FIFO buffer max size lower than m
+ *					-5 - timeout
+ */
+int fifo_wait_pop(fifo_wait_TD *wait, fifo_spsc_ring_TD *ring, const void *buffer, void *pop_buffer, fifo_size_t m, uint32_t timeout_ms)
+{
+	int result = 0;
+
+	if((wait == NULL) || (ring == NULL)) return -1; /* pointer NULL */
+	if((buffer == NULL) || (pop_buffer == NULL)) return -2; /* buffer pointer NULL */
+	if(m == 0) return -3; /* zero m */
+	if(m > ring->max_size) return -4; /* max size lower than m */
+
+	result = fifo_spsc_ring_pop_mul(ring, buffer, pop_buffer, m);
+
+	if(result == -4)
+	{
+		result = fifo_wait_level(&wait->data_seq, &wait->data_need, ring, m, timeout_ms, false);
+		if(result != 0) return result;
+
+		result = fifo_spsc_ring_pop_mul(ring, buffer, pop_buffer, m);
+	}
+
+	if(result == 0) fifo_wait_wake_level(&wait->space_seq, &wait->space_need, ring, true);
+
+	return result;
+}
+
+/**
+ *	@brief Pops up to max entries from SPSC FIFO buffer in one operation with a single head store. Consumer side only.
+ *	Sleeps at most timeout_ms while less than min entries are stored, then takes whatever arrived,
+ *	so the batch grows with the load and latency stays bounded by the deadline.
+ *
+ *	@param wait - pointer to the wait state
+ *	@param ring - pointer to the SPSC ring state
+ *	@param buffer - pointer to buffer that stores values
+ *	@param pop_buffer - pointer to the buffer into which the values will be popped
+ *	@param min - amount of entries worth returning before the deadline, clamped to max and FIFO buffer size
+ *	@param max - maximal amount of entries to be popped
+ *	@param timeout_ms - deadline in milliseconds, 0 - do not sleep, FIFO_WAIT_FOREVER - wait for min entries
+ *
+ *	@retval returns: amount of entries popped, 0 if nothing arrived before the deadline or any pointer is NULL
+ */
+fifo_size_t fifo_wait_drain(fifo_wait_TD *wait, fifo_spsc_ring_TD *ring, const void *buffer, void *pop_buffer, fifo_size_t min, fifo_size_t max, uint32_t timeout_ms)
+{
+	fifo_size_t n = 0;
+
+	if((wait == NULL) || (ring == NULL)) return 0; /* pointer NULL */
+	if((buffer == NULL) || (pop_buffer == NULL)) return 0; /* buffer pointer NULL */
+	if(max == 0) return 0; /* zero max */
+
+	if(min > max) min = max;
+	if(min > ring->max_size) min = ring->max_size;
+
+	if((min != 0) && (fifo_spsc_ring_count(ring) < min)) (void)fifo_wait_level(&wait->data_seq, &wait->data_need, ring, min, timeout_ms, false);
+
+	n = fifo_spsc_ring_read_some(ring, buffer, pop_buffer, max);
+	if(n != 0) fifo_wait_wake_level(&wait->space_seq, &wait->space_need, ring, true);
+
+	return n;
+}
+
+/**
+ *	@brief Pushes m entries into SPSC FIFO buffer, sleeps while there is no place for m. Producer side only.
+ *
+ *	@param wait - pointer to the wait state
+ *	@param ring - pointer to the SPSC ring state
+ *	@param buffer - pointer to buffer that stores values
+ *	@param push_buffer - pointer to the buffer from which the values will be pushed
+ *	@param m - amount of entries to be pushed
+ *	@param timeout_ms - timeout in milliseconds, 0 - do not sleep, FIFO_WAIT_FOREVER - no timeout
+ *
+ *	@retval returns:	0 - all of the m entries was pushed
+ *					-1 - wait or ring pointer is NULL
+ *					-2 - buffer or push buffer pointer is NULL
+ *					-3 - amount of the entries to be pushed is zero
+ *					-4 - FIFO buffer max size lower than m
+ *					-5 - timeout
+ */
+int fifo_wait_push(fifo_wait_TD *wait, fifo_spsc_ring_TD *ring, void *buffer, const void *push_buffer, fifo_size_t m, uint32_t timeout_ms)
+{
+	int result = 0;
+
+	if((wait == NULL) || (ring == NULL)) return -1; /* pointer NULL */
+	if((buffer == NULL) || (push_buffer == NULL)) return -2; /* buffer pointer NULL */
+	if(m == 0) return -3; /* zero m */
+	if(m > ring->max_size) return -4; /* max size lower than m */
+
+	result = fifo_spsc_ring_push_mul(ring, buffer, push_buffer, m);
+
+	if(result == -4)
+	{
+		result = fifo_wait_level(&wait->space_seq, &wait->space_need, ring, m, timeout_ms, true);
+		if(result != 0) return result;
+
+		result = fifo_spsc_ring_push_mul(ring, buffer, push_buffer, m);
+	}
+
+	if(result == 0) fifo_wait_wake_level(&wait->data_seq, &wait->data_need, ring, false);
+
+	return result;
+}
+
+/**
+* 	@}
+*/
+
+/**
+* 	@}
+*/
@@ -0,0 +1,64 @@
+/**
+ * 	@file fifo_wait.h
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Blocking layer on top of SPSC FIFO buffers.
+ *  Push and pop stay lock-free; a side sleeps only when the FIFO is empty/full for its request
+ *  and the other side wakes it only when the requested threshold is reached.
+ *  The non-waiting side pays one fence and one load per notify when nobody is waiting.
+ *
+ *  With FIFO_WAIT_FUTEX = 0 the user provides:
+ *  	int fifo_wait_port_sleep(_Atomic uint32_t *word, uint32_t expected, uint32_t timeout_ms);
+ *  		sleeps while *word == expected, at most timeout_ms; returns 0 when woken, -5 on timeout
+ *  	void fifo_wait_port_wake(_Atomic uint32_t *word);
+ *  		wakes the context sleeping on word
+ *  	uint32_t fifo_wait_port_time_ms(void);
+ *  		returns monotonic time in milliseconds (e.g. RTOS tick count)
+ */
+
+#ifndef FIFO_WAIT_H_
+#define FIFO_WAIT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "fifo_config.h"
+#include "fifo_spsc.h"
+
+/**
+* 	@brief	Timeout value that makes fifo_wait functions wait without limit.
+*/
+#define FIFO_WAIT_FOREVER		UINT32_MAX
+
+/**
+* 	@brief	Wait state of one SPSC FIFO buffer: the consumer waits for data, the producer waits for space.
+*/
+typedef struct
+{
+	_Atomic uint32_t data_seq;		/**< Wait word of the consumer, bumped when data_need is reached */
+	_Atomic fifo_size_t data_need;	/**< Amount of entries the consumer waits for, 0 if not waiting */
+
+	_Atomic uint32_t space_seq;		/**< Wait word of the producer, bumped when space_need is reached */
+	_Atomic fifo_size_t space_need;	/**< Amount of free entries the producer waits for, 0 if not waiting */
+
+}fifo_wait_TD;
+
+#if (FIFO_WAIT_FUTEX == 0)
+int fifo_wait_port_sleep(_Atomic uint32_t *word, uint32_t expected, uint32_t timeout_ms);
+void fifo_wait_port_wake(_Atomic uint32_t *word);
+uint32_t fifo_wait_port_time_ms(void);
+#endif
+
+int fifo_wait_init(fifo_wait_TD *wait);
+int fifo_wait_data(fifo_wait_TD *wait, fifo_spsc_ring_TD *ring, fifo_size_t n, uint32_t timeout_ms);
+int fifo_wait_space(fifo_wait_TD *wait, fifo_spsc_ring_TD *ring, fifo_size_t n, uint32_t timeout_ms);
+void fifo_wait_notify_data(fifo_wait_TD *wait, fifo_spsc_ring_TD *ring);
+void fifo_wait_notify_space(fifo_wait_TD *wait, fifo_spsc_ring_TD *ring);
+int fifo_wait_pop(fifo_wait_TD *wait, fifo_spsc_ring_TD *ring, const void *buffer, void *pop_buffer, fifo_size_t m, uint32_t timeout_ms);
+fifo_size_t fifo_wait_drain(fifo_wait_TD *wait, fifo_spsc_ring_TD *ring, const void *buffer, void *pop_buffer, fifo_size_t min, fifo_size_t max, uint32_t timeout_ms);
+int fifo_wait_push(fifo_wait_TD *wait, fifo_spsc_ring_TD *ring, void *buffer, const void *push_buffer, fifo_size_t m, uint32_t timeout_ms);
+
+#endif /* FIFO_WAIT_H_ */
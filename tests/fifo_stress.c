@@ -0,0 +1,2084 @@
+/**
+ * 	@file fifo_stress.c
+ *
+ *  @date Created on: 14-10-2026
+ *  @author Author: v.fesiienko
+ *
+ *  Concurrency stress and correctness test of software FIFO buffers.
+ *  Every mode moves sequence-numbered entries between producer and consumer threads (processes for shm) and checks
+ *  that nothing is lost, duplicated, reordered or torn. Threads call sched_yield() at random
+ *  points to shake out other interleavings, so the test is meaningful on one CPU and under
+ *  ThreadSanitizer/AddressSanitizer builds (see FIFO_SANITIZE in CMakeLists.txt).
+ *  Prints one JSON object per mode, see print_result() for the fields, and exits with 1 on any failure.
+ *  Usage: fifo_stress [--quick]
+ *
+ */
+
+#define _GNU_SOURCE
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+
+#include "fifo.h"
+#include "fifo_spsc.h"
+#include "fifo_mpmc.h"
+#include "fifo_mpsc.h"
+#include "fifo_lossy.h"
+#include "fifo_msg.h"
+#include "fifo_shard.h"
+#include "fifo_pow2.h"
+#include "fifo_group.h"
+#include "fifo_pool.h"
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/wait.h>
+#include "fifo_file.h"
+#include "fifo_mirror.h"
+#include "fifo_shm.h"
+#include "fifo_wait.h"
+#include "fifo_event.h"
+#endif
+
+/**
+* 	@brief	Upper bound of threads on one side of a FIFO buffer.
+*/
+#define STRESS_MAX_THREADS		8
+
+/**
+* 	@brief	Capacity of the multi-threaded FIFO buffers, small to keep them full/empty most of the time.
+*/
+#define STRESS_CAPACITY			64
+
+/**
+* 	@brief	Largest batch of mul/some functions.
+*/
+#define STRESS_MAX_BATCH		16
+
+/**
+* 	@brief	Deadline of blocking calls of wait and event modes in milliseconds, reaching it means a lost wakeup.
+*/
+#define STRESS_WAIT_MS			10000
+
+/**
+* 	@brief	Checks cond, reports the first failure and counts all of them.
+*/
+#define STRESS_CHECK(cond)		do { if(!(cond)) stress_fail(#cond, __LINE__); } while(0)
+
+/**
+* 	@brief	Arguments of one stress thread.
+*/
+typedef struct
+{
+	uint32_t id;		/**< Index of the thread on its side of the FIFO buffer */
+	uint64_t rng;		/**< xorshift64 state of the thread */
+
+}stress_thread_TD;
+
+static uint32_t stress_items = 200000;			/**< Entries sent by every producer */
+static uint32_t stress_producers = 4;			/**< Producers of multi-producer modes */
+static uint32_t stress_consumers = 2;			/**< Consumers of multi-consumer modes */
+
+static _Atomic uint32_t stress_errors;			/**< Failed checks of all modes */
+static _Atomic uint32_t stress_done;			/**< Producers that sent all of their entries */
+
+/**
+ *	@brief Returns monotonic time in nanoseconds.
+ */
+static inline uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ((uint64_t)ts.tv_sec * 1000000000u) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ *	@brief Counts a failed check, prints the first few of them.
+ */
+static void stress_fail(const char *cond, int line)
+{
+	if(atomic_fetch_add(&stress_errors, 1) < 8) fprintf(stderr, "fifo_stress: line %d: check failed: %s\n", line, cond);
+}
+
+/**
+ *	@brief Returns next value of xorshift64 generator.
+ */
+static inline uint64_t stress_rand(uint64_t *state)
+{
+	uint64_t x = *state;
+
+	x ^= (x << 13);
+	x ^= (x >> 7);
+	x ^= (x << 17);
+	*state = x;
+
+	return x;
+}
+
+/**
+ *	@brief Returns random batch size in range 1..max.
+ */
+static inline uint32_t stress_batch(uint64_t *state, uint32_t max)
+{
+	return (uint32_t)(1 + (stress_rand(state) % max));
+}
+
+/**
+ *	@brief Yields the CPU at one of 64 calls on average, lets the other side run mid-operation.
+ */
+static inline void stress_perturb(uint64_t *state)
+{
+	if((stress_rand(state) & 63) == 0) sched_yield();
+}
+
+/**
+ *	@brief Prints result of a stress mode.
+ */
+static void print_result(const char *mode, uint32_t producers, uint32_t consumers, uint64_t entries, uint64_t ns, uint32_t errors)
+{
+	printf("{\"stress\":\"%s\",\"producers\":%lu,\"consumers\":%lu,\"entries\":%llu,\"ms\":%.3f,\"ops_per_s\":%.0f,\"errors\":%lu}\n",
+			mode, (unsigned long)producers, (unsigned long)consumers, (unsigned long long)entries,
+			((double)ns / 1e6), (((double)entries * 1e9) / (double)(ns ? ns : 1)), (unsigned long)errors);
+	fflush(stdout);
+}
+
+/**
+ *	@brief Runs producer and consumer threads of one mode, prints its result.
+ */
+static void stress_run(const char *mode, void *(*producer)(void *), uint32_t producers, void *(*consumer)(void *), uint32_t consumers)
+{
+	pthread_t threads[2 * STRESS_MAX_THREADS];
+	stress_thread_TD args[2 * STRESS_MAX_THREADS];
+	uint32_t errors = atomic_load(&stress_errors);
+	uint64_t start = 0;
+	uint32_t i = 0;
+
+	atomic_store(&stress_done, 0);
+	start = now_ns();
+
+	for(i = 0; i < (producers + consumers); i++)
+	{
+		args[i].id = ((i < producers) ? i : (i - producers));
+		args[i].rng = (0x9E3779B97F4A7C15ull * (i + 1));
+		pthread_create(&threads[i], NULL, ((i < producers) ? producer : consumer), &args[i]);
+	}
+
+	for(i = 0; i < (producers + consumers); i++) pthread_join(threads[i], NULL);
+
+	print_result(mode, producers, consumers, ((uint64_t)producers * stress_items), (now_ns() - start), (atomic_load(&stress_errors) - errors));
+}
+
+/**
+* 	@brief	Context of stress_common_visit().
+*/
+typedef struct
+{
+	uint8_t *out;		/**< Copies of the visited entries */
+	uint32_t visited;	/**< Entries visited so far */
+	uint32_t stop;		/**< Entries to visit before returning false */
+
+}stress_visit_TD;
+
+/**
+ *	@brief Visitor of common mode: copies entries of common FIFO buffer until stop of them were visited.
+ */
+static bool stress_common_visit(void *entry, void *context)
+{
+	stress_visit_TD *visit = context;
+
+	if(visit->visited == visit->stop) return false;
+
+	memcpy(&visit->out[visit->visited * 5], entry, 5);
+	visit->visited++;
+
+	return true;
+}
+
+/**
+ *	@brief Single-threaded model check of common FIFO buffer: random mix of every push, pop and iterator function
+ *	on a buffer of odd size and entry size, return codes and payloads compared to a reference counter.
+ */
+static void stress_common(void)
+{
+	static uint8_t storage[37 * 5];
+	uint8_t in[STRESS_MAX_BATCH * 5];
+	uint8_t out[STRESS_MAX_BATCH * 5];
+	fifo_common_TD fifo;
+	fifo_common_iter_TD iter;
+	stress_visit_TD visit;
+	uint8_t *entry = NULL;
+	uint32_t errors = atomic_load(&stress_errors);
+	uint64_t rng = 0x2545F4914F6CDD1Dull;
+	uint64_t start = now_ns();
+	uint32_t stored = 0;
+	uint8_t seq_in = 0;
+	uint8_t seq_out = 0;
+	uint32_t op = 0;
+	uint32_t k = 0;
+	uint32_t i = 0;
+	uint32_t done = 0;
+	void *region1 = NULL;
+	void *region2 = NULL;
+	fifo_size_t len1 = 0;
+	fifo_size_t len2 = 0;
+	int ret = 0;
+
+	STRESS_CHECK(fifo_test() == 0);
+	STRESS_CHECK(fifo_common_init(&fifo, storage, 37, 5, true) == 0);
+
+	for(op = 0; op < stress_items; op++)
+	{
+		k = stress_batch(&rng, STRESS_MAX_BATCH);
+
+		if((stress_rand(&rng) & 1) == 0)
+		{
+			for(i = 0; i < (k * 5); i++) in[i] = (uint8_t)(seq_in + i);
+
+			switch(stress_rand(&rng) % 4)
+			{
+			case 0:
+				ret = fifo_common_push(&fifo, in);
+				done = ((ret == 0) ? 1 : 0);
+				STRESS_CHECK((ret == 0) == (stored < 37));
+				break;
+
+			case 1:
+				ret = fifo_common_push_mul(&fifo, in, (fifo_size_t)k);
+				done = ((ret == 0) ? k : 0);
+				STRESS_CHECK((ret == 0) == ((stored + k) <= 37));
+				break;
+
+			case 2:
+				done = fifo_common_write_some(&fifo, in, (fifo_size_t)k);
+				STRESS_CHECK(done == (((37 - stored) < k) ? (37 - stored) : k));
+				break;
+
+			default:
+				done = 0;
+				if(fifo_common_reserve(&fifo, (fifo_size_t)k, &region1, &len1, &region2, &len2) != 0) break;
+
+				STRESS_CHECK((uint32_t)(len1 + len2) == k);
+				memcpy(region1, in, ((size_t)len1 * 5));
+				if(len2 != 0) memcpy(region2, &in[len1 * 5], ((size_t)len2 * 5));
+				STRESS_CHECK(fifo_common_commit(&fifo, (fifo_size_t)k) == 0);
+				done = k;
+				break;
+			}
+
+			stored += done;
+			seq_in = (uint8_t)(seq_in + (done * 5));
+		}
+		else
+		{
+			switch(stress_rand(&rng) % 6)
+			{
+			case 0:
+				ret = fifo_common_pop(&fifo, out);
+				done = ((ret == 0) ? 1 : 0);
+				STRESS_CHECK((ret == 0) == (stored != 0));
+				break;
+
+			case 1:
+				ret = fifo_common_pop_mul(&fifo, out, (fifo_size_t)k);
+				done = ((ret == 0) ? k : 0);
+				STRESS_CHECK((ret == 0) == (k <= stored));
+				break;
+
+			case 2:
+				done = fifo_common_read_some(&fifo, out, (fifo_size_t)k);
+				STRESS_CHECK(done == ((stored < k) ? stored : k));
+				break;
+
+			case 3:
+				STRESS_CHECK(fifo_common_iter_begin(&iter, &fifo, (fifo_size_t)k, FIFO_PREFETCH_DISTANCE) == ((stored < k) ? stored : k));
+
+				for(done = 0; (entry = fifo_common_iter_next(&iter)) != NULL; done++) memcpy(&out[done * 5], entry, 5);
+
+				STRESS_CHECK(done == ((stored < k) ? stored : k));
+				STRESS_CHECK((uint32_t)(fifo.max_size - fifo.free_size) == stored); /* released at the end only */
+				STRESS_CHECK(fifo_common_iter_end(&iter) == 0);
+				break;
+
+			case 4:
+				visit.out = out;
+				visit.visited = 0;
+				visit.stop = (uint32_t)(stress_rand(&rng) % (k + 1));
+
+				done = fifo_common_foreach(&fifo, (fifo_size_t)k, (fifo_size_t)(stress_rand(&rng) % 4), stress_common_visit, &visit);
+				STRESS_CHECK((done == visit.visited) && (done <= stored) && (done <= k));
+				break;
+
+			default:
+				done = 0;
+				if(fifo_common_peek(&fifo, (fifo_size_t)k, &region1, &len1, &region2, &len2) != 0) break;
+
+				STRESS_CHECK((uint32_t)(len1 + len2) == k);
+				memcpy(out, region1, ((size_t)len1 * 5));
+				if(len2 != 0) memcpy(&out[len1 * 5], region2, ((size_t)len2 * 5));
+				STRESS_CHECK(fifo_common_release(&fifo, (fifo_size_t)k) == 0);
+				done = k;
+				break;
+			}
+
+			for(i = 0; i < (done * 5); i++) STRESS_CHECK(out[i] == (uint8_t)(seq_out + i));
+
+			stored -= done;
+			seq_out = (uint8_t)(seq_out + (done * 5));
+		}
+
+		STRESS_CHECK((uint32_t)(fifo.max_size - fifo.free_size) == stored);
+	}
+
+	print_result("common", 1, 1, stress_items, (now_ns() - start), (atomic_load(&stress_errors) - errors));
+}
+
+/**
+ *	@brief Single-threaded model check of common power-of-two FIFO buffer: random mix of push and pop functions,
+ *	return codes and payloads compared to a reference counter, with the free-running counters started just
+ *	before their wrap.
+ */
+static void stress_pow2(void)
+{
+	static uint8_t storage[16 * 5];
+	uint8_t in[STRESS_MAX_BATCH * 5];
+	uint8_t out[STRESS_MAX_BATCH * 5];
+	fifo_pow2_common_TD fifo;
+	fifo_iovec_TD iov[2];
+	uint32_t errors = atomic_load(&stress_errors);
+	uint64_t rng = 0x9FB21C651E98DF25ull;
+	uint64_t start = now_ns();
+	uint32_t stored = 0;
+	uint8_t seq_in = 0;
+	uint8_t seq_out = 0;
+	uint32_t op = 0;
+	uint32_t k = 0;
+	uint32_t i = 0;
+	uint32_t done = 0;
+	int ret = 0;
+
+	STRESS_CHECK(fifo_pow2_common_init(&fifo, storage, 16, 5, true) == 0);
+
+	fifo.head = (fifo_index_t)(0 - (fifo_index_t)(stress_items / 4)); /* counters wrap midway */
+	fifo.tail = fifo.head;
+
+	for(op = 0; op < stress_items; op++)
+	{
+		k = stress_batch(&rng, STRESS_MAX_BATCH);
+
+		if((stress_rand(&rng) & 1) == 0)
+		{
+			for(i = 0; i < (k * 5); i++) in[i] = (uint8_t)(seq_in + i);
+
+			iov[0].base = in;
+			iov[0].len = (fifo_size_t)(k / 2);
+			iov[1].base = (in + ((k / 2) * 5));
+			iov[1].len = (fifo_size_t)(k - (k / 2));
+
+			switch(stress_rand(&rng) % 4)
+			{
+			case 0:
+				ret = fifo_pow2_common_push(&fifo, in);
+				done = ((ret == 0) ? 1 : 0);
+				STRESS_CHECK((ret == 0) == (stored < 16));
+				break;
+
+			case 1:
+				ret = fifo_pow2_common_push_mul(&fifo, in, (fifo_size_t)k);
+				done = ((ret == 0) ? k : 0);
+				STRESS_CHECK((ret == 0) == ((stored + k) <= 16));
+				break;
+
+			case 2:
+				ret = fifo_pow2_common_pushv(&fifo, iov, 2);
+				done = ((ret == 0) ? k : 0);
+				STRESS_CHECK((ret == 0) == ((stored + k) <= 16));
+				break;
+
+			default:
+				done = fifo_pow2_common_write_some(&fifo, in, (fifo_size_t)k);
+				STRESS_CHECK(done == (((16 - stored) < k) ? (16 - stored) : k));
+				break;
+			}
+
+			stored += done;
+			seq_in = (uint8_t)(seq_in + (done * 5));
+		}
+		else
+		{
+			iov[0].base = out;
+			iov[0].len = (fifo_size_t)(k / 2);
+			iov[1].base = (out + ((k / 2) * 5));
+			iov[1].len = (fifo_size_t)(k - (k / 2));
+
+			switch(stress_rand(&rng) % 4)
+			{
+			case 0:
+				ret = fifo_pow2_common_pop(&fifo, out);
+				done = ((ret == 0) ? 1 : 0);
+				STRESS_CHECK((ret == 0) == (stored != 0));
+				break;
+
+			case 1:
+				ret = fifo_pow2_common_pop_mul(&fifo, out, (fifo_size_t)k);
+				done = ((ret == 0) ? k : 0);
+				STRESS_CHECK((ret == 0) == (k <= stored));
+				break;
+
+			case 2:
+				ret = fifo_pow2_common_popv(&fifo, iov, 2);
+				done = ((ret == 0) ? k : 0);
+				STRESS_CHECK((ret == 0) == (k <= stored));
+				break;
+
+			default:
+				done = fifo_pow2_common_read_some(&fifo, out, (fifo_size_t)k);
+				STRESS_CHECK(done == ((stored < k) ? stored : k));
+				break;
+			}
+
+			for(i = 0; i < (done * 5); i++) STRESS_CHECK(out[i] == (uint8_t)(seq_out + i));
+
+			stored -= done;
+			seq_out = (uint8_t)(seq_out + (done * 5));
+		}
+
+		STRESS_CHECK((fifo_index_t)(fifo.tail - fifo.head) == stored);
+	}
+
+	print_result("pow2", 1, 1, stress_items, (now_ns() - start), (atomic_load(&stress_errors) - errors));
+}
+
+/**
+ *	@brief Single-threaded model check of FIFO group of three members in one mode: random pushes into random members
+ *	and pops of random batches, the member and amount picked by every pop compared to a reference scheduler.
+ */
+static void stress_group_mode(uint8_t mode, uint64_t *rng, uint64_t *entries)
+{
+	static const fifo_size_t sizes[3] = { 7, 5, 3 };
+	static const fifo_size_t weights[3] = { 3, 2, 1 };
+	static uint32_t storage[3][7];
+	uint32_t in[STRESS_MAX_BATCH];
+	uint32_t out[STRESS_MAX_BATCH];
+	fifo_common_TD members[3];
+	fifo_group_TD group;
+	uint32_t stored[3] = { 0, 0, 0 };
+	uint32_t seq_in[3] = { 0, 0, 0 };
+	uint32_t seq_out[3] = { 0, 0, 0 };
+	fifo_size_t credit[3] = { 3, 2, 1 };
+	uint32_t round = 7;
+	uint32_t ready = 0;
+	uint32_t eligible = 0;
+	uint32_t expect = 0;
+	uint32_t op = 0;
+	uint32_t k = 0;
+	uint32_t i = 0;
+	uint32_t done = 0;
+	uint8_t member = 0;
+	uint8_t index = 0;
+	int ret = 0;
+
+	STRESS_CHECK(fifo_group_init(&group, mode) == 0);
+
+	for(i = 0; i < 3; i++)
+	{
+		STRESS_CHECK(fifo_common_init(&members[i], storage[i], sizes[i], sizeof(uint32_t), true) == 0);
+		STRESS_CHECK(fifo_group_add(&group, (uint8_t)i, &members[i], weights[i]) == 0);
+	}
+
+	for(op = 0; op < (stress_items / 2); op++)
+	{
+		k = stress_batch(rng, 4);
+
+		if((stress_rand(rng) % 5) < 2)
+		{
+			member = (uint8_t)(stress_rand(rng) % 3);
+
+			for(i = 0; i < k; i++) in[i] = ((uint32_t)member << 24) | (seq_in[member] + i);
+
+			if(stress_rand(rng) & 1)
+			{
+				ret = fifo_group_push(&group, member, in);
+				done = ((ret == 0) ? 1 : 0);
+				STRESS_CHECK((ret == 0) == (stored[member] < sizes[member]));
+			}
+			else
+			{
+				ret = fifo_group_push_mul(&group, member, in, (fifo_size_t)k);
+				done = ((ret == 0) ? k : 0);
+				STRESS_CHECK((ret == 0) == ((stored[member] + k) <= sizes[member]));
+			}
+
+			stored[member] += done;
+			seq_in[member] += done;
+			continue;
+		}
+
+		k = stress_batch(rng, STRESS_MAX_BATCH);
+
+		for(ready = 0, i = 0; i < 3; i++) ready |= ((stored[i] != 0) ? (1u << i) : 0);
+
+		eligible = ready;
+
+		if((mode == FIFO_GROUP_WRR) && (ready != 0))
+		{
+			eligible &= round;
+
+			if(eligible == 0) /* round over, the next one starts */
+			{
+				for(i = 0; i < 3; i++) credit[i] = weights[i];
+				round = 7;
+				eligible = ready;
+			}
+		}
+
+		index = 0xFF;
+
+		if(stress_rand(rng) & 1)
+		{
+			done = ((fifo_group_pop(&group, out, &index) == 0) ? 1 : 0);
+			k = 1;
+		}
+		else
+		{
+			done = fifo_group_pop_mul(&group, out, (fifo_size_t)k, &index);
+		}
+
+		if(eligible == 0)
+		{
+			STRESS_CHECK(done == 0); /* group empty */
+			continue;
+		}
+
+		member = (uint8_t)((eligible & 1) ? 0 : ((eligible & 2) ? 1 : 2)); /* highest priority eligible member */
+		expect = ((stored[member] < k) ? stored[member] : k);
+		if((mode == FIFO_GROUP_WRR) && (expect > credit[member])) expect = credit[member];
+
+		STRESS_CHECK((index == member) && (done == expect));
+		if((index != member) || (done != expect)) return; /* reference lost, the rest would only repeat it */
+
+		for(i = 0; i < done; i++) STRESS_CHECK(out[i] == (((uint32_t)member << 24) | (seq_out[member] + i)));
+
+		stored[member] -= done;
+		seq_out[member] += done;
+		*entries += done;
+
+		if(mode == FIFO_GROUP_WRR)
+		{
+			credit[member] -= done;
+			if(credit[member] == 0) round &= ~(1u << member);
+		}
+	}
+}
+
+/**
+ *	@brief Runs group model check in FIFO_GROUP_STRICT and FIFO_GROUP_WRR modes.
+ */
+static void stress_group(void)
+{
+	uint32_t errors = atomic_load(&stress_errors);
+	uint64_t rng = 0xD1B54A32D192ED03ull;
+	uint64_t start = now_ns();
+	uint64_t entries = 0;
+
+	stress_group_mode(FIFO_GROUP_STRICT, &rng, &entries);
+	stress_group_mode(FIFO_GROUP_WRR, &rng, &entries);
+
+	print_result("group", 1, 1, entries, (now_ns() - start), (atomic_load(&stress_errors) - errors));
+}
+
+static fifo_spsc_uint32_TD stress_spsc;						/**< FIFO buffer of spsc mode */
+static uint32_t stress_spsc_storage[STRESS_CAPACITY];
+
+/**
+ *	@brief Producer of spsc mode: push, push_mul, write_some and reserve/commit of random batches.
+ */
+static void *stress_spsc_producer(void *arg)
+{
+	stress_thread_TD *thread = arg;
+	uint32_t batch[STRESS_MAX_BATCH];
+	uint32_t *region1 = NULL;
+	uint32_t *region2 = NULL;
+	fifo_size_t len1 = 0;
+	fifo_size_t len2 = 0;
+	uint32_t seq = 0;
+	uint32_t k = 0;
+	uint32_t i = 0;
+	uint32_t done = 0;
+
+	while(seq < stress_items)
+	{
+		k = stress_batch(&thread->rng, STRESS_MAX_BATCH);
+		if(k > (stress_items - seq)) k = (stress_items - seq);
+
+		for(i = 0; i < k; i++) batch[i] = (seq + i);
+
+		switch(stress_rand(&thread->rng) % 4)
+		{
+		case 0:
+			done = ((fifo_spsc_uint32_push(&stress_spsc, batch[0]) == 0) ? 1 : 0);
+			break;
+
+		case 1:
+			done = ((fifo_spsc_uint32_push_mul(&stress_spsc, batch, (fifo_size_t)k) == 0) ? k : 0);
+			break;
+
+		case 2:
+			done = fifo_spsc_uint32_write_some(&stress_spsc, batch, (fifo_size_t)k);
+			break;
+
+		default:
+			done = 0;
+			if(fifo_spsc_uint32_reserve(&stress_spsc, (fifo_size_t)k, &region1, &len1, &region2, &len2) != 0) break;
+
+			memcpy(region1, batch, ((size_t)len1 * sizeof(uint32_t)));
+			stress_perturb(&thread->rng);
+			if(len2 != 0) memcpy(region2, &batch[len1], ((size_t)len2 * sizeof(uint32_t)));
+			fifo_spsc_uint32_commit(&stress_spsc, (fifo_size_t)k);
+			done = k;
+			break;
+		}
+
+		seq += done;
+
+		if(done == 0) sched_yield(); /* full */
+		else stress_perturb(&thread->rng);
+	}
+
+	return NULL;
+}
+
+/**
+ *	@brief Consumer of spsc mode: pop, pop_mul, read_some and peek/release, every entry must be the next one.
+ */
+static void *stress_spsc_consumer(void *arg)
+{
+	stress_thread_TD *thread = arg;
+	uint32_t batch[STRESS_MAX_BATCH];
+	uint32_t *region1 = NULL;
+	uint32_t *region2 = NULL;
+	fifo_size_t len1 = 0;
+	fifo_size_t len2 = 0;
+	uint32_t seq = 0;
+	uint32_t k = 0;
+	uint32_t i = 0;
+	uint32_t done = 0;
+
+	while(seq < stress_items)
+	{
+		k = stress_batch(&thread->rng, STRESS_MAX_BATCH);
+
+		switch(stress_rand(&thread->rng) % 4)
+		{
+		case 0:
+			done = ((fifo_spsc_uint32_pop(&stress_spsc, batch) == 0) ? 1 : 0);
+			break;
+
+		case 1:
+			done = ((fifo_spsc_uint32_pop_mul(&stress_spsc, batch, (fifo_size_t)k) == 0) ? k : 0);
+			break;
+
+		case 2:
+			done = fifo_spsc_uint32_read_some(&stress_spsc, batch, (fifo_size_t)k);
+			break;
+
+		default:
+			done = 0;
+			if(fifo_spsc_uint32_peek(&stress_spsc, (fifo_size_t)k, &region1, &len1, &region2, &len2) != 0) break;
+
+			memcpy(batch, region1, ((size_t)len1 * sizeof(uint32_t)));
+			stress_perturb(&thread->rng);
+			if(len2 != 0) memcpy(&batch[len1], region2, ((size_t)len2 * sizeof(uint32_t)));
+			fifo_spsc_uint32_release(&stress_spsc, (fifo_size_t)k);
+			done = k;
+			break;
+		}
+
+		for(i = 0; i < done; i++) STRESS_CHECK(batch[i] == (seq + i));
+
+		seq += done;
+
+		if(done == 0) sched_yield(); /* empty */
+		else stress_perturb(&thread->rng);
+	}
+
+	STRESS_CHECK(fifo_spsc_ring_count(&stress_spsc.ring) == 0);
+
+	return NULL;
+}
+
+/**
+ *	@brief Entry of multi-producer modes: producer id and its sequence number, with a check word against torn copies.
+ */
+typedef struct
+{
+	uint32_t producer;	/**< Index of the producer thread */
+	uint32_t seq;		/**< Sequence number within the producer */
+	uint64_t check;		/**< ~((producer << 32) | seq) */
+
+}stress_entry_TD;
+
+/**
+ *	@brief Returns stress entry of producer and seq.
+ */
+static inline stress_entry_TD stress_entry(uint32_t producer, uint32_t seq)
+{
+	stress_entry_TD entry;
+
+	entry.producer = producer;
+	entry.seq = seq;
+	entry.check = ~((((uint64_t)producer) << 32) | seq);
+
+	return entry;
+}
+
+/**
+ *	@brief Checks that entry is intact, returns true if so.
+ */
+static inline bool stress_entry_valid(const stress_entry_TD *entry)
+{
+	return ((entry->producer < stress_producers) && (entry->check == ~((((uint64_t)entry->producer) << 32) | entry->seq)));
+}
+
+static fifo_mpmc_TD stress_mpmc;											/**< FIFO buffer of mpmc mode */
+static _Alignas(fifo_index_t) uint8_t stress_mpmc_storage[FIFO_MPMC_BUFFER_SIZE(STRESS_CAPACITY, sizeof(stress_entry_TD))];
+static _Atomic uint64_t stress_mpmc_popped;								/**< Entries popped by all consumers */
+static _Atomic uint64_t stress_mpmc_sum[STRESS_MAX_THREADS];				/**< Sum of popped seq per producer */
+
+/**
+ *	@brief Producer of mpmc mode.
+ */
+static void *stress_mpmc_producer(void *arg)
+{
+	stress_thread_TD *thread = arg;
+	stress_entry_TD entry;
+	uint32_t seq = 0;
+
+	for(seq = 0; seq < stress_items; seq++)
+	{
+		entry = stress_entry(thread->id, seq);
+
+		while(fifo_mpmc_push(&stress_mpmc, &entry) != 0) sched_yield(); /* full */
+
+		stress_perturb(&thread->rng);
+	}
+
+	atomic_fetch_add(&stress_done, 1);
+
+	return NULL;
+}
+
+/**
+ *	@brief Consumer of mpmc mode: entries of every producer must come in increasing order, each exactly once overall.
+ */
+static void *stress_mpmc_consumer(void *arg)
+{
+	stress_thread_TD *thread = arg;
+	uint64_t next[STRESS_MAX_THREADS];
+	uint64_t total = ((uint64_t)stress_producers * stress_items);
+	stress_entry_TD entry;
+
+	memset(next, 0, sizeof(next));
+
+	while(atomic_load(&stress_mpmc_popped) < total)
+	{
+		if(fifo_mpmc_pop(&stress_mpmc, &entry) != 0)
+		{
+			sched_yield(); /* empty */
+			continue;
+		}
+
+		STRESS_CHECK(stress_entry_valid(&entry));
+
+		if(stress_entry_valid(&entry))
+		{
+			STRESS_CHECK(entry.seq >= next[entry.producer]);
+			next[entry.producer] = ((uint64_t)entry.seq + 1);
+			atomic_fetch_add(&stress_mpmc_sum[entry.producer], entry.seq);
+		}
+
+		atomic_fetch_add(&stress_mpmc_popped, 1);
+		stress_perturb(&thread->rng);
+	}
+
+	return NULL;
+}
+
+/**
+ *	@brief Runs mpmc mode, checks that the seq sums of every producer are complete.
+ */
+static void stress_mpmc_run(void)
+{
+	uint64_t expected = (((uint64_t)stress_items * (stress_items - 1)) / 2);
+	uint32_t i = 0;
+
+	STRESS_CHECK(fifo_mpmc_init(&stress_mpmc, stress_mpmc_storage, STRESS_CAPACITY, sizeof(stress_entry_TD)) == 0);
+	atomic_store(&stress_mpmc_popped, 0);
+	for(i = 0; i < STRESS_MAX_THREADS; i++) atomic_store(&stress_mpmc_sum[i], 0);
+
+	stress_run("mpmc", stress_mpmc_producer, stress_producers, stress_mpmc_consumer, stress_consumers);
+
+	for(i = 0; i < stress_producers; i++) STRESS_CHECK(atomic_load(&stress_mpmc_sum[i]) == expected);
+	STRESS_CHECK(fifo_mpmc_count(&stress_mpmc) == 0);
+}
+
+static fifo_shard_TD stress_shard;													/**< FIFO buffer of shard mode */
+static fifo_shard_slot_TD stress_shard_slots[STRESS_MAX_THREADS];
+static stress_entry_TD stress_shard_storage[STRESS_MAX_THREADS * STRESS_CAPACITY];
+static _Atomic uint64_t stress_shard_popped;										/**< Entries popped by all consumers */
+static _Atomic uint64_t stress_shard_sum[STRESS_MAX_THREADS];						/**< Sum of popped seq per producer */
+
+/**
+ *	@brief Producer of shard mode: push_mul and write_some of random batches into its own shard.
+ */
+static void *stress_shard_producer(void *arg)
+{
+	stress_thread_TD *thread = arg;
+	stress_entry_TD batch[STRESS_MAX_BATCH];
+	uint32_t seq = 0;
+	uint32_t k = 0;
+	uint32_t i = 0;
+	uint32_t done = 0;
+
+	while(seq < stress_items)
+	{
+		k = stress_batch(&thread->rng, STRESS_MAX_BATCH);
+		if(k > (stress_items - seq)) k = (stress_items - seq);
+
+		for(i = 0; i < k; i++) batch[i] = stress_entry(thread->id, (seq + i));
+
+		if((stress_rand(&thread->rng) & 1) == 0) done = ((fifo_shard_push_mul(&stress_shard, (uint16_t)thread->id, batch, (fifo_size_t)k) == 0) ? k : 0);
+		else done = fifo_shard_write_some(&stress_shard, (uint16_t)thread->id, batch, (fifo_size_t)k);
+
+		seq += done;
+
+		if(done == 0) sched_yield(); /* full */
+		else stress_perturb(&thread->rng);
+	}
+
+	atomic_fetch_add(&stress_done, 1);
+
+	return NULL;
+}
+
+/**
+ *	@brief Consumer of shard mode: every batch comes from one shard, entries of every shard in increasing order.
+ */
+static void *stress_shard_consumer(void *arg)
+{
+	stress_thread_TD *thread = arg;
+	stress_entry_TD batch[STRESS_MAX_BATCH];
+	uint64_t next[STRESS_MAX_THREADS];
+	uint64_t total = ((uint64_t)stress_producers * stress_items);
+	uint16_t from = 0;
+	uint32_t done = 0;
+	uint32_t i = 0;
+
+	memset(next, 0, sizeof(next));
+
+	while(atomic_load(&stress_shard_popped) < total)
+	{
+		done = fifo_shard_read_some(&stress_shard, (uint16_t)thread->id, batch, (fifo_size_t)stress_batch(&thread->rng, STRESS_MAX_BATCH), &from);
+
+		for(i = 0; i < done; i++)
+		{
+			STRESS_CHECK(stress_entry_valid(&batch[i]) && (batch[i].producer == from));
+			if(!stress_entry_valid(&batch[i])) continue;
+
+			STRESS_CHECK(batch[i].seq >= next[batch[i].producer]);
+			next[batch[i].producer] = ((uint64_t)batch[i].seq + 1);
+			atomic_fetch_add(&stress_shard_sum[batch[i].producer], batch[i].seq);
+		}
+
+		atomic_fetch_add(&stress_shard_popped, done);
+
+		if(done == 0) sched_yield(); /* all shards empty */
+		else stress_perturb(&thread->rng);
+	}
+
+	return NULL;
+}
+
+/**
+ *	@brief Runs shard mode with one shard per producer and as many consumers, checks that the seq sums of every producer are complete.
+ */
+static void stress_shard_run(void)
+{
+	uint64_t expected = (((uint64_t)stress_items * (stress_items - 1)) / 2);
+	uint32_t i = 0;
+
+	STRESS_CHECK(fifo_shard_init(&stress_shard, stress_shard_slots, (uint16_t)stress_producers, stress_shard_storage, STRESS_CAPACITY, sizeof(stress_entry_TD), true) == 0);
+	atomic_store(&stress_shard_popped, 0);
+	for(i = 0; i < STRESS_MAX_THREADS; i++) atomic_store(&stress_shard_sum[i], 0);
+
+	stress_run("shard", stress_shard_producer, stress_producers, stress_shard_consumer, stress_producers);
+
+	for(i = 0; i < stress_producers; i++) STRESS_CHECK(atomic_load(&stress_shard_sum[i]) == expected);
+	STRESS_CHECK(fifo_shard_count(&stress_shard) == 0);
+}
+
+static fifo_mpsc_TD stress_mpsc;									/**< FIFO buffer of mpsc mode */
+static stress_entry_TD stress_mpsc_storage[STRESS_CAPACITY];
+
+/**
+ *	@brief Producer of mpsc mode: producer 0 pushes through a staging buffer, odd producers push_mul random batches
+ *	and the other even producers pushv them split into two pieces.
+ */
+static void *stress_mpsc_producer(void *arg)
+{
+	stress_thread_TD *thread = arg;
+	stress_entry_TD batch[STRESS_MAX_BATCH];
+	stress_entry_TD stage_storage[8];
+	fifo_mpsc_stage_TD stage;
+	fifo_iovec_TD iov[2];
+	uint32_t seq = 0;
+	uint32_t k = 0;
+	uint32_t i = 0;
+	int ret = 0;
+
+	fifo_mpsc_stage_init(&stage, &stress_mpsc, stage_storage, 8);
+
+	while(seq < stress_items)
+	{
+		if(thread->id == 0)
+		{
+			batch[0] = stress_entry(thread->id, seq);
+
+			if(fifo_mpsc_stage_push(&stage, &batch[0]) == 0) seq++;
+			else sched_yield(); /* full */
+		}
+		else
+		{
+			k = stress_batch(&thread->rng, 8);
+			if(k > (stress_items - seq)) k = (stress_items - seq);
+
+			for(i = 0; i < k; i++) batch[i] = stress_entry(thread->id, (seq + i));
+
+			if((thread->id & 1) != 0)
+			{
+				ret = fifo_mpsc_push_mul(&stress_mpsc, batch, (fifo_size_t)k);
+			}
+			else
+			{
+				iov[0].base = batch;
+				iov[0].len = (fifo_size_t)(k / 2);
+				iov[1].base = &batch[k / 2];
+				iov[1].len = (fifo_size_t)(k - (k / 2));
+				ret = fifo_mpsc_pushv(&stress_mpsc, iov, 2);
+			}
+
+			if(ret == 0) seq += k;
+			else sched_yield(); /* full */
+		}
+
+		stress_perturb(&thread->rng);
+	}
+
+	while(fifo_mpsc_stage_flush(&stage) != 0) sched_yield(); /* full */
+
+	atomic_fetch_add(&stress_done, 1);
+
+	return NULL;
+}
+
+/**
+ *	@brief Consumer of mpsc mode: popv or read_some random batches, entries of every producer must come exactly in sequence.
+ */
+static void *stress_mpsc_consumer(void *arg)
+{
+	stress_thread_TD *thread = arg;
+	stress_entry_TD batch[STRESS_MAX_BATCH];
+	uint32_t next[STRESS_MAX_THREADS];
+	uint64_t total = ((uint64_t)stress_producers * stress_items);
+	fifo_iovec_TD iov[2];
+	uint64_t popped = 0;
+	uint32_t done = 0;
+	uint32_t k = 0;
+	uint32_t i = 0;
+
+	memset(next, 0, sizeof(next));
+
+	while(popped < total)
+	{
+		k = stress_batch(&thread->rng, STRESS_MAX_BATCH);
+		iov[0].base = batch;
+		iov[0].len = (fifo_size_t)(k / 2);
+		iov[1].base = &batch[k / 2];
+		iov[1].len = (fifo_size_t)(k - (k / 2));
+
+		if(((stress_rand(&thread->rng) & 1) != 0) && (fifo_mpsc_popv(&stress_mpsc, iov, 2) == 0)) done = k;
+		else done = fifo_mpsc_read_some(&stress_mpsc, batch, (fifo_size_t)k);
+
+		for(i = 0; i < done; i++)
+		{
+			STRESS_CHECK(stress_entry_valid(&batch[i]));
+			if(!stress_entry_valid(&batch[i])) continue;
+
+			STRESS_CHECK(batch[i].seq == next[batch[i].producer]);
+			next[batch[i].producer] = (batch[i].seq + 1);
+		}
+
+		popped += done;
+
+		if(done == 0) sched_yield(); /* empty */
+		else stress_perturb(&thread->rng);
+	}
+
+	for(i = 0; i < stress_producers; i++) STRESS_CHECK(next[i] == stress_items);
+
+	return NULL;
+}
+
+static fifo_lossy_TD stress_lossy;											/**< FIFO buffer of lossy mode */
+static _Alignas(fifo_index_t) uint8_t stress_lossy_storage[FIFO_LOSSY_BUFFER_SIZE(STRESS_CAPACITY, sizeof(stress_entry_TD))];
+static fifo_lossy_reader_TD stress_lossy_readers[STRESS_MAX_THREADS];		/**< Reader cursors, created before the producer starts */
+
+/**
+ *	@brief Producer of lossy mode: never waits for the readers.
+ */
+static void *stress_lossy_producer(void *arg)
+{
+	stress_thread_TD *thread = arg;
+	stress_entry_TD batch[STRESS_MAX_BATCH];
+	uint32_t seq = 0;
+	uint32_t k = 0;
+	uint32_t i = 0;
+
+	while(seq < stress_items)
+	{
+		k = stress_batch(&thread->rng, 4);
+		if(k > (stress_items - seq)) k = (stress_items - seq);
+
+		for(i = 0; i < k; i++) batch[i] = stress_entry(0, (seq + i));
+
+		if(k == 1) STRESS_CHECK(fifo_lossy_push(&stress_lossy, batch) == 0);
+		else STRESS_CHECK(fifo_lossy_push_mul(&stress_lossy, batch, (fifo_size_t)k) == 0);
+
+		seq += k;
+		stress_perturb(&thread->rng);
+	}
+
+	atomic_fetch_add(&stress_done, 1);
+
+	return NULL;
+}
+
+/**
+ *	@brief Reader of lossy mode: no torn entries, seq strictly increasing, read and lost entries add up to all sent.
+ */
+static void *stress_lossy_consumer(void *arg)
+{
+	stress_thread_TD *thread = arg;
+	stress_entry_TD batch[STRESS_MAX_BATCH];
+	fifo_lossy_reader_TD *reader = &stress_lossy_readers[thread->id];
+	uint64_t next = 0;
+	uint64_t read = 0;
+	uint32_t done = 0;
+	uint32_t i = 0;
+	bool finished = false;
+
+	for(;;)
+	{
+		finished = (atomic_load(&stress_done) != 0);
+
+		done = fifo_lossy_read_some(reader, batch, (fifo_size_t)stress_batch(&thread->rng, STRESS_MAX_BATCH));
+
+		for(i = 0; i < done; i++)
+		{
+			STRESS_CHECK(stress_entry_valid(&batch[i]));
+			STRESS_CHECK(batch[i].seq >= next);
+			next = ((uint64_t)batch[i].seq + 1);
+		}
+
+		read += done;
+
+		if(done != 0) stress_perturb(&thread->rng);
+		else if(finished == true) break; /* producer done and nothing left */
+		else sched_yield();
+	}
+
+	STRESS_CHECK((fifo_index_t)(read + reader->lost) == (fifo_index_t)stress_items); /* lost wraps with fifo_index_t */
+
+	return NULL;
+}
+
+/**
+ *	@brief Checks where a lossy reader starts: at the first entry of a ring that never filled, and at the oldest
+ *	held entry of a filled ring whose tail counter has wrapped below max_size.
+ */
+static void stress_lossy_start(void)
+{
+	static _Alignas(fifo_index_t) uint8_t storage[FIFO_LOSSY_BUFFER_SIZE(8, sizeof(uint32_t))];
+	fifo_lossy_TD fifo;
+	fifo_lossy_reader_TD reader;
+	uint32_t val = 0;
+	uint32_t i = 0;
+
+	STRESS_CHECK(fifo_lossy_init(&fifo, storage, 8, sizeof(uint32_t)) == 0);
+
+	for(i = 0; i < 3; i++) STRESS_CHECK(fifo_lossy_push(&fifo, &i) == 0);
+
+	STRESS_CHECK(fifo_lossy_reader_init(&reader, &fifo) == 0);
+	STRESS_CHECK(fifo_lossy_count(&reader) == 3);
+	STRESS_CHECK((fifo_lossy_pop(&reader, &val) == 0) && (val == 0)); /* not started at the first entry */
+
+	STRESS_CHECK(fifo_lossy_init(&fifo, storage, 8, sizeof(uint32_t)) == 0);
+	atomic_store(&fifo.tail, (fifo_index_t)(0 - 5)); /* tail counter wraps after 5 pushes */
+
+	for(i = 0; i < 11; i++) STRESS_CHECK(fifo_lossy_push(&fifo, &i) == 0);
+
+	STRESS_CHECK(fifo_lossy_reader_init(&reader, &fifo) == 0);
+	STRESS_CHECK(fifo_lossy_count(&reader) == 8);
+
+	for(i = 3; i < 11; i++) STRESS_CHECK((fifo_lossy_pop(&reader, &val) == 0) && (val == i)); /* oldest held entries skipped */
+
+	STRESS_CHECK(fifo_lossy_pop(&reader, &val) == -3);
+	STRESS_CHECK(reader.lost == 0);
+}
+
+static fifo_msg_TD stress_msg;						/**< FIFO buffer of msg mode */
+static uint8_t stress_msg_storage[1024];
+
+/**
+ *	@brief Fills message of seq: random length from 4 Bytes, seq in the first 4 Bytes, the rest derived from it.
+ */
+static uint16_t stress_msg_fill(uint8_t *msg, uint32_t seq)
+{
+	uint16_t len = (uint16_t)(4 + ((seq * 2654435761u) >> 26));
+	uint16_t i = 0;
+
+	memcpy(msg, &seq, 4);
+	for(i = 4; i < len; i++) msg[i] = (uint8_t)(seq + i);
+
+	return len;
+}
+
+/**
+ *	@brief Producer of msg mode: push and reserve/commit of variable length messages.
+ */
+static void *stress_msg_producer(void *arg)
+{
+	stress_thread_TD *thread = arg;
+	uint8_t msg[4 + 64];
+	void *region = NULL;
+	uint32_t seq = 0;
+	uint16_t len = 0;
+	int ret = 0;
+
+	while(seq < stress_items)
+	{
+		len = stress_msg_fill(msg, seq);
+
+		if((stress_rand(&thread->rng) & 1) == 0) ret = fifo_msg_push(&stress_msg, msg, len);
+		else
+		{
+			ret = fifo_msg_reserve(&stress_msg, len, &region);
+
+			if(ret == 0)
+			{
+				memcpy(region, msg, len);
+				stress_perturb(&thread->rng);
+				STRESS_CHECK(fifo_msg_commit(&stress_msg, len) == 0);
+			}
+		}
+
+		if(ret == 0) seq++;
+		else sched_yield(); /* full */
+
+		stress_perturb(&thread->rng);
+	}
+
+	return NULL;
+}
+
+/**
+ *	@brief Consumer of msg mode: pop and peek/release, every message must be the next one, complete.
+ */
+static void *stress_msg_consumer(void *arg)
+{
+	stress_thread_TD *thread = arg;
+	uint8_t expected[4 + 64];
+	uint8_t msg[4 + 64];
+	void *view = NULL;
+	uint32_t seq = 0;
+	uint16_t len = 0;
+	int ret = 0;
+
+	while(seq < stress_items)
+	{
+		if((stress_rand(&thread->rng) & 1) == 0) ret = fifo_msg_pop(&stress_msg, msg, sizeof(msg), &len);
+		else
+		{
+			ret = fifo_msg_peek(&stress_msg, &view, &len);
+
+			if(ret == 0)
+			{
+				STRESS_CHECK(len <= sizeof(msg));
+				memcpy(msg, view, ((len <= sizeof(msg)) ? len : sizeof(msg)));
+				stress_perturb(&thread->rng);
+				STRESS_CHECK(fifo_msg_release(&stress_msg) == 0);
+			}
+		}
+
+		if(ret != 0)
+		{
+			sched_yield(); /* empty */
+			continue;
+		}
+
+		STRESS_CHECK(len == stress_msg_fill(expected, seq));
+		STRESS_CHECK(memcmp(msg, expected, ((len <= sizeof(msg)) ? len : sizeof(msg))) == 0);
+
+		seq++;
+		stress_perturb(&thread->rng);
+	}
+
+	return NULL;
+}
+
+/**
+* 	@brief	Slots of the arena of pool mode, fewer than the threads so acquire runs dry.
+*/
+#define STRESS_POOL_SLOTS		3
+
+static fifo_pool_TD stress_pool;											/**< FIFO pool of pool mode */
+static _Alignas(FIFO_CACHE_LINE_SIZE) uint8_t stress_pool_arena[STRESS_POOL_SLOTS * 512];
+static pthread_mutex_t stress_pool_lock = PTHREAD_MUTEX_INITIALIZER;		/**< Lock of acquire and release */
+static _Atomic uint32_t stress_pool_owner[STRESS_POOL_SLOTS];				/**< Thread id + 1 of the owner of every slot, 0 if free */
+
+/**
+ *	@brief Claims slot of fifo for thread id, fails the check when another thread owns it.
+ */
+static uint32_t stress_pool_claim(void *fifo, uint32_t id)
+{
+	uint32_t slot = (uint32_t)(((uint8_t *)fifo - stress_pool.arena) / stress_pool.slot_size);
+	uint32_t expected = 0;
+
+	STRESS_CHECK(slot < STRESS_POOL_SLOTS);
+	if(slot >= STRESS_POOL_SLOTS) return 0;
+
+	STRESS_CHECK(atomic_compare_exchange_strong(&stress_pool_owner[slot], &expected, (id + 1))); /* handed out twice */
+
+	return slot;
+}
+
+/**
+ *	@brief User thread of pool mode: acquires a common or SPSC FIFO buffer under the lock, owns it for a random
+ *	batch of pushes and pops with its own payloads, releases it. Every slot must have one owner at a time.
+ */
+static void *stress_pool_user(void *arg)
+{
+	stress_thread_TD *thread = arg;
+	fifo_common_TD *common = NULL;
+	fifo_spsc_common_TD *spsc = NULL;
+	uint32_t in[STRESS_MAX_BATCH];
+	uint32_t out[STRESS_MAX_BATCH];
+	uint32_t seq = 0;
+	uint32_t slot = 0;
+	uint32_t k = 0;
+	uint32_t i = 0;
+	bool use_spsc = false;
+
+	while(seq < stress_items)
+	{
+		use_spsc = ((stress_rand(&thread->rng) & 1) != 0);
+
+		pthread_mutex_lock(&stress_pool_lock);
+		if(use_spsc) spsc = fifo_pool_acquire_spsc(&stress_pool, false);
+		else common = fifo_pool_acquire_common(&stress_pool, false);
+		pthread_mutex_unlock(&stress_pool_lock);
+
+		if((use_spsc ? (void *)spsc : (void *)common) == NULL)
+		{
+			sched_yield(); /* pool exhausted */
+			continue;
+		}
+
+		slot = stress_pool_claim((use_spsc ? (void *)spsc : (void *)common), thread->id);
+
+		k = stress_batch(&thread->rng, STRESS_MAX_BATCH);
+		if(k > (stress_items - seq)) k = (stress_items - seq);
+
+		for(i = 0; i < k; i++) in[i] = ((thread->id << 24) | ((seq + i) & 0xFFFFFFu));
+
+		if(use_spsc) STRESS_CHECK(fifo_spsc_common_push_mul(spsc, in, (fifo_size_t)k) == 0);
+		else STRESS_CHECK(fifo_common_push_mul(common, in, (fifo_size_t)k) == 0);
+
+		stress_perturb(&thread->rng);
+
+		if(use_spsc) STRESS_CHECK((fifo_spsc_common_pop_mul(spsc, out, (fifo_size_t)k) == 0) && (fifo_spsc_ring_count(&spsc->ring) == 0));
+		else STRESS_CHECK((fifo_common_pop_mul(common, out, (fifo_size_t)k) == 0) && (common->free_size == common->max_size));
+
+		STRESS_CHECK(memcmp(in, out, ((size_t)k * sizeof(uint32_t))) == 0); /* another owner wrote the slot */
+
+		seq += k;
+
+		atomic_store(&stress_pool_owner[slot], 0);
+
+		pthread_mutex_lock(&stress_pool_lock);
+		STRESS_CHECK(fifo_pool_release(&stress_pool, (use_spsc ? (void *)spsc : (void *)common)) == 0);
+		pthread_mutex_unlock(&stress_pool_lock);
+
+		stress_perturb(&thread->rng);
+	}
+
+	return NULL;
+}
+
+/**
+ *	@brief Runs pool mode with stress_producers users sharing STRESS_POOL_SLOTS FIFO buffers, checks that all came back.
+ */
+static void stress_pool_run(void)
+{
+	STRESS_CHECK(fifo_pool_arena_size(STRESS_POOL_SLOTS, STRESS_MAX_BATCH, sizeof(uint32_t)) <= sizeof(stress_pool_arena));
+	STRESS_CHECK(fifo_pool_init(&stress_pool, stress_pool_arena, fifo_pool_arena_size(STRESS_POOL_SLOTS, STRESS_MAX_BATCH, sizeof(uint32_t)),
+					STRESS_MAX_BATCH, sizeof(uint32_t)) == 0);
+
+	stress_run("pool", stress_pool_user, stress_producers, NULL, 0);
+
+	STRESS_CHECK((stress_pool.slots == STRESS_POOL_SLOTS) && (stress_pool.free_count == STRESS_POOL_SLOTS));
+}
+
+#if defined(__linux__)
+
+/**
+* 	@brief	Largest batch of mirror mode, a quarter of the smallest mirrored FIFO buffer of uint32_t entries on 4 KiB pages.
+*/
+#define STRESS_MIRROR_BATCH		256
+
+/**
+ *	@brief Single-threaded model check of mirrored FIFO buffer: random mix of push, pop, reserve/commit and peek/release
+ *	of batches up to a quarter of its size, every peeked or reserved span must be one contiguous region, also across the wrap.
+ */
+static void stress_mirror(void)
+{
+	static uint32_t in[STRESS_MIRROR_BATCH];
+	static uint32_t out[STRESS_MIRROR_BATCH];
+	fifo_mirror_TD fifo;
+	fifo_iovec_TD iov[2];
+	uint32_t errors = atomic_load(&stress_errors);
+	uint64_t rng = 0xA0761D6478BD642Full;
+	uint64_t start = now_ns();
+	uint64_t entries = 0;
+	uint32_t *region = NULL;
+	uint32_t size = (uint32_t)fifo_mirror_granularity(sizeof(uint32_t));
+	uint32_t wraps = 0;
+	uint32_t stored = 0;
+	uint32_t seq_in = 0;
+	uint32_t seq_out = 0;
+	uint32_t op = 0;
+	uint32_t k = 0;
+	uint32_t i = 0;
+	uint32_t done = 0;
+	int ret = 0;
+
+	STRESS_CHECK((size >= (4 * STRESS_MIRROR_BATCH)) && ((fifo_size_t)size == size));
+	if((size < (4 * STRESS_MIRROR_BATCH)) || ((fifo_size_t)size != size)) return;
+	STRESS_CHECK(fifo_mirror_init(&fifo, (fifo_size_t)size, sizeof(uint32_t)) == 0);
+
+	for(op = 0; op < stress_items; op++)
+	{
+		k = stress_batch(&rng, STRESS_MIRROR_BATCH);
+
+		if((stress_rand(&rng) & 1) == 0)
+		{
+			for(i = 0; i < k; i++) in[i] = (seq_in + i);
+
+			iov[0].base = in;
+			iov[0].len = (fifo_size_t)(k / 2);
+			iov[1].base = &in[k / 2];
+			iov[1].len = (fifo_size_t)(k - (k / 2));
+
+			switch(stress_rand(&rng) % 5)
+			{
+			case 0:
+				ret = fifo_mirror_push(&fifo, in);
+				done = ((ret == 0) ? 1 : 0);
+				STRESS_CHECK((ret == 0) == (stored < size));
+				break;
+
+			case 1:
+				ret = fifo_mirror_push_mul(&fifo, in, (fifo_size_t)k);
+				done = ((ret == 0) ? k : 0);
+				STRESS_CHECK((ret == 0) == ((stored + k) <= size));
+				break;
+
+			case 2:
+				done = fifo_mirror_write_some(&fifo, in, (fifo_size_t)k);
+				STRESS_CHECK(done == (((size - stored) < k) ? (size - stored) : k));
+				break;
+
+			case 3:
+				ret = fifo_mirror_pushv(&fifo, iov, 2);
+				done = ((ret == 0) ? k : 0);
+				STRESS_CHECK((ret == 0) == ((stored + k) <= size));
+				break;
+
+			default:
+				ret = fifo_mirror_reserve(&fifo, (fifo_size_t)k, (void **)&region);
+				done = ((ret == 0) ? k : 0);
+				STRESS_CHECK((ret == 0) == ((stored + k) <= size));
+				if(ret != 0) break;
+
+				for(i = 0; i < k; i++) region[i] = in[i]; /* one span, also past the end of the first mapping */
+				STRESS_CHECK(fifo_mirror_commit(&fifo, (fifo_size_t)k) == 0);
+				break;
+			}
+
+			stored += done;
+			seq_in += done;
+		}
+		else
+		{
+			iov[0].base = out;
+			iov[0].len = (fifo_size_t)(k / 2);
+			iov[1].base = &out[k / 2];
+			iov[1].len = (fifo_size_t)(k - (k / 2));
+
+			switch(stress_rand(&rng) % 5)
+			{
+			case 0:
+				ret = fifo_mirror_pop(&fifo, out);
+				done = ((ret == 0) ? 1 : 0);
+				STRESS_CHECK((ret == 0) == (stored != 0));
+				break;
+
+			case 1:
+				ret = fifo_mirror_pop_mul(&fifo, out, (fifo_size_t)k);
+				done = ((ret == 0) ? k : 0);
+				STRESS_CHECK((ret == 0) == (k <= stored));
+				break;
+
+			case 2:
+				done = fifo_mirror_read_some(&fifo, out, (fifo_size_t)k);
+				STRESS_CHECK(done == ((stored < k) ? stored : k));
+				break;
+
+			case 3:
+				ret = fifo_mirror_popv(&fifo, iov, 2);
+				done = ((ret == 0) ? k : 0);
+				STRESS_CHECK((ret == 0) == (k <= stored));
+				break;
+
+			default:
+				ret = fifo_mirror_peek(&fifo, (fifo_size_t)k, (void **)&region);
+				done = ((ret == 0) ? k : 0);
+				STRESS_CHECK((ret == 0) == (k <= stored));
+				if(ret != 0) break;
+
+				if((region + k) > (uint32_t *)(void *)fifo.limit_ptr) wraps++;
+				for(i = 0; i < k; i++) out[i] = region[i]; /* one span, also past the end of the first mapping */
+				STRESS_CHECK(fifo_mirror_release(&fifo, (fifo_size_t)k) == 0);
+				break;
+			}
+
+			for(i = 0; i < done; i++) STRESS_CHECK(out[i] == (seq_out + i));
+
+			stored -= done;
+			seq_out += done;
+			entries += done;
+		}
+
+		STRESS_CHECK((uint32_t)(fifo.max_size - fifo.free_size) == stored);
+	}
+
+	STRESS_CHECK(wraps != 0); /* some peeked span crossed the wrap */
+	STRESS_CHECK(fifo_mirror_deinit(&fifo) == 0);
+
+	print_result("mirror", 1, 1, entries, (now_ns() - start), (atomic_load(&stress_errors) - errors));
+}
+
+/**
+ *	@brief Producer process of shm mode: attaches its own mapping of fd, pushes with push, push_mul, write_some
+ *	and reserve/commit of random batches, exits with 0 when all of its checks passed.
+ */
+static void stress_shm_producer(int fd)
+{
+	stress_entry_TD batch[STRESS_MAX_BATCH];
+	fifo_shm_TD fifo;
+	uint64_t rng = 0xE7037ED1A0B428DBull;
+	uint32_t errors = atomic_load(&stress_errors);
+	void *region1 = NULL;
+	void *region2 = NULL;
+	fifo_size_t len1 = 0;
+	fifo_size_t len2 = 0;
+	uint32_t seq = 0;
+	uint32_t k = 0;
+	uint32_t i = 0;
+	uint32_t done = 0;
+
+	STRESS_CHECK(fifo_shm_attach_fd(&fifo, fd) == 0); /* a mapping of its own at another address */
+	if(fifo.header == NULL) _exit(1);
+
+	while(seq < stress_items)
+	{
+		k = stress_batch(&rng, STRESS_MAX_BATCH);
+		if(k > (stress_items - seq)) k = (stress_items - seq);
+
+		for(i = 0; i < k; i++) batch[i] = stress_entry(0, (seq + i));
+
+		switch(stress_rand(&rng) % 4)
+		{
+		case 0:
+			done = ((fifo_shm_push(&fifo, batch) == 0) ? 1 : 0);
+			break;
+
+		case 1:
+			done = ((fifo_shm_push_mul(&fifo, batch, (fifo_size_t)k) == 0) ? k : 0);
+			break;
+
+		case 2:
+			done = fifo_shm_write_some(&fifo, batch, (fifo_size_t)k);
+			break;
+
+		default:
+			done = 0;
+			if(fifo_shm_reserve(&fifo, (fifo_size_t)k, &region1, &len1, &region2, &len2) != 0) break;
+
+			memcpy(region1, batch, ((size_t)len1 * sizeof(stress_entry_TD)));
+			stress_perturb(&rng);
+			if(len2 != 0) memcpy(region2, &batch[len1], ((size_t)len2 * sizeof(stress_entry_TD)));
+			STRESS_CHECK(fifo_shm_commit(&fifo, (fifo_size_t)k) == 0);
+			done = k;
+			break;
+		}
+
+		seq += done;
+
+		if(done == 0) sched_yield(); /* full */
+		else stress_perturb(&rng);
+	}
+
+	STRESS_CHECK(fifo_shm_detach(&fifo) == 0);
+
+	_exit((atomic_load(&stress_errors) == errors) ? 0 : 1);
+}
+
+/**
+ *	@brief Runs shm mode: a forked producer process and this process as consumer share a memfd FIFO buffer,
+ *	every entry must be the next one, intact. The consumer stops waiting when the producer died.
+ */
+static void stress_shm(void)
+{
+	stress_entry_TD batch[STRESS_MAX_BATCH];
+	fifo_shm_TD fifo;
+	uint32_t errors = atomic_load(&stress_errors);
+	uint64_t rng = 0x8EBC6AF09C88C6E3ull;
+	uint64_t start = now_ns();
+	void *region1 = NULL;
+	void *region2 = NULL;
+	fifo_size_t len1 = 0;
+	fifo_size_t len2 = 0;
+	uint32_t seq = 0;
+	uint32_t k = 0;
+	uint32_t i = 0;
+	uint32_t done = 0;
+	int status = -1;
+	bool exited = false;
+	pid_t pid = -1;
+	int fd = memfd_create("fifo_stress", MFD_CLOEXEC);
+
+	STRESS_CHECK(fd >= 0);
+	if(fd < 0) return;
+
+	STRESS_CHECK(fifo_shm_create_fd(&fifo, fd, STRESS_CAPACITY, sizeof(stress_entry_TD)) == 0);
+	if(fifo.header == NULL)
+	{
+		close(fd);
+		return;
+	}
+
+	fflush(stdout);
+	pid = fork();
+	if(pid == 0) stress_shm_producer(fd);
+	STRESS_CHECK(pid > 0);
+
+	while((pid > 0) && (seq < stress_items))
+	{
+		k = stress_batch(&rng, STRESS_MAX_BATCH);
+
+		switch(stress_rand(&rng) % 4)
+		{
+		case 0:
+			done = ((fifo_shm_pop(&fifo, batch) == 0) ? 1 : 0);
+			break;
+
+		case 1:
+			done = ((fifo_shm_pop_mul(&fifo, batch, (fifo_size_t)k) == 0) ? k : 0);
+			break;
+
+		case 2:
+			done = fifo_shm_read_some(&fifo, batch, (fifo_size_t)k);
+			break;
+
+		default:
+			done = 0;
+			if(fifo_shm_peek(&fifo, (fifo_size_t)k, &region1, &len1, &region2, &len2) != 0) break;
+
+			memcpy(batch, region1, ((size_t)len1 * sizeof(stress_entry_TD)));
+			stress_perturb(&rng);
+			if(len2 != 0) memcpy(&batch[len1], region2, ((size_t)len2 * sizeof(stress_entry_TD)));
+			STRESS_CHECK(fifo_shm_release(&fifo, (fifo_size_t)k) == 0);
+			done = k;
+			break;
+		}
+
+		for(i = 0; i < done; i++) STRESS_CHECK(stress_entry_valid(&batch[i]) && (batch[i].seq == (seq + i)));
+
+		seq += done;
+
+		if(done != 0) stress_perturb(&rng);
+		else if(exited && (fifo_shm_count(&fifo) == 0)) break; /* producer gone, nothing more will come */
+		else if(waitpid(pid, &status, WNOHANG) == pid) exited = true;
+		else sched_yield(); /* empty */
+	}
+
+	if((pid > 0) && !exited) STRESS_CHECK(waitpid(pid, &status, 0) == pid);
+
+	STRESS_CHECK(WIFEXITED(status) && (WEXITSTATUS(status) == 0)); /* producer checks passed */
+	STRESS_CHECK((seq == stress_items) && (fifo_shm_count(&fifo) == 0));
+	STRESS_CHECK(fifo_shm_detach(&fifo) == 0);
+	close(fd);
+
+	print_result("shm", 1, 1, stress_items, (now_ns() - start), (atomic_load(&stress_errors) - errors));
+}
+
+static fifo_spsc_common_TD stress_wait_fifo;					/**< FIFO buffer of wait mode */
+static stress_entry_TD stress_wait_storage[STRESS_CAPACITY];
+static fifo_wait_TD stress_wait;								/**< Wait state of wait mode */
+
+/**
+ *	@brief Producer of wait mode: blocking and non-blocking fifo_wait_push, write_some with an explicit notify.
+ */
+static void *stress_wait_producer(void *arg)
+{
+	stress_thread_TD *thread = arg;
+	stress_entry_TD batch[STRESS_MAX_BATCH];
+	uint32_t seq = 0;
+	uint32_t k = 0;
+	uint32_t i = 0;
+	uint32_t done = 0;
+
+	while(seq < stress_items)
+	{
+		k = stress_batch(&thread->rng, STRESS_MAX_BATCH);
+		if(k > (stress_items - seq)) k = (stress_items - seq);
+
+		for(i = 0; i < k; i++) batch[i] = stress_entry(0, (seq + i));
+
+		switch(stress_rand(&thread->rng) % 3)
+		{
+		case 0:
+			done = ((fifo_wait_push(&stress_wait, &stress_wait_fifo.ring, stress_wait_fifo.buffer, batch, (fifo_size_t)k, STRESS_WAIT_MS) == 0) ? k : 0);
+			STRESS_CHECK(done != 0); /* lost wakeup */
+			break;
+
+		case 1:
+			done = ((fifo_wait_push(&stress_wait, &stress_wait_fifo.ring, stress_wait_fifo.buffer, batch, (fifo_size_t)k, 0) == 0) ? k : 0);
+			break;
+
+		default:
+			done = fifo_spsc_ring_write_some(&stress_wait_fifo.ring, stress_wait_fifo.buffer, batch, (fifo_size_t)k);
+			if(done != 0) fifo_wait_notify_data(&stress_wait, &stress_wait_fifo.ring);
+			break;
+		}
+
+		seq += done;
+
+		if(done == 0) sched_yield(); /* full */
+		else stress_perturb(&thread->rng);
+	}
+
+	return NULL;
+}
+
+/**
+ *	@brief Consumer of wait mode: blocking fifo_wait_pop and fifo_wait_drain, read_some with an explicit notify,
+ *	every entry must be the next one. A blocking call never asks for more than is still to come.
+ */
+static void *stress_wait_consumer(void *arg)
+{
+	stress_thread_TD *thread = arg;
+	stress_entry_TD batch[STRESS_MAX_BATCH];
+	uint32_t seq = 0;
+	uint32_t k = 0;
+	uint32_t i = 0;
+	uint32_t done = 0;
+
+	while(seq < stress_items)
+	{
+		k = stress_batch(&thread->rng, STRESS_MAX_BATCH);
+		if(k > (stress_items - seq)) k = (stress_items - seq);
+
+		switch(stress_rand(&thread->rng) % 3)
+		{
+		case 0:
+			done = ((fifo_wait_pop(&stress_wait, &stress_wait_fifo.ring, stress_wait_fifo.buffer, batch, (fifo_size_t)k, STRESS_WAIT_MS) == 0) ? k : 0);
+			STRESS_CHECK(done != 0); /* lost wakeup */
+			break;
+
+		case 1:
+			done = fifo_wait_drain(&stress_wait, &stress_wait_fifo.ring, stress_wait_fifo.buffer, batch, (fifo_size_t)k, STRESS_MAX_BATCH, STRESS_WAIT_MS);
+			STRESS_CHECK(done >= k); /* lost wakeup */
+			break;
+
+		default:
+			done = fifo_spsc_ring_read_some(&stress_wait_fifo.ring, stress_wait_fifo.buffer, batch, (fifo_size_t)k);
+			if(done != 0) fifo_wait_notify_space(&stress_wait, &stress_wait_fifo.ring);
+			break;
+		}
+
+		for(i = 0; i < done; i++) STRESS_CHECK(stress_entry_valid(&batch[i]) && (batch[i].seq == (seq + i)));
+
+		seq += done;
+
+		if(done == 0) sched_yield(); /* empty */
+		else stress_perturb(&thread->rng);
+	}
+
+	STRESS_CHECK(fifo_spsc_ring_count(&stress_wait_fifo.ring) == 0);
+
+	return NULL;
+}
+
+static fifo_spsc_common_TD stress_event_fifo;					/**< FIFO buffer of event mode */
+static stress_entry_TD stress_event_storage[STRESS_CAPACITY];
+static fifo_event_TD stress_event;								/**< Event state of event mode */
+
+/**
+ *	@brief Waits until eventfd of event mode is readable, returns false on STRESS_WAIT_MS timeout.
+ */
+static bool stress_event_poll(int fd)
+{
+	struct pollfd pfd;
+
+	pfd.fd = fd;
+	pfd.events = POLLIN;
+	pfd.revents = 0;
+
+	return (poll(&pfd, 1, STRESS_WAIT_MS) == 1);
+}
+
+/**
+ *	@brief Producer of event mode: push and write_some, arms space_fd and polls it when nothing fits.
+ */
+static void *stress_event_producer(void *arg)
+{
+	stress_thread_TD *thread = arg;
+	stress_entry_TD batch[STRESS_MAX_BATCH];
+	uint32_t seq = 0;
+	uint32_t k = 0;
+	uint32_t i = 0;
+	uint32_t done = 0;
+
+	while(seq < stress_items)
+	{
+		k = stress_batch(&thread->rng, STRESS_MAX_BATCH);
+		if(k > (stress_items - seq)) k = (stress_items - seq);
+
+		for(i = 0; i < k; i++) batch[i] = stress_entry(0, (seq + i));
+
+		if(stress_rand(&thread->rng) & 1) done = fifo_event_write_some(&stress_event, &stress_event_fifo.ring, stress_event_fifo.buffer, batch, (fifo_size_t)k);
+		else done = ((fifo_event_push(&stress_event, &stress_event_fifo.ring, stress_event_fifo.buffer, batch, (fifo_size_t)k) == 0) ? k : 0);
+
+		seq += done;
+
+		if(done != 0) stress_perturb(&thread->rng);
+		else if(fifo_event_arm_space(&stress_event, &stress_event_fifo.ring) == 0) STRESS_CHECK(stress_event_poll(stress_event.space_fd)); /* lost edge */
+		else sched_yield(); /* less place than k */
+	}
+
+	return NULL;
+}
+
+/**
+ *	@brief Consumer of event mode: pop and read_some, arms data_fd and polls it when nothing came,
+ *	every entry must be the next one.
+ */
+static void *stress_event_consumer(void *arg)
+{
+	stress_thread_TD *thread = arg;
+	stress_entry_TD batch[STRESS_MAX_BATCH];
+	uint32_t seq = 0;
+	uint32_t k = 0;
+	uint32_t i = 0;
+	uint32_t done = 0;
+
+	while(seq < stress_items)
+	{
+		k = stress_batch(&thread->rng, STRESS_MAX_BATCH);
+		if(k > (stress_items - seq)) k = (stress_items - seq);
+
+		if(stress_rand(&thread->rng) & 1) done = fifo_event_read_some(&stress_event, &stress_event_fifo.ring, stress_event_fifo.buffer, batch, (fifo_size_t)k);
+		else done = ((fifo_event_pop(&stress_event, &stress_event_fifo.ring, stress_event_fifo.buffer, batch, (fifo_size_t)k) == 0) ? k : 0);
+
+		for(i = 0; i < done; i++) STRESS_CHECK(stress_entry_valid(&batch[i]) && (batch[i].seq == (seq + i)));
+
+		seq += done;
+
+		if(done != 0) stress_perturb(&thread->rng);
+		else if(fifo_event_arm_data(&stress_event, &stress_event_fifo.ring) == 0) STRESS_CHECK(stress_event_poll(stress_event.data_fd)); /* lost edge */
+		else sched_yield(); /* less entries than k */
+	}
+
+	STRESS_CHECK(fifo_spsc_ring_count(&stress_event_fifo.ring) == 0);
+
+	return NULL;
+}
+
+/**
+ *	@brief Drops FIFO file handle without syncing, as a crashed process would.
+ */
+static void stress_file_crash(fifo_file_TD *fifo)
+{
+	munmap(fifo->header, fifo->map_size);
+	close(fifo->fd);
+}
+
+/**
+ *	@brief Reopens FIFO file with FIFO_FILE_RECOVER_SYNCED and checks the recovered entries:
+ *	exactly the ones between the synced indices, consecutive, none of them newer than pushed.
+ */
+static void stress_file_recover(const char *path, fifo_index_t synced, uint32_t seq_in)
+{
+	fifo_file_TD fifo;
+	uint32_t val = 0;
+	uint32_t first = 0;
+	uint32_t n = 0;
+
+	STRESS_CHECK(fifo_file_open(&fifo, path, 8, sizeof(uint32_t), 0, FIFO_FILE_RECOVER_SYNCED) == 0);
+	STRESS_CHECK(fifo_file_count(&fifo) == synced);
+
+	while(fifo_file_pop(&fifo, &val) == 0)
+	{
+		if(n == 0) first = val;
+
+		STRESS_CHECK((val == (first + n)) && (val < seq_in)); /* no slot overwritten since the sync */
+		n++;
+	}
+
+	STRESS_CHECK(n == synced);
+	STRESS_CHECK(fifo_file_close(&fifo) == 0);
+}
+
+/**
+ *	@brief Crash recovery check of FIFO file opened with FIFO_FILE_RECOVER_LIVE after more than a lap of
+ *	unsynced pushes: the first sync must flush every entry, not only the modular distance past sync_tail.
+ */
+static void stress_file_live(const char *path)
+{
+	uint32_t batch[8];
+	fifo_file_TD fifo;
+	uint32_t i = 0;
+
+	for(i = 0; i < 8; i++) batch[i] = i;
+
+	STRESS_CHECK(truncate(path, 0) == 0);
+	STRESS_CHECK(fifo_file_open(&fifo, path, 8, sizeof(uint32_t), 0, FIFO_FILE_RECOVER_LIVE) == 0);
+	STRESS_CHECK(fifo.unsynced == 0);
+	STRESS_CHECK(fifo_file_push_mul(&fifo, batch, 8) == 0);
+	STRESS_CHECK(fifo_file_pop_mul(&fifo, batch, 8) == 0);
+
+	for(i = 0; i < 5; i++) batch[i] = (8 + i);
+
+	STRESS_CHECK(fifo_file_push_mul(&fifo, batch, 5) == 0); /* 13 unsynced pushes, tail 5 past sync_tail */
+	stress_file_crash(&fifo);
+
+	STRESS_CHECK(fifo_file_open(&fifo, path, 8, sizeof(uint32_t), 0, FIFO_FILE_RECOVER_LIVE) == 0);
+	STRESS_CHECK(fifo.recovered && (fifo_file_count(&fifo) == 5));
+	STRESS_CHECK(fifo.unsynced == FIFO_SIZE_MAX); /* live indices ahead of the synced ones */
+	STRESS_CHECK(fifo_file_sync(&fifo) == 0);
+	STRESS_CHECK(fifo.unsynced == 0);
+	stress_file_crash(&fifo);
+
+	STRESS_CHECK(fifo_file_open(&fifo, path, 8, sizeof(uint32_t), 0, FIFO_FILE_RECOVER_LIVE) == 0);
+	STRESS_CHECK(fifo.unsynced == 0); /* live indices equal the synced ones */
+	stress_file_crash(&fifo);
+
+	stress_file_recover(path, 5, 13);
+}
+
+/**
+ *	@brief Reopen check of a file that was sized but not formatted, as a crash right after creation leaves it:
+ *	an all-zero header is formatted again, a header with any other content is rejected and left untouched.
+ */
+static void stress_file_blank(const char *path)
+{
+	fifo_file_TD fifo;
+	uint32_t val = 7;
+	int fd = -1;
+
+	STRESS_CHECK(truncate(path, 0) == 0);
+	STRESS_CHECK(truncate(path, (off_t)fifo_file_size(8, sizeof(uint32_t))) == 0);
+	STRESS_CHECK(fifo_file_open(&fifo, path, 8, sizeof(uint32_t), 0, FIFO_FILE_RECOVER_SYNCED) == 0);
+	STRESS_CHECK((fifo.recovered == false) && (fifo_file_count(&fifo) == 0));
+	STRESS_CHECK(fifo_file_push(&fifo, &val) == 0);
+	STRESS_CHECK(fifo_file_close(&fifo) == 0);
+
+	STRESS_CHECK(fifo_file_open(&fifo, path, 8, sizeof(uint32_t), 0, FIFO_FILE_RECOVER_SYNCED) == 0);
+	STRESS_CHECK(fifo.recovered && (fifo_file_count(&fifo) == 1));
+	STRESS_CHECK(fifo_file_close(&fifo) == 0);
+
+	fd = open(path, O_WRONLY);
+	STRESS_CHECK(fd >= 0);
+	STRESS_CHECK(pwrite(fd, &val, 1, 16) == 1); /* corrupt the header inside data_offset */
+	if(fd >= 0) close(fd);
+
+	STRESS_CHECK(fifo_file_open(&fifo, path, 8, sizeof(uint32_t), 0, FIFO_FILE_RECOVER_SYNCED) == -5);
+}
+
+/**
+ *	@brief Single-threaded crash recovery check of FIFO file opened with FIFO_FILE_RECOVER_SYNCED:
+ *	random pushes, pops and syncs, then the handle is dropped and the file reopened. The first trial
+ *	pops past the synced head and pushes into the slots of the popped entries.
+ */
+static void stress_file(void)
+{
+	char path[] = "/tmp/fifo_stress_XXXXXX";
+	uint32_t batch[8];
+	fifo_file_TD fifo;
+	uint32_t errors = atomic_load(&stress_errors);
+	uint32_t trials = ((stress_items / 1000) + 1);
+	uint64_t rng = 0x853C49E6748FEA9Bull;
+	uint64_t start = now_ns();
+	uint64_t entries = 0;
+	fifo_index_t synced = 0;
+	uint32_t seq_in = 0;
+	uint32_t seq_out = 0;
+	uint32_t trial = 0;
+	uint32_t op = 0;
+	uint32_t k = 0;
+	uint32_t i = 0;
+	uint32_t done = 0;
+	int fd = mkstemp(path);
+
+	STRESS_CHECK(fd >= 0);
+	if(fd < 0) return;
+	close(fd);
+
+	for(trial = 0; trial < trials; trial++)
+	{
+		STRESS_CHECK(truncate(path, 0) == 0);
+		STRESS_CHECK(fifo_file_open(&fifo, path, 8, sizeof(uint32_t), 0, FIFO_FILE_RECOVER_SYNCED) == 0);
+
+		seq_in = 0;
+		seq_out = 0;
+
+		for(op = 0; op < ((trial == 0) ? 3 : 64); op++)
+		{
+			k = ((trial == 0) ? ((op == 1) ? 4 : 8) : stress_batch(&rng, 8));
+
+			switch((trial == 0) ? ((op == 1) ? 1 : 0) : (stress_rand(&rng) % 5))
+			{
+			case 0:
+			case 3:
+				for(i = 0; i < k; i++) batch[i] = (seq_in + i);
+
+				done = fifo_file_write_some(&fifo, batch, (fifo_size_t)k);
+				seq_in += done;
+
+				if((trial == 0) && (op == 0)) STRESS_CHECK(fifo_file_sync(&fifo) == 0);
+				break;
+
+			case 1:
+				done = fifo_file_read_some(&fifo, batch, (fifo_size_t)k);
+
+				for(i = 0; i < done; i++) STRESS_CHECK(batch[i] == (seq_out + i));
+
+				seq_out += done;
+				break;
+
+			default:
+				STRESS_CHECK(fifo_file_sync(&fifo) == 0);
+				break;
+			}
+
+			entries += done;
+		}
+
+		if(trial == 0) STRESS_CHECK((seq_in == 12) && (seq_out == 4)); /* pushed over the popped entries after a sync */
+
+		synced = fifo.header->sync_tail;
+		synced = ((synced >= fifo.header->sync_head) ? (synced - fifo.header->sync_head) : ((synced + 16) - fifo.header->sync_head));
+
+		stress_file_crash(&fifo);
+		stress_file_recover(path, synced, seq_in);
+	}
+
+	stress_file_live(path);
+	stress_file_blank(path);
+	unlink(path);
+
+	print_result("file", 1, 1, entries, (now_ns() - start), (atomic_load(&stress_errors) - errors));
+}
+
+#endif /* __linux__ */
+
+int main(int argc, char **argv)
+{
+	int i = 0;
+
+	for(i = 1; i < argc; i++)
+	{
+		if(strcmp(argv[i], "--quick") == 0) stress_items = 20000;
+	}
+
+	stress_common();
+	stress_pow2();
+	stress_group();
+
+	STRESS_CHECK(fifo_spsc_uint32_init(&stress_spsc, stress_spsc_storage, STRESS_CAPACITY, true) == 0);
+	stress_run("spsc", stress_spsc_producer, 1, stress_spsc_consumer, 1);
+
+	stress_mpmc_run();
+	stress_shard_run();
+
+	STRESS_CHECK(fifo_mpsc_init(&stress_mpsc, stress_mpsc_storage, STRESS_CAPACITY, sizeof(stress_entry_TD), true) == 0);
+	stress_run("mpsc", stress_mpsc_producer, stress_producers, stress_mpsc_consumer, 1);
+
+	stress_lossy_start();
+	STRESS_CHECK(fifo_lossy_init(&stress_lossy, stress_lossy_storage, STRESS_CAPACITY, sizeof(stress_entry_TD)) == 0);
+	for(i = 0; i < (int)stress_consumers; i++) STRESS_CHECK(fifo_lossy_reader_init(&stress_lossy_readers[i], &stress_lossy) == 0);
+	stress_run("lossy", stress_lossy_producer, 1, stress_lossy_consumer, stress_consumers);
+
+	STRESS_CHECK(fifo_msg_init(&stress_msg, stress_msg_storage, sizeof(stress_msg_storage), true) == 0);
+	stress_run("msg", stress_msg_producer, 1, stress_msg_consumer, 1);
+
+	stress_pool_run();
+
+#if defined(__linux__)
+	stress_mirror();
+	stress_shm();
+
+	STRESS_CHECK(fifo_spsc_common_init(&stress_wait_fifo, stress_wait_storage, STRESS_CAPACITY, sizeof(stress_entry_TD), true) == 0);
+	STRESS_CHECK(fifo_wait_init(&stress_wait) == 0);
+	stress_run("wait", stress_wait_producer, 1, stress_wait_consumer, 1);
+
+	STRESS_CHECK(fifo_spsc_common_init(&stress_event_fifo, stress_event_storage, STRESS_CAPACITY, sizeof(stress_entry_TD), true) == 0);
+	STRESS_CHECK(fifo_event_init(&stress_event) == 0);
+	STRESS_CHECK(fifo_event_arm_data(NULL, &stress_event_fifo.ring) == -1);
+	STRESS_CHECK(fifo_event_arm_space(&stress_event, NULL) == -2);
+	STRESS_CHECK(fifo_event_arm_space(&stress_event, &stress_event_fifo.ring) == 1); /* empty, place left */
+	stress_run("event", stress_event_producer, 1, stress_event_consumer, 1);
+	STRESS_CHECK(fifo_event_deinit(&stress_event) == 0);
+
+	stress_file();
+#endif
+
+	if(atomic_load(&stress_errors) != 0)
+	{
+		fprintf(stderr, "fifo_stress: %lu checks failed\n", (unsigned long)atomic_load(&stress_errors));
+		return 1;
+	}
+
+	return 0;
+}